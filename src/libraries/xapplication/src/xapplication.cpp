@@ -52,7 +52,12 @@ xtop_application::xtop_application(common::xnode_id_t const & node_id, xpublic_k
   , m_grpc_thread{make_object_ptr<base::xiothread_t>()}
   , m_sync_thread{make_object_ptr<base::xiothread_t>()}
   , m_elect_client{top::make_unique<elect::xelect_client_imp>()} {
-    std::shared_ptr<db::xdb_face_t> db = db::xdb_factory_t::instance(XGET_CONFIG(db_path));
+    db::xdb_options_t db_options;
+    db_options.default_cf_profile = db::xdb_cf_profile_t::from_name(XGET_CONFIG(db_default_cf_profile));
+    db_options.block_cf_profile = db::xdb_cf_profile_t::from_name(XGET_CONFIG(db_block_cf_profile));
+    db_options.write_pipeline.enable = (std::string(XGET_CONFIG(db_write_pipeline)) == "on");
+    db_options.write_pipeline.wal_sync = (std::string(XGET_CONFIG(db_wal_sync)) == "batch") ? db::xdb_wal_sync_every_batch : db::xdb_wal_sync_none;
+    std::shared_ptr<db::xdb_face_t> db = db::xdb_factory_t::instance(XGET_CONFIG(db_path), std::vector<db::xdb_path_t>(), db_options);
     m_store = store::xstore_factory::create_store_with_static_kvdb(db);
     base::xvchain_t::instance().set_xdbstore(m_store.get());
     base::xvchain_t::instance().set_xevmbus(m_bus.get());
@@ -16,6 +16,9 @@
 #include "xdata/xtable_bstate.h"
 #include "xsync/xsync_store_shadow.h"
 
+#include <algorithm>
+#include <set>
+
 NS_BEG2(top, sync)
 
 using namespace mbus;
@@ -29,13 +32,15 @@ xchain_downloader_t::xchain_downloader_t(std::string vnode_id,
                                  const observer_ptr<base::xvcertauth_t> &certauth,
                                  xsync_sender_t *sync_sender,
                                  xsync_ratelimit_face_t *ratelimit,
-                                 const std::string & address):
+                                 const std::string & address,
+                                 xsync_block_verifier_t *block_verifier):
   m_vnode_id(vnode_id),
   m_sync_store(sync_store),
   m_mbus(mbus),
   m_certauth(certauth),
   m_sync_sender(sync_sender),
   m_ratelimit(ratelimit),
+  m_block_verifier(block_verifier),
   m_address(address),
   m_sync_range_mgr(vnode_id, address) {
     xsync_info("chain_downloader create_chain %s", m_address.c_str());
@@ -251,8 +256,10 @@ enum_result_code xchain_downloader_t::pre_handle_block(
     return enum_result_code::success;
 }
 
-enum_result_code xchain_downloader_t::handle_block(xblock_ptr_t &block, bool is_elect_chain, uint64_t quota_height) {
-    if (is_elect_chain) {
+enum_result_code xchain_downloader_t::handle_block(xblock_ptr_t &block, bool need_auth, uint64_t quota_height) {
+    // signing group of an elect chain block after an election boundary may be elected by the block stored just before it,
+    // so they are verified one by one and in order with storing
+    if (need_auth) {
         if (!check_auth(m_certauth, block)) {
             return enum_result_code::auth_failed;
         }
@@ -281,6 +288,18 @@ enum_result_code xchain_downloader_t::handle_block(xblock_ptr_t &block, bool is_
     return enum_result_code::success;
 }
 
+void xchain_downloader_t::verify_blocks(std::vector<data::xblock_ptr_t> &blocks, std::vector<uint8_t> &passed) {
+    if (m_block_verifier != nullptr) {
+        m_block_verifier->verify(m_certauth, blocks, passed);
+        return;
+    }
+
+    passed.assign(blocks.size(), 0);
+    for (size_t i = 0; i < blocks.size(); i++) {
+        passed[i] = check_auth(m_certauth, blocks[i]) ? 1 : 0;
+    }
+}
+
 int64_t xchain_downloader_t::get_time() {
     return base::xtime_utl::gmttime_ms();
 }
@@ -556,14 +575,6 @@ xsync_command_execute_result xchain_downloader_t::execute_next_download(std::vec
         is_elect_chain = true;
     }
 
-    if (!is_elect_chain){
-        xblock_ptr_t &block = blocks[count-1];
-        if (!check_auth(m_certauth, block)) {
-            xsync_info("chain_downloader on_response(auth_failed) %s,height=%lu,", m_address.c_str(), block->get_height());
-            return ignore;
-        }
-    }
-
     enum_chain_sync_policy sync_policy;
     if (!m_sync_range_mgr.get_sync_policy(sync_policy)) {
         xsync_info("chain_downloader on_response(not behind) %s,", m_address.c_str());
@@ -575,6 +586,47 @@ xsync_command_execute_result xchain_downloader_t::execute_next_download(std::vec
         return ignore;
     }
 
+    if (!is_elect_chain) {
+        if (!check_blocks_linked(blocks)) {
+            xsync_warn("chain_downloader on_response(unlinked) %s,height=%lu,", m_address.c_str(), blocks[count-1]->get_height());
+            return ignore;
+        }
+
+        // blocks linked back from the tail block by hash are trusted once the tail is verified,
+        // others(forks) are verified as well, all on the verifier pool
+        std::vector<data::xblock_ptr_t> verify_block_list = blocks_off_tail_chain(blocks);
+        verify_block_list.push_back(blocks[count-1]);
+        std::vector<uint8_t> passed;
+        verify_blocks(verify_block_list, passed);
+        if (!passed.back()) {
+            xsync_info("chain_downloader on_response(auth_failed) %s,height=%lu,", m_address.c_str(), blocks[count-1]->get_height());
+            return ignore;
+        }
+
+        // a bad fork block is skipped alone
+        std::set<data::xblock_t*> failed_blocks;
+        for (size_t i = 0; i + 1 < verify_block_list.size(); i++) {
+            if (!passed[i]) {
+                xsync_info("chain_downloader on_response(auth_failed) %s,height=%lu,", m_address.c_str(), verify_block_list[i]->get_height());
+                failed_blocks.insert(verify_block_list[i].get());
+            }
+        }
+        if (!failed_blocks.empty()) {
+            blocks.erase(std::remove_if(blocks.begin(), blocks.end(), [&failed_blocks](const data::xblock_ptr_t &block) {
+                return failed_blocks.find(block.get()) != failed_blocks.end();
+            }), blocks.end());
+            count = blocks.size();
+        }
+    }
+
+    // elect chain blocks before the first election boundary are signed by groups known already,
+    // so they are verified together on the verifier pool, the rest in handle_block
+    std::vector<uint8_t> elect_passed;
+    if (is_elect_chain) {
+        std::vector<data::xblock_ptr_t> verify_block_list(blocks.begin(), blocks.begin() + blocks_before_elect_boundary(blocks));
+        verify_blocks(verify_block_list, elect_passed);
+    }
+
     auto next_block = blocks[blocks.size() - 1];
     init_committed_event_group();
     #if 0
@@ -593,7 +645,12 @@ xsync_command_execute_result xchain_downloader_t::execute_next_download(std::vec
     // compare before and after
     for (uint32_t i = 0; i < count; i++) {
         xblock_ptr_t &block = blocks[i];
-        enum_result_code ret = handle_block(block, is_elect_chain, next_block->get_height());
+        enum_result_code ret;
+        if (i < elect_passed.size()) {
+            ret = elect_passed[i] ? handle_block(block, false, next_block->get_height()) : enum_result_code::auth_failed;
+        } else {
+            ret = handle_block(block, is_elect_chain, next_block->get_height());
+        }
 
         if (ret == enum_result_code::success) {
             xsync_dbg("chain_downloader on_response(succ) %s,height=%lu,viewid=%lu,prev_hash:%s,",
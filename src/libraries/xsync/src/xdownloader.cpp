@@ -121,7 +121,8 @@ xdownloader_t::xdownloader_t(std::string vnode_id, xsync_store_face_t *sync_stor
             const observer_ptr<mbus::xmessage_bus_face_t> &mbus,
             const observer_ptr<base::xvcertauth_t> &certauth,
             xrole_chains_mgr_t *role_chains_mgr, xsync_sender_t *sync_sender,
-            const std::vector<observer_ptr<base::xiothread_t>> &thread_pool, xsync_ratelimit_face_t *ratelimit, xsync_store_shadow_t * shadow):
+            const std::vector<observer_ptr<base::xiothread_t>> &thread_pool, xsync_ratelimit_face_t *ratelimit, xsync_store_shadow_t * shadow,
+            xsync_block_verifier_t *block_verifier):
 m_vnode_id(vnode_id),
 m_sync_store(sync_store),
 m_mbus(mbus),
@@ -129,6 +130,7 @@ m_certauth(certauth),
 m_role_chains_mgr(role_chains_mgr),
 m_sync_sender(sync_sender),
 m_ratelimit(ratelimit),
+m_block_verifier(block_verifier),
 m_store_shadow(shadow){
     m_store_shadow->set_downloader(this);
     m_thread_count = thread_pool.size();
@@ -369,7 +371,7 @@ xchain_downloader_face_ptr_t xdownloader_t::find_chain_downloader(uint32_t idx,
 
 xchain_downloader_face_ptr_t xdownloader_t::create_chain_downloader(uint32_t idx, const std::string &address) {
 
-    xchain_downloader_face_ptr_t account = std::make_shared<xchain_downloader_t>(m_vnode_id, m_sync_store, m_mbus, m_certauth, m_sync_sender, m_ratelimit, address);
+    xchain_downloader_face_ptr_t account = std::make_shared<xchain_downloader_t>(m_vnode_id, m_sync_store, m_mbus, m_certauth, m_sync_sender, m_ratelimit, address, m_block_verifier);
     m_vector_chains[idx][address] = account;
     return account;
 }
@@ -0,0 +1,80 @@
+// Copyright (c) 2017-2018 Telos Foundation & contributors
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "xsync/xsync_block_bytes_cache.h"
+#include "xmetrics/xmetrics.h"
+
+#include <iterator>
+
+NS_BEG2(top, sync)
+
+xsync_block_bytes_cache_t::xsync_block_bytes_cache_t(size_t max_bytes):
+m_max_bytes(max_bytes) {
+}
+
+std::string xsync_block_bytes_cache_t::make_key(const std::string & account, uint64_t height) {
+    return account + ":" + std::to_string(height);
+}
+
+xsync_block_bytes_ptr_t xsync_block_bytes_cache_t::get(const std::string & account, uint64_t height) {
+    std::unique_lock<std::mutex> lock(m_lock);
+    auto it = m_index.find(make_key(account, height));
+    if (it == m_index.end()) {
+        XMETRICS_COUNTER_INCREMENT("xsync_block_bytes_cache_miss", 1);
+        return nullptr;
+    }
+
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    XMETRICS_COUNTER_INCREMENT("xsync_block_bytes_cache_hit", 1);
+    return it->second->bytes;
+}
+
+void xsync_block_bytes_cache_t::put(const std::string & account, uint64_t height, const xsync_block_bytes_ptr_t & bytes) {
+    if (bytes == nullptr || bytes->size() > m_max_bytes / 16)
+        return;
+
+    entry_t entry;
+    entry.key = make_key(account, height);
+    entry.bytes = bytes;
+
+    std::unique_lock<std::mutex> lock(m_lock);
+    auto it = m_index.find(entry.key);
+    if (it != m_index.end()) {
+        erase_entry(it->second);
+    }
+
+    m_entries.push_front(std::move(entry));
+    m_index[m_entries.front().key] = m_entries.begin();
+    m_bytes += bytes->size();
+    while (m_bytes > m_max_bytes && !m_entries.empty()) {
+        erase_entry(std::prev(m_entries.end()));
+    }
+    XMETRICS_COUNTER_SET("xsync_block_bytes_cache_bytes", m_bytes);
+}
+
+size_t xsync_block_bytes_cache_t::size() const {
+    std::unique_lock<std::mutex> lock(m_lock);
+    return m_entries.size();
+}
+
+size_t xsync_block_bytes_cache_t::bytes() const {
+    std::unique_lock<std::mutex> lock(m_lock);
+    return m_bytes;
+}
+
+void xsync_block_bytes_cache_t::erase_entry(entry_list_t::iterator it) {
+    m_bytes -= it->bytes->size();
+    m_index.erase(it->key);
+    m_entries.erase(it);
+}
+
+xsync_block_bytes_ptr_t xsync_block_bytes_cache_t::serialize_block(const data::xblock_ptr_t & block) {
+    base::xstream_t stream(base::xcontext_t::instance());
+    data::xentire_block_ptr_t entire_block = make_object_ptr<data::xentire_block_t>();
+    entire_block->block_ptr = block;
+    entire_block->serialize_to(stream);
+    return std::make_shared<const std::string>((const char *)stream.data(), stream.size());
+}
+
+NS_END2
@@ -0,0 +1,100 @@
+// Copyright (c) 2017-2018 Telos Foundation & contributors
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "xsync/xsync_block_verifier.h"
+#include "xsync/xsync_util.h"
+#include "xmetrics/xmetrics.h"
+
+NS_BEG2(top, sync)
+
+xsync_block_verifier_t::xsync_block_verifier_t(uint32_t thread_count) {
+    for (uint32_t i = 0; i < thread_count; i++) {
+        m_threads.emplace_back(&xsync_block_verifier_t::run, this);
+    }
+}
+
+xsync_block_verifier_t::~xsync_block_verifier_t() {
+    {
+        std::unique_lock<std::mutex> lock(m_lock);
+        m_stopped = true;
+    }
+    m_cond.notify_all();
+    for (auto & t : m_threads) {
+        t.join();
+    }
+}
+
+bool xsync_block_verifier_t::verify(const observer_ptr<base::xvcertauth_t> &certauth, std::vector<data::xblock_ptr_t> &blocks, std::vector<uint8_t> &passed) {
+    passed.assign(blocks.size(), 0);
+    if (blocks.empty())
+        return true;
+
+    auto batch = std::make_shared<batch_t>();
+    batch->certauth = certauth;
+    batch->blocks = &blocks;
+    batch->passed = &passed;
+    batch->count = (uint32_t)blocks.size();
+    return verify_batch(batch);
+}
+
+bool xsync_block_verifier_t::verify_batch(const batch_ptr_t &batch) {
+    if (batch->count > 1 && !m_threads.empty()) {
+        {
+            std::unique_lock<std::mutex> lock(m_lock);
+            m_batches.push_back(batch);
+        }
+        m_cond.notify_all();
+    }
+
+    work(*batch);
+
+    {
+        std::unique_lock<std::mutex> lock(batch->lock);
+        batch->cond.wait(lock, [&batch] { return batch->done == batch->count; });
+    }
+
+    XMETRICS_COUNTER_INCREMENT("xsync_verifier_blocks", batch->count);
+    return !batch->failed;
+}
+
+void xsync_block_verifier_t::run() {
+    for (;;) {
+        batch_ptr_t batch;
+        {
+            std::unique_lock<std::mutex> lock(m_lock);
+            m_cond.wait(lock, [this] { return m_stopped || !m_batches.empty(); });
+            if (m_stopped)
+                return;
+
+            batch = m_batches.front();
+            if (batch->next >= batch->count) {
+                // all blocks taken, owners finish them
+                m_batches.pop_front();
+                continue;
+            }
+        }
+        work(*batch);
+    }
+}
+
+void xsync_block_verifier_t::work(batch_t &batch) {
+    for (;;) {
+        uint32_t i = batch.next++;
+        if (i >= batch.count)
+            return;
+
+        bool ok = check_auth(batch.certauth, (*batch.blocks)[i]);
+        (*batch.passed)[i] = ok ? 1 : 0;
+        if (!ok) {
+            batch.failed = true;
+        }
+
+        std::unique_lock<std::mutex> lock(batch.lock);
+        if (++batch.done == batch.count) {
+            batch.cond.notify_all();
+        }
+    }
+}
+
+NS_END2
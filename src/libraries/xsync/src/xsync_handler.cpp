@@ -177,18 +177,32 @@ void xsync_handler_t::get_blocks(uint32_t msg_size, const vnetwork::xvnode_addre
     xsync_info("xsync_handler receive getblocks %" PRIx64 " wait(%ldms) %s range[%lu,%lu] %s",
         msg_hash, get_time()-recv_time, owner.c_str(), start_height, start_height+count-1, from_address.to_string().c_str());
 
-    std::vector<xblock_ptr_t> vector_blocks;
+    // peers catching up ask for the same committed heights, keep them serialized
+    std::vector<xsync_block_bytes_ptr_t> vector_blocks_bytes;
     for (uint32_t height = start_height, i = 0; height < start_height + count && i < max_request_block_count; height++) {
+        xsync_block_bytes_ptr_t cached = m_block_bytes_cache.get(owner, height);
+        if (cached != nullptr) {
+            vector_blocks_bytes.push_back(cached);
+            i++;
+            continue;
+        }
+
         auto blocks = m_sync_store->load_block_objects(owner, height);
         if (blocks.empty()) {
             break;
         }
         for (uint32_t j = 0; j < blocks.size(); j++,i++){
-            vector_blocks.push_back(xblock_t::raw_vblock_to_object_ptr(blocks[j].get()));
+            xblock_ptr_t block = xblock_t::raw_vblock_to_object_ptr(blocks[j].get());
+            xsync_block_bytes_ptr_t bytes = xsync_block_bytes_cache_t::serialize_block(block);
+            // forked heights may still change, only the single committed block is stable
+            if (blocks.size() == 1 && block->check_block_flag(base::enum_xvblock_flag_committed)) {
+                m_block_bytes_cache.put(owner, height, bytes);
+            }
+            vector_blocks_bytes.push_back(bytes);
         }
     }
-    XMETRICS_GAUGE(metrics::xsync_getblocks_send_resp, vector_blocks.size());
-    m_sync_sender->send_blocks(xsync_msg_err_code_t::succ, owner, vector_blocks, network_self, from_address);
+    XMETRICS_GAUGE(metrics::xsync_getblocks_send_resp, vector_blocks_bytes.size());
+    m_sync_sender->send_blocks(xsync_msg_err_code_t::succ, owner, vector_blocks_bytes, network_self, from_address);
 }
 
 void xsync_handler_t::push_newblock(uint32_t msg_size,
@@ -1,6 +1,8 @@
 #include "xsync/xsync_util.h"
 #include "xdata/xnative_contract_address.h"
 
+#include <set>
+
 NS_BEG2(top, sync)
 
 data::xblock_ptr_t autoptr_to_blockptr(base::xauto_ptr<base::xvblock_t> &autoptr) {
@@ -47,6 +49,72 @@ bool check_auth(const observer_ptr<base::xvcertauth_t> &certauth, data::xblock_p
     return true;
 }
 
+bool check_blocks_linked(const std::vector<data::xblock_ptr_t> &blocks) {
+    if (blocks.empty())
+        return true;
+
+    uint64_t lowest_height = blocks[0]->get_height();
+    uint64_t height = lowest_height;
+    std::set<std::string> last_hashes;
+    std::set<std::string> hashes;
+    for (auto &block : blocks) {
+        if (block->get_height() != height) {
+            if (block->get_height() != height + 1)
+                return false;
+            height = block->get_height();
+            last_hashes.swap(hashes);
+            hashes.clear();
+        }
+
+        if (height != lowest_height && last_hashes.find(block->get_last_block_hash()) == last_hashes.end())
+            return false;
+        hashes.insert(block->get_block_hash());
+    }
+
+    return true;
+}
+
+std::vector<data::xblock_ptr_t> blocks_off_tail_chain(const std::vector<data::xblock_ptr_t> &blocks) {
+    std::vector<data::xblock_ptr_t> off_blocks;
+    if (blocks.empty())
+        return off_blocks;
+
+    std::string expect_hash = blocks.back()->get_block_hash();
+    for (auto it = blocks.rbegin(); it != blocks.rend(); ++it) {
+        if ((*it)->get_block_hash() == expect_hash) {
+            expect_hash = (*it)->get_last_block_hash();
+        } else {
+            off_blocks.push_back(*it);
+        }
+    }
+
+    return off_blocks;
+}
+
+static bool is_same_signing_group(const xvip2_t &left, const xvip2_t &right) {
+    return get_zone_id_from_xip2(left) == get_zone_id_from_xip2(right) &&
+        get_cluster_id_from_xip2(left) == get_cluster_id_from_xip2(right) &&
+        get_group_id_from_xip2(left) == get_group_id_from_xip2(right) &&
+        get_network_height_from_xip2(left) == get_network_height_from_xip2(right);
+}
+
+size_t blocks_before_elect_boundary(const std::vector<data::xblock_ptr_t> &blocks) {
+    if (blocks.empty())
+        return 0;
+
+    const xvip2_t &validator = blocks[0]->get_cert()->get_validator();
+    const xvip2_t &auditor = blocks[0]->get_cert()->get_auditor();
+    size_t count = 1;
+    for (; count < blocks.size(); count++) {
+        if (!is_same_signing_group(blocks[count]->get_cert()->get_validator(), validator) ||
+            !is_same_signing_group(blocks[count]->get_cert()->get_auditor(), auditor)) {
+            break;
+        }
+    }
+
+    return count;
+}
+
 uint32_t vrf_value(const std::string& hash) {
 
     uint32_t value = 0;
@@ -13,6 +13,7 @@
 #include "xsync/xsync_ratelimit.h"
 #include "xsync/xrequest.h"
 #include "xsync/xsync_task.h"
+#include "xsync/xsync_block_verifier.h"
 
 NS_BEG2(top, sync)
 
@@ -104,7 +105,7 @@ public:
         xsync_store_face_t *sync_store, const observer_ptr<mbus::xmessage_bus_face_t> &mbus,
         const observer_ptr<base::xvcertauth_t> &certauth,
         xsync_sender_t *sync_sender, xsync_ratelimit_face_t *ratelimit,
-        const std::string &address);
+        const std::string &address, xsync_block_verifier_t *block_verifier = nullptr);
 
     virtual ~xchain_downloader_t();
 
@@ -123,7 +124,8 @@ public:
     xsync_command_execute_result execute_next_download(uint64_t height);
     xsync_command_execute_result execute_download(uint64_t start_height, uint64_t end_height, enum_chain_sync_policy sync_policy, const vnetwork::xvnode_address_t &self_addr, const vnetwork::xvnode_address_t &target_addr, const std::string &reason);
 protected:
-    enum_result_code handle_block(xblock_ptr_t &block, bool is_elect_chain, uint64_t quota_height);
+    enum_result_code handle_block(xblock_ptr_t &block, bool need_auth, uint64_t quota_height);
+    void verify_blocks(std::vector<data::xblock_ptr_t> &blocks, std::vector<uint8_t> &passed);
     enum_result_code pre_handle_block(std::vector<data::xblock_ptr_t> &blocks, bool is_elect_chain, uint64_t quota_height, std::vector<base::xvblock_t*> &processed_blocks);
 
     xsync_command_execute_result handle_next(uint64_t current_height);
@@ -151,6 +153,7 @@ protected:
     observer_ptr<base::xvcertauth_t> m_certauth;
     xsync_sender_t *m_sync_sender;
     xsync_ratelimit_face_t *m_ratelimit;
+    xsync_block_verifier_t *m_block_verifier;
     std::string m_address{};
     xsync_range_mgr_t m_sync_range_mgr;
     xentire_block_request_ptr_t m_request{nullptr};
@@ -71,7 +71,8 @@ public:
                 const observer_ptr<mbus::xmessage_bus_face_t> &mbus,
                 const observer_ptr<base::xvcertauth_t> &certauth,
                 xrole_chains_mgr_t *role_chains_mgr, xsync_sender_t *sync_sender,
-                const std::vector<observer_ptr<base::xiothread_t>> &thread_pool, xsync_ratelimit_face_t *ratelimit, xsync_store_shadow_t * shadow);
+                const std::vector<observer_ptr<base::xiothread_t>> &thread_pool, xsync_ratelimit_face_t *ratelimit, xsync_store_shadow_t * shadow,
+                xsync_block_verifier_t *block_verifier = nullptr);
 
     virtual ~xdownloader_t();
     void push_event(const mbus::xevent_ptr_t &e) override;
@@ -99,6 +100,7 @@ protected:
     xrole_chains_mgr_t *m_role_chains_mgr;
     xsync_sender_t *m_sync_sender{};
     xsync_ratelimit_face_t *m_ratelimit;
+    xsync_block_verifier_t *m_block_verifier;
 
     std::vector<xaccount_timer_t*> m_timer_list;
     std::vector<std::shared_ptr<mbus::xmessage_bus_t>> m_mbus_list;
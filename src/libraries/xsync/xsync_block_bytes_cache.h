@@ -0,0 +1,53 @@
+// Copyright (c) 2017-2018 Telos Foundation & contributors
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#pragma once
+
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include "xdata/xblock.h"
+#include "xsync/xsync_message.h"
+
+NS_BEG2(top, sync)
+
+// serving get_blocks keeps recent heights hot while many peers catch up
+const size_t sync_block_bytes_cache_max_bytes = 128 * 1024 * 1024;
+
+// LRU of committed blocks serialized as sync wire format, bounded by bytes.
+// committed block at a height never changes, so key is (account, height).
+class xsync_block_bytes_cache_t {
+public:
+    explicit xsync_block_bytes_cache_t(size_t max_bytes);
+    xsync_block_bytes_cache_t(const xsync_block_bytes_cache_t &) = delete;
+    xsync_block_bytes_cache_t & operator=(const xsync_block_bytes_cache_t &) = delete;
+
+    xsync_block_bytes_ptr_t get(const std::string & account, uint64_t height);
+    void put(const std::string & account, uint64_t height, const xsync_block_bytes_ptr_t & bytes);
+
+    size_t size() const;
+    size_t bytes() const;
+
+    // same bytes as a block written by xsync_message_blocks_t
+    static xsync_block_bytes_ptr_t serialize_block(const data::xblock_ptr_t & block);
+
+private:
+    struct entry_t {
+        std::string key;
+        xsync_block_bytes_ptr_t bytes;
+    };
+    using entry_list_t = std::list<entry_t>;
+
+    static std::string make_key(const std::string & account, uint64_t height);
+    void erase_entry(entry_list_t::iterator it);
+
+    mutable std::mutex m_lock;
+    entry_list_t m_entries;  // most recently used at front
+    std::unordered_map<std::string, entry_list_t::iterator> m_index;
+    size_t m_bytes{0};
+    size_t m_max_bytes;
+};
+
+NS_END2
@@ -0,0 +1,62 @@
+// Copyright (c) 2017-2018 Telos Foundation & contributors
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "xbasic/xmemory.hpp"
+#include "xdata/xblock.h"
+#include "xvledger/xvcnode.h"
+
+NS_BEG2(top, sync)
+
+// verifies multi-sign of downloaded blocks on a pool of threads shared by all chain downloaders.
+// the calling thread verifies too, so a batch never waits for a busy pool to pick it up.
+class xsync_block_verifier_t {
+public:
+    explicit xsync_block_verifier_t(uint32_t thread_count);
+    ~xsync_block_verifier_t();
+    xsync_block_verifier_t(const xsync_block_verifier_t &) = delete;
+    xsync_block_verifier_t & operator=(const xsync_block_verifier_t &) = delete;
+
+    // check_auth every block even if some fail, returns after all of them are done.
+    // passed[i] tells if blocks[i] is ok, false if any block fails.
+    bool verify(const observer_ptr<base::xvcertauth_t> &certauth, std::vector<data::xblock_ptr_t> &blocks, std::vector<uint8_t> &passed);
+
+    uint32_t thread_count() const {
+        return (uint32_t)m_threads.size();
+    }
+
+private:
+    struct batch_t {
+        observer_ptr<base::xvcertauth_t> certauth;
+        std::vector<data::xblock_ptr_t> *blocks{nullptr};
+        std::vector<uint8_t> *passed{nullptr};
+        uint32_t count{0};
+        std::atomic<uint32_t> next{0};
+        std::atomic<bool> failed{false};
+        std::mutex lock;
+        std::condition_variable cond;
+        uint32_t done{0};
+    };
+    using batch_ptr_t = std::shared_ptr<batch_t>;
+
+    bool verify_batch(const batch_ptr_t &batch);
+    void run();
+    static void work(batch_t &batch);
+
+    std::mutex m_lock;
+    std::condition_variable m_cond;
+    std::deque<batch_ptr_t> m_batches;
+    std::vector<std::thread> m_threads;
+    bool m_stopped{false};
+};
+
+NS_END2
@@ -31,6 +31,7 @@
 #include "xsync/xsync_cross_cluster_chain_state.h"
 #include "xsync/xsync_pusher.h"
 #include "xsync/xdeceit_node_manager.h"
+#include "xsync/xsync_block_bytes_cache.h"
 
 NS_BEG2(top, sync)
 
@@ -254,6 +255,7 @@ private:
     xsync_behind_checker_t *m_behind_checker;
     xsync_cross_cluster_chain_state_t *m_cross_cluster_chain_state;
     std::unordered_map<xmessage_t::message_type, xsync_handler_netmsg_callback> m_handlers;
+    xsync_block_bytes_cache_t m_block_bytes_cache{sync_block_bytes_cache_max_bytes};
 };
 
 using xsync_handler_ptr_t = std::shared_ptr<xsync_handler_t>;
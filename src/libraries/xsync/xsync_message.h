@@ -5,6 +5,7 @@
 #pragma once
 
 #include <time.h>
+#include <memory>
 #include <string>
 #include <vector>
 #include "xdata/xdata_common.h"
@@ -21,6 +22,9 @@
 
 NS_BEG2(top, sync)
 
+// one block serialized as xentire_block_t
+using xsync_block_bytes_ptr_t = std::shared_ptr<const std::string>;
+
 enum class xsync_msg_err_code_t : uint8_t {
     succ = 0,
     limit = 1,
@@ -128,11 +132,26 @@ public:
     blocks(_blocks) {
     }
 
+    // blocks already serialized, written as is
+    xsync_message_blocks_t(
+            const std::string& _owner,
+            const std::vector<xsync_block_bytes_ptr_t> &_blocks_bytes) :
+    owner(_owner),
+    blocks_bytes(_blocks_bytes) {
+    }
+
 protected:
     int32_t do_write(base::xstream_t & stream) override {
         KEEP_SIZE();
         SERIALIZE_FIELD_BT(owner);
 
+        if (!blocks_bytes.empty()) {
+            SERIALIZE_CONTAINER(blocks_bytes) {
+                stream.push_back((uint8_t*)item->data(), (int32_t)item->size());
+            }
+            return CALC_LEN();
+        }
+
         std::vector<data::xentire_block_ptr_t> vector_entire_block;
         for (auto &it: blocks) {
             data::xentire_block_ptr_t entire_block = make_object_ptr<data::xentire_block_t>();
@@ -187,6 +206,8 @@ public:
     // compatibility!!!
     std::string owner;
     std::vector<data::xblock_ptr_t> blocks;
+    // only for write
+    std::vector<xsync_block_bytes_ptr_t> blocks_bytes;
 };
 
 struct xsync_message_push_newblock_t : public top::basic::xserialize_face_t {
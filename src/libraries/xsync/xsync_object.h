@@ -49,6 +49,7 @@ private:
     std::unique_ptr<sync::xrole_xips_manager_t> m_role_xips_mgr{};
     std::unique_ptr<sync::xsync_sender_t> m_sync_sender{};
     std::unique_ptr<sync::xsync_ratelimit_face_t> m_sync_ratelimit{};
+    std::unique_ptr<sync::xsync_block_verifier_t> m_block_verifier{};
     std::unique_ptr<sync::xsync_peerset_t> m_peerset{};
     std::unique_ptr<sync::xsync_pusher_t> m_sync_pusher{};
     std::unique_ptr<sync::xsync_broadcast_t> m_sync_broadcast{};
@@ -11,6 +11,13 @@ NS_BEG2(top, sync)
 data::xblock_ptr_t autoptr_to_blockptr(base::xauto_ptr<base::xvblock_t> &autoptr);
 bool is_beacon_table(const std::string &address);
 bool check_auth(const observer_ptr<base::xvcertauth_t> &certauth, data::xblock_ptr_t &block);
+// blocks sorted by height, each block above the lowest height links to a block of the height before it
+bool check_blocks_linked(const std::vector<data::xblock_ptr_t> &blocks);
+// blocks the last one does not link back to by hash, they are not covered by its multi-sign
+std::vector<data::xblock_ptr_t> blocks_off_tail_chain(const std::vector<data::xblock_ptr_t> &blocks);
+// count of leading blocks signed by the same validator and auditor groups as the first one,
+// later blocks may be signed by a group elected by a block before them
+size_t blocks_before_elect_boundary(const std::vector<data::xblock_ptr_t> &blocks);
 uint32_t vrf_value(const std::string& hash);
 // vnetwork::xvnode_address_t build_address_from_vnode(const xvip2_t &group_xip2, const std::vector<base::xvnode_t*> &nodes, int32_t slot_id);
 uint64_t derministic_height(uint64_t my_height, std::pair<uint64_t, uint64_t> neighbor_heights);
@@ -1253,77 +1253,113 @@ namespace top
             if( (NULL == replica_cert) || (NULL == local_proposal) )
                 return false;
 
-            replica_cert->add_ref();
-            auto _verify_function = [this,replica_xip,replica_cert](base::xcall_t & call, const int32_t cur_thread_id,const uint64_t timenow_ms)->bool{
-                base::xauto_ptr<base::xvqcert_t> _dummy_release(replica_cert);//auto release the added addtional once quit
-                if(is_close() == false)//running at a specific worker thread of pool
+            replica_cert->add_ref();//released by verify job
+            //votes arrive in a burst right after proposal,so queue them at proposal and let one job verify all queued votes together
+            if(false == local_proposal->push_pending_vote(replica_xip,replica_cert))
+                return true; //a job is already scheduled and not start yet,it take this vote as well
+
+            auto _verify_function = [this](base::xcall_t & call, const int32_t cur_thread_id,const uint64_t timenow_ms)->bool{
+                xproposal_t * _proposal = (xproposal_t *)call.get_param1().get_object();
+                xproposal_t::pending_votes_t _votes;
+                _proposal->pop_pending_votes(_votes);
+                if(_votes.empty())
+                    return true;
+
+                if( (is_close() == false) && (false == _proposal->is_vote_finish()) )//running at a specific worker thread of pool
                 {
-                    xproposal_t * _proposal = (xproposal_t *)call.get_param1().get_object();
                     if(_proposal->is_vote_disable()) //quick path to exit while proposal has been disabled
                     {
-                        xwarn("xBFTdriver_t::fire_verify_vote_job,had disabled proposal=%s,at node=0x%llx",_proposal->dump().c_str(),replica_xip.low_addr);
-                        return true;
+                        xwarn("xBFTdriver_t::fire_verify_vote_job,had disabled proposal=%s,at node=0x%llx",_proposal->dump().c_str(),get_xip2_low_addr());
                     }
-
-                    if(false == _proposal->is_vote_finish()) //check first as async case,it might be finished already
+                    else
                     {
-                        XMETRICS_GAUGE(metrics::cpu_ca_verify_sign_xbft, 1);
-                        if(get_vcertauth()->verify_sign(replica_xip, replica_cert,_proposal->get_account()) == base::enum_vcert_auth_result::enum_successful) //verify partial-certication of msg
+                        std::vector<xvip2_t> _signers;
+                        std::vector<base::xvqcert_t*> _certs;
+                        _signers.reserve(_votes.size());
+                        _certs.reserve(_votes.size());
+                        for(auto & vote : _votes)
                         {
-                            if(_proposal->add_voted_cert(replica_xip,replica_cert,get_vcertauth())) //add to local list
+                            _signers.push_back(vote.first);
+                            _certs.push_back(vote.second);
+                        }
+                        std::vector<base::enum_vcert_auth_result> _results;
+                        XMETRICS_GAUGE(metrics::cpu_ca_verify_sign_xbft, (int64_t)_votes.size());
+                        get_vcertauth()->verify_sign_batch(_signers,_certs,_proposal->get_account(),_results); //verify partial-certication of msgs
+
+                        for(size_t i = 0; i < _votes.size(); ++i)
+                        {
+                            if(_proposal->is_vote_finish()) //rest of votes are not needed anymore
+                                break;
+
+                            const xvip2_t & replica_xip = _votes[i].first;
+                            base::xvqcert_t * replica_cert = _votes[i].second;
+                            if(_results[i] != base::enum_vcert_auth_result::enum_successful)
+                            {
+                                xerror("xBFTdriver_t::fire_verify_vote_job,fail-verify_sign for replica_cert=%s,at node=0x%llx",replica_cert->dump().c_str(),get_xip2_low_addr());
+                                continue;
+                            }
+                            if(false == _proposal->add_voted_cert(replica_xip,replica_cert,get_vcertauth())) //add to local list
+                            {
+                                XMETRICS_GAUGE(metrics::bft_verify_vote_msg_fail, 1);
+                                continue;
+                            }
+                            if(_proposal->is_vote_finish()) //check again
                             {
-                                if(_proposal->is_vote_finish()) //check again
+                                if(false == _proposal->get_voted_validators().empty())
                                 {
-                                    if(false == _proposal->get_voted_validators().empty())
-                                    {
-                                        XMETRICS_GAUGE(metrics::cpu_ca_merge_sign_xbft, 1);
-                                        const std::string merged_sign_for_validators = get_vcertauth()->merge_muti_sign(_proposal->get_voted_validators(), _proposal->get_block());
-                                        _proposal->get_block()->set_verify_signature(merged_sign_for_validators);
-                                    }
-                                    if(false == _proposal->get_voted_auditors().empty())
-                                    {
-                                        XMETRICS_GAUGE(metrics::cpu_ca_merge_sign_xbft, 1);
-                                        const std::string merged_sign_for_auditors = get_vcertauth()->merge_muti_sign(_proposal->get_voted_auditors(), _proposal->get_block());
-                                        _proposal->get_block()->set_audit_signature(merged_sign_for_auditors);
-                                    }
-                                    XMETRICS_GAUGE(metrics::cpu_ca_verify_multi_sign_xbft, 1);
-                                    if(get_vcertauth()->verify_muti_sign(_proposal->get_block()) == base::enum_vcert_auth_result::enum_successful) //quorum certification and  check if majority voted
+                                    XMETRICS_GAUGE(metrics::cpu_ca_merge_sign_xbft, 1);
+                                    const std::string merged_sign_for_validators = get_vcertauth()->merge_muti_sign(_proposal->get_voted_validators(), _proposal->get_block());
+                                    _proposal->get_block()->set_verify_signature(merged_sign_for_validators);
+                                }
+                                if(false == _proposal->get_voted_auditors().empty())
+                                {
+                                    XMETRICS_GAUGE(metrics::cpu_ca_merge_sign_xbft, 1);
+                                    const std::string merged_sign_for_auditors = get_vcertauth()->merge_muti_sign(_proposal->get_voted_auditors(), _proposal->get_block());
+                                    _proposal->get_block()->set_audit_signature(merged_sign_for_auditors);
+                                }
+                                XMETRICS_GAUGE(metrics::cpu_ca_verify_multi_sign_xbft, 1);
+                                if(get_vcertauth()->verify_muti_sign(_proposal->get_block()) == base::enum_vcert_auth_result::enum_successful) //quorum certification and  check if majority voted
+                                {
+                                    _proposal->get_cert()->set_unit_flag(base::enum_xvblock_flag_authenticated);
+                                    _proposal->get_block()->set_block_flag(base::enum_xvblock_flag_authenticated);
+                                    //--------------after below line, block not allow do any change  anymore------------
+                                    xinfo("xBFTdriver_t::fire_verify_vote_job,successful collect enough vote and verified for _proposal=%s,at node=0x%llx",_proposal->dump().c_str(),get_xip2_low_addr());
+
+                                    base::xfunction_t* _callback_ = (base::xfunction_t *)call.get_param2().get_function();
+                                    if(_callback_ != NULL)
                                     {
-                                        _proposal->get_cert()->set_unit_flag(base::enum_xvblock_flag_authenticated);
-                                        _proposal->get_block()->set_block_flag(base::enum_xvblock_flag_authenticated);
-                                        //--------------after below line, block not allow do any change  anymore------------
-                                        xinfo("xBFTdriver_t::fire_verify_vote_job,successful collect enough vote and verified for _proposal=%s,at node=0x%llx",_proposal->dump().c_str(),get_xip2_low_addr());
-
-                                        base::xfunction_t* _callback_ = (base::xfunction_t *)call.get_param2().get_function();
-                                        if(_callback_ != NULL)
-                                        {
-                                            _proposal->add_ref(); //hold for async call
-                                            dispatch_call(*_callback_,(void*)_proposal);//send callback to engine'own thread
-                                        }
+                                        _proposal->add_ref(); //hold for async call
+                                        dispatch_call(*_callback_,(void*)_proposal);//send callback to engine'own thread
                                     }
-                                    else
-                                        xerror("xBFTdriver_t::fire_verify_vote_job,fail-verify_muti_sign for _proposal=%s,at node=0x%llx",_proposal->dump().c_str(),get_xip2_low_addr());
                                 }
-                            }
-                            else
-                            {
-                                XMETRICS_GAUGE(metrics::bft_verify_vote_msg_fail, 1);
+                                else
+                                    xerror("xBFTdriver_t::fire_verify_vote_job,fail-verify_muti_sign for _proposal=%s,at node=0x%llx",_proposal->dump().c_str(),get_xip2_low_addr());
                             }
                         }
-                        else
-                            xerror("xBFTdriver_t::fire_verify_vote_job,fail-verify_sign for replica_cert=%s,at node=0x%llx",replica_cert->dump().c_str(),get_xip2_low_addr());
                     }
                 }
+                for(auto & vote : _votes)
+                    vote.second->release_ref();
                 return true;
             };
 
             base::xcall_t asyn_verify_call(_verify_function,(base::xobject_t*)local_proposal,&callback,(base::xobject_t*)this);
             asyn_verify_call.bind_taskid(get_account_index());
             base::xworkerpool_t * _workers_pool = get_workerpool();
+            bool fired = false;
             if(_workers_pool != NULL)
-                return (_workers_pool->send_call(asyn_verify_call) == enum_xcode_successful);
+                fired = (_workers_pool->send_call(asyn_verify_call) == enum_xcode_successful);
             else
-                return (dispatch_call(asyn_verify_call) == enum_xcode_successful);
+                fired = (dispatch_call(asyn_verify_call) == enum_xcode_successful);
+
+            if(false == fired) //drop queued votes,otherwise later votes never fire job again
+            {
+                xproposal_t::pending_votes_t _votes;
+                local_proposal->pop_pending_votes(_votes);
+                for(auto & vote : _votes)
+                    vote.second->release_ref();
+            }
+            return fired;
         }
 
         bool xBFTdriver_t::fire_verify_proposal_job(const xvip2_t leader_xip,const xvip2_t replica_xip,xproposal_t * target_proposal,base::xfunction_t &callback)
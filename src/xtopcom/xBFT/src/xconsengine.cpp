@@ -219,9 +219,26 @@ namespace top
             if(m_proposal_cert != NULL)
                 m_proposal_cert->release_ref();
             
+            for(auto & it : m_pending_votes)
+                it.second->release_ref();
+            
             //xdbg("xproposal_t::destroy,dump=%s",dump().c_str());
         }
     
+        bool  xproposal_t::push_pending_vote(const xvip2_t & voter_xip,base::xvqcert_t * qcert_ptr)
+        {
+            std::lock_guard<std::mutex> _locker(m_pending_votes_lock);
+            m_pending_votes.emplace_back(voter_xip,qcert_ptr);
+            return (m_pending_votes.size() == 1);
+        }
+    
+        void  xproposal_t::pop_pending_votes(pending_votes_t & out_votes)
+        {
+            std::lock_guard<std::mutex> _locker(m_pending_votes_lock);
+            out_votes.swap(m_pending_votes);
+            m_pending_votes.clear();
+        }
+    
         bool  xproposal_t::set_highest_QC_viewid(const uint64_t new_viewid)
         {
             if(new_viewid > m_highest_QC_viewid)
@@ -4,6 +4,8 @@
 
 #pragma once
 #include <map>
+#include <mutex>
+#include <vector>
 #include "xconsobj.h"
 
 namespace top
@@ -139,6 +141,12 @@ namespace top
             
             void                  set_proposal_cert(base::xvqcert_t* new_proposal_cert);
             void                  set_bind_clock_cert(base::xvqcert_t* clock_cert);
+        public: //votes are queued here until verify job take them together,it may be called from any thread
+            typedef std::vector<std::pair<xvip2_t,base::xvqcert_t*> > pending_votes_t;
+            //take over one reference of qcert_ptr,return true if queue was empty so caller need fire a job to drain queue
+            bool                  push_pending_vote(const xvip2_t & voter_xip,base::xvqcert_t * qcert_ptr);
+            //move out all queued votes,caller take over reference of each qcert
+            void                  pop_pending_votes(pending_votes_t & out_votes);
         public: //below apis are called from engine'own thread
             bool                 is_leader() const {return m_is_leader;}
             bool                 is_voted()  const {return m_is_voted;}
@@ -173,6 +181,9 @@ namespace top
             std::set<std::string>          m_all_voted_cert;//to remove duplicated certificates,possible attack or duplicated
             std::map<xvip2_t,std::string,xvip2_compare> m_voted_validators;          //include leader as well
             std::map<xvip2_t,std::string,xvip2_compare> m_voted_auditors;            //include leader as well if need
+        private:
+            std::mutex                     m_pending_votes_lock;
+            pending_votes_t                m_pending_votes;             //received votes that not verified yet
         private:
             base::xvqcert_t *              m_proposal_cert;             //dedicated cert to store signature of leader
             base::xvqcert_t *              m_bind_clock_cert;           //each proposal ask carry the related clock cert
@@ -7,6 +7,7 @@
 #include "xblockmaker/xblockmaker_error.h"
 #include "xblockmaker/xtable_maker.h"
 #include "xblockmaker/xtable_builder.h"
+#include "xblockmaker/xunit_build_pool.h"
 #include "xdata/xblocktool.h"
 #include "xconfig/xpredefined_configurations.h"
 #include "xconfig/xconfig_register.h"
@@ -356,12 +357,26 @@ xblock_ptr_t xtable_maker_t::make_light_table(bool is_leader, const xtablemaker_
 
     int64_t tgas_balance_change = 0;
     std::vector<xblock_ptr_t> batch_units;
-    // try to make unit for unitmakers
+    // try to make unit for unitmakers.units of different accounts are independent except receipt ids,
+    // so execute them in parallel firstly, then finish them one by one at map order to keep proposal deterministic
+    std::vector<xunit_maker_ptr_t> unitmaker_list;
+    unitmaker_list.reserve(unitmakers.size());
     for (auto & v : unitmakers) {
-        xunit_maker_ptr_t & unitmaker = v.second;
-        xunitmaker_result_t unit_result;
-        xunitmaker_para_t unit_para(table_para.get_tablestate(), is_leader);
-        xblock_ptr_t proposal_unit = unitmaker->make_proposal(unit_para, cs_para, unit_result);
+        unitmaker_list.push_back(v.second);
+    }
+    xunitmaker_para_t unit_para(table_para.get_tablestate(), is_leader);
+    std::vector<xunitmaker_result_t> unit_results(unitmaker_list.size());
+    std::vector<data::xblock_consensus_para_t> unit_cs_paras(unitmaker_list.size(), cs_para);  // unit changes justify hash and parent height of its own
+    {
+        XMETRICS_TIMER(metrics::cons_tablemaker_parallel_make_unit_tick);
+        xunit_build_pool_t::instance().parallel_for(unitmaker_list.size(), [&](size_t index) {
+            unitmaker_list[index]->prepare_proposal(unit_para, unit_cs_paras[index], unit_results[index]);
+        });
+    }
+    for (size_t index = 0; index < unitmaker_list.size(); index++) {
+        xunit_maker_ptr_t & unitmaker = unitmaker_list[index];
+        xunitmaker_result_t & unit_result = unit_results[index];
+        xblock_ptr_t proposal_unit = unitmaker->finish_proposal(unit_para, unit_cs_paras[index], unit_result);
         table_result.add_unit_result(unit_result);
         tgas_balance_change += unit_result.m_tgas_balance_change;
         xdbg("total_tgas_balance_change=%lld, change=%lld", tgas_balance_change, unit_result.m_tgas_balance_change);
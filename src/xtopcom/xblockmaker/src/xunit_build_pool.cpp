@@ -0,0 +1,102 @@
+// Copyright (c) 2017-2018 Telos Foundation & contributors
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include "xblockmaker/xunit_build_pool.h"
+
+NS_BEG2(top, blockmaker)
+
+// at most half of cpus, the other half keep for consensus, txpool and network threads
+#define unit_build_pool_threads_max (8)
+
+xunit_build_pool_t & xunit_build_pool_t::instance() {
+    static xunit_build_pool_t * _pool = new xunit_build_pool_t(std::min<size_t>(unit_build_pool_threads_max, std::max<size_t>(1, std::thread::hardware_concurrency() / 2)));
+    return *_pool;
+}
+
+xunit_build_pool_t::xunit_build_pool_t(size_t threads_count) {
+    for (size_t i = 0; i < threads_count; i++) {
+        m_threads.emplace_back(&xunit_build_pool_t::worker_loop, this);
+        m_threads.back().detach();
+    }
+}
+
+void xunit_build_pool_t::worker_loop() {
+    for (;;) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lck(m_lock);
+            m_cond.wait(lck, [this] { return !m_tasks.empty(); });
+            task = std::move(m_tasks.front());
+            m_tasks.pop_front();
+        }
+        task();
+    }
+}
+
+void xunit_build_pool_t::parallel_for(size_t count, const std::function<void(size_t)> & job) {
+    if (count <= 1 || m_threads.empty() || !m_enabled) {
+        for (size_t i = 0; i < count; i++) {
+            job(i);
+        }
+        return;
+    }
+
+    // jobs are claimed by index, helpers started after all claimed just return.
+    // state is shared since a helper may start after this function returned
+    struct xjob_state_t {
+        std::function<void(size_t)> job;
+        size_t                      count;
+        std::atomic<size_t>         next_index{0};
+        std::atomic<size_t>         finished_count{0};
+        std::mutex                  lock;
+        std::condition_variable     cond;
+        std::exception_ptr          error;  // first exception thrown by jobs, protected by lock
+    };
+    auto state = std::make_shared<xjob_state_t>();
+    state->job = job;
+    state->count = count;
+    auto run_jobs = [state]() {
+        for (;;) {
+            size_t index = state->next_index.fetch_add(1);
+            if (index >= state->count) {
+                return;
+            }
+            // a throwing job must still be counted as finished, otherwise caller waits forever
+            try {
+                state->job(index);
+            } catch (...) {
+                std::lock_guard<std::mutex> lck(state->lock);
+                if (state->error == nullptr) {
+                    state->error = std::current_exception();
+                }
+            }
+            if (state->finished_count.fetch_add(1) + 1 == state->count) {
+                std::lock_guard<std::mutex> lck(state->lock);
+                state->cond.notify_all();
+            }
+        }
+    };
+
+    size_t helpers_count = std::min(count - 1, m_threads.size());
+    {
+        std::lock_guard<std::mutex> lck(m_lock);
+        for (size_t i = 0; i < helpers_count; i++) {
+            m_tasks.push_back(run_jobs);
+        }
+    }
+    m_cond.notify_all();
+
+    run_jobs();
+    std::unique_lock<std::mutex> lck(state->lock);
+    state->cond.wait(lck, [&state] { return state->finished_count.load() == state->count; });
+    if (state->error != nullptr) {
+        std::rethrow_exception(state->error);
+    }
+}
+
+NS_END2
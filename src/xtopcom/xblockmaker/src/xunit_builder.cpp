@@ -44,6 +44,17 @@ xblock_ptr_t        xlightunit_builder_t::build_block(const xblock_ptr_t & prev_
                                                     const data::xblock_consensus_para_t & cs_para,
                                                     xblock_builder_para_ptr_t & build_para) {
     XMETRICS_TIMER(metrics::cons_unitbuilder_lightunit_tick);
+    if (false == execute_txs(prev_block, prev_bstate, cs_para, build_para)) {
+        return nullptr;
+    }
+    std::shared_ptr<xlightunit_builder_para_t> lightunit_build_para = std::dynamic_pointer_cast<xlightunit_builder_para_t>(build_para);
+    return create_block(prev_block, cs_para, lightunit_build_para->get_lightunit_para(), lightunit_build_para->get_receiptid_state());
+}
+
+bool                xlightunit_builder_t::execute_txs(const xblock_ptr_t & prev_block,
+                                                    const xobject_ptr_t<base::xvbstate_t> & prev_bstate,
+                                                    const data::xblock_consensus_para_t & cs_para,
+                                                    xblock_builder_para_ptr_t & build_para) {
     const std::string & account = prev_block->get_account();
     std::shared_ptr<xlightunit_builder_para_t> lightunit_build_para = std::dynamic_pointer_cast<xlightunit_builder_para_t>(build_para);
     xassert(lightunit_build_para != nullptr);
@@ -61,7 +72,7 @@ xblock_ptr_t        xlightunit_builder_t::build_block(const xblock_ptr_t & prev_
     }
     if (exec_ret != xsuccess) {
         build_para->set_error_code(xblockmaker_error_tx_execute);
-        return nullptr;
+        return false;
     }
 
     lightunit_build_para->set_tgas_balance_change(exec_result.m_tgas_balance_change);
@@ -73,7 +84,8 @@ xblock_ptr_t        xlightunit_builder_t::build_block(const xblock_ptr_t & prev_
     lightunit_para.set_account_unconfirm_sendtx_num(exec_result.m_unconfirm_tx_num);
     lightunit_para.set_fullstate_bin(exec_result.m_full_state);
     lightunit_para.set_binlog(exec_result.m_property_binlog);
-    return create_block(prev_block, cs_para, lightunit_para, lightunit_build_para->get_receiptid_state());
+    lightunit_build_para->set_lightunit_para(lightunit_para);
+    return true;
 }
 
 std::string     xfullunit_builder_t::make_binlog(const base::xauto_ptr<base::xvheader_t> & _temp_header,
@@ -261,8 +261,32 @@ void xunit_maker_t::clear_tx() {
 }
 
 xblock_ptr_t xunit_maker_t::make_proposal(const xunitmaker_para_t & unit_para, const data::xblock_consensus_para_t & cs_para, xunitmaker_result_t & result) {
+    prepare_proposal(unit_para, cs_para, result);
+    return finish_proposal(unit_para, cs_para, result);
+}
+
+void xunit_maker_t::prepare_proposal(const xunitmaker_para_t & unit_para, const data::xblock_consensus_para_t & cs_para, xunitmaker_result_t & result) {
     XMETRICS_TIMER(metrics::cons_make_unit_tick);
-    xblock_ptr_t proposal_block = make_next_block(unit_para, cs_para, result);
+    m_prepared_lightunit_para = nullptr;
+    make_next_block(unit_para, cs_para, result);
+}
+
+xblock_ptr_t xunit_maker_t::finish_proposal(const xunitmaker_para_t & unit_para, const data::xblock_consensus_para_t & cs_para, xunitmaker_result_t & result) {
+    if (m_prepared_lightunit_para != nullptr) {
+        result.m_block = m_lightunit_builder->create_block(get_highest_height_block(),
+                                                           cs_para,
+                                                           m_prepared_lightunit_para->get_lightunit_para(),
+                                                           m_prepared_lightunit_para->get_receiptid_state());
+        m_prepared_lightunit_para = nullptr;
+    }
+    for (auto & tx : result.m_fail_txs) {
+        xassert(tx->is_self_tx() || tx->is_send_tx());
+        xwarn("xunit_maker_t::make_next_block fail-pop send tx. account=%s,tx=%s", get_account().c_str(), tx->dump().c_str());
+        xtxpool_v2::tx_info_t txinfo(get_account(), tx->get_tx_hash_256(), tx->get_tx_subtype());
+        get_txpool()->pop_tx(txinfo);
+    }
+
+    xblock_ptr_t proposal_block = result.m_block;
     clear_tx();
     if (proposal_block == nullptr) {
         xassert(result.m_make_block_error_code != xsuccess);
@@ -330,21 +354,20 @@ xblock_ptr_t xunit_maker_t::make_next_block(const xunitmaker_para_t & unit_para,
         XMETRICS_GAUGE(metrics::cons_table_total_process_unit_count, 1);
         XMETRICS_GAUGE(metrics::cons_table_total_process_tx_count, m_pending_txs.size());        
         base::xreceiptid_state_ptr_t receiptid_state = unit_para.m_tablestate->get_receiptid_state();
-        xblock_builder_para_ptr_t build_para = std::make_shared<xlightunit_builder_para_t>(m_pending_txs, receiptid_state, get_resources());
-        proposal_unit = m_lightunit_builder->build_block(cert_block,
+        std::shared_ptr<xlightunit_builder_para_t> lightunit_build_para = std::make_shared<xlightunit_builder_para_t>(m_pending_txs, receiptid_state, get_resources());
+        xblock_builder_para_ptr_t build_para = lightunit_build_para;
+        bool exec_succ = m_lightunit_builder->execute_txs(cert_block,
                                                         get_latest_bstate()->get_bstate(),
                                                         cs_para,
                                                         build_para);
         result.m_make_block_error_code = build_para->get_error_code();
-        std::shared_ptr<xlightunit_builder_para_t> lightunit_build_para = std::dynamic_pointer_cast<xlightunit_builder_para_t>(build_para);
         result.add_pack_txs(lightunit_build_para->get_pack_txs());
         result.m_fail_txs = lightunit_build_para->get_fail_txs();
         result.m_tgas_balance_change = lightunit_build_para->get_tgas_balance_change();
-        for (auto & tx : lightunit_build_para->get_fail_txs()) {
-            xassert(tx->is_self_tx() || tx->is_send_tx());
-            xwarn("xunit_maker_t::make_next_block fail-pop send tx. account=%s,tx=%s", get_account().c_str(), tx->dump().c_str());
-            xtxpool_v2::tx_info_t txinfo(get_account(), tx->get_tx_hash_256(), tx->get_tx_subtype());
-            get_txpool()->pop_tx(txinfo);
+        if (exec_succ) {
+            // light-unit is created at finish_proposal after receipt ids allocated
+            m_prepared_lightunit_para = lightunit_build_para;
+            return nullptr;
         }
     }
 
@@ -0,0 +1,45 @@
+// Copyright (c) 2017-2018 Telos Foundation & contributors
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "xbase/xns_macro.h"
+
+NS_BEG2(top, blockmaker)
+
+// worker threads shared by all table makers to build units of one table proposal at the same time.
+// caller thread always takes jobs as well, so a busy pool only reduce parallelism but never block proposal.
+class xunit_build_pool_t {
+ public:
+    static xunit_build_pool_t & instance();
+
+ public:
+    // run job(0) ... job(count - 1) and return after all of them finished, jobs must be independent of each other.
+    // if any job throws, the first exception is rethrown on caller thread after all jobs finished
+    void        parallel_for(size_t count, const std::function<void(size_t)> & job);
+    size_t      get_threads_count() const {return m_threads.size();}
+    // disabled pool runs all jobs on caller thread one by one, used to compare parallel result with sequential one
+    void        set_enabled(bool enabled) {m_enabled = enabled;}
+
+ private:
+    explicit xunit_build_pool_t(size_t threads_count);
+    ~xunit_build_pool_t() {}  // never destroyed, threads run until process exit
+    void        worker_loop();
+
+ private:
+    std::mutex                              m_lock;
+    std::condition_variable                 m_cond;
+    std::deque<std::function<void()>>       m_tasks;
+    std::vector<std::thread>                m_threads;
+    std::atomic<bool>                       m_enabled{true};
+};
+
+NS_END2
@@ -26,11 +26,14 @@ class xlightunit_builder_para_t : public xblock_builder_para_face_t {
     void                                            set_fail_txs(const std::vector<xcons_transaction_ptr_t> & txs) {m_fail_txs = txs;}
     void                                            set_pack_txs(const std::vector<xcons_transaction_ptr_t> & txs) {m_pack_txs = txs;}
     const base::xreceiptid_state_ptr_t &            get_receiptid_state() const {return m_receiptid_state;}
+    void                                            set_lightunit_para(const xlightunit_block_para_t & para) {m_lightunit_para = para;}
+    const xlightunit_block_para_t &                 get_lightunit_para() const {return m_lightunit_para;}
  private:
     std::vector<xcons_transaction_ptr_t>        m_origin_txs;
     std::vector<xcons_transaction_ptr_t>        m_pack_txs;  // txs included in light-unit
     std::vector<xcons_transaction_ptr_t>        m_fail_txs;
     base::xreceiptid_state_ptr_t                m_receiptid_state;
+    xlightunit_block_para_t                     m_lightunit_para;  // result of tx execution
 };
 
 class xlightunit_builder_t : public xblock_builder_face_t {
@@ -40,9 +43,15 @@ class xlightunit_builder_t : public xblock_builder_face_t {
                                             const xobject_ptr_t<base::xvbstate_t> & prev_bstate,
                                             const data::xblock_consensus_para_t & cs_para,
                                             xblock_builder_para_ptr_t & build_para);
+    // build_block = execute_txs + create_block. execute_txs only touch state of the unit itself and can run in parallel with
+    // other units, create_block alloc receipt ids from receiptid state shared by the table so it must run in table's order
+    bool                        execute_txs(const xblock_ptr_t & prev_block,
+                                            const xobject_ptr_t<base::xvbstate_t> & prev_bstate,
+                                            const data::xblock_consensus_para_t & cs_para,
+                                            xblock_builder_para_ptr_t & build_para);
+    xblock_ptr_t                create_block(const xblock_ptr_t & prev_block, const data::xblock_consensus_para_t & cs_para, const xlightunit_block_para_t & lightunit_para, const base::xreceiptid_state_ptr_t & receiptid_state);
  protected:
     void    alloc_tx_receiptid(const std::vector<xcons_transaction_ptr_t> & input_txs, const base::xreceiptid_state_ptr_t & receiptid_state);
-    xblock_ptr_t create_block(const xblock_ptr_t & prev_block, const data::xblock_consensus_para_t & cs_para, const xlightunit_block_para_t & lightunit_para, const base::xreceiptid_state_ptr_t & receiptid_state);    
 };
 
 class xfullunit_builder_t : public xblock_builder_face_t {
@@ -9,6 +9,7 @@
 #include "xdata/xblock.h"
 #include "xblockmaker/xblock_maker_para.h"
 #include "xblockmaker/xblockmaker_face.h"
+#include "xblockmaker/xunit_builder.h"
 
 NS_BEG2(top, blockmaker)
 
@@ -22,6 +23,11 @@ class xunit_maker_t : public xblock_maker_t {
     bool                    push_tx(const data::xblock_consensus_para_t & cs_para, const xcons_transaction_ptr_t & tx);
     void                    clear_tx();
     xblock_ptr_t            make_proposal(const xunitmaker_para_t & unit_para, const data::xblock_consensus_para_t & cs_para, xunitmaker_result_t & result);
+    // make_proposal = prepare_proposal + finish_proposal with same cs_para and result.
+    // prepare_proposal do the heavy job(tx execution, full/empty unit build) and may run in parallel with other unit makers,
+    // finish_proposal alloc receipt ids from table's receiptid state, so unit makers of a table must call it one by one in same order
+    void                    prepare_proposal(const xunitmaker_para_t & unit_para, const data::xblock_consensus_para_t & cs_para, xunitmaker_result_t & result);
+    xblock_ptr_t            finish_proposal(const xunitmaker_para_t & unit_para, const data::xblock_consensus_para_t & cs_para, xunitmaker_result_t & result);
     bool                    can_make_next_block() const;
     bool                    can_make_next_empty_block() const;
     bool                    can_make_next_full_block() const;
@@ -46,7 +52,8 @@ class xunit_maker_t : public xblock_maker_t {
     static constexpr uint32_t                   m_consecutive_empty_unit_max{2};
     uint32_t                                    m_fullunit_contain_of_unit_num_para;
     xblock_builder_face_ptr_t                   m_fullunit_builder;
-    xblock_builder_face_ptr_t                   m_lightunit_builder;
+    std::shared_ptr<xlightunit_builder_t>       m_lightunit_builder;
+    std::shared_ptr<xlightunit_builder_para_t>  m_prepared_lightunit_para{nullptr};  // executed but not created light-unit
     xblock_builder_face_ptr_t                   m_emptyunit_builder;
     xblock_builder_para_ptr_t                   m_default_builder_para;
     bool                                        m_check_state_success{false};
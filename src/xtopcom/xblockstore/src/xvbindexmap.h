@@ -0,0 +1,204 @@
+// Copyright (c) 2018-2020 Telos Foundation & contributors
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+#include <deque>
+#include <iterator>
+#include <algorithm>
+#include <utility>
+
+namespace top
+{
+    namespace store
+    {
+        //sorted map of <view#,T> that keep first _inline_count items inside object itself,
+        //most height has only 1 block(or 2 when forked),so it avoid heap allocation & pointer-chasing of std::map
+        template<typename T,size_t _inline_count = 2>
+        class xviewmap_t
+        {
+        public:
+            typedef std::pair<uint64_t,T>                   value_type;
+            typedef value_type*                             iterator;
+            typedef const value_type*                       const_iterator;
+            typedef std::reverse_iterator<iterator>         reverse_iterator;
+            typedef std::reverse_iterator<const_iterator>   const_reverse_iterator;
+        public:
+            xviewmap_t()
+            {
+                m_size = 0;
+                m_use_heap = false;
+            }
+        public:
+            inline iterator                begin()        {return data();}
+            inline iterator                end()          {return data() + m_size;}
+            inline const_iterator          begin()  const {return data();}
+            inline const_iterator          end()    const {return data() + m_size;}
+            inline reverse_iterator        rbegin()       {return reverse_iterator(end());}
+            inline reverse_iterator        rend()         {return reverse_iterator(begin());}
+            inline const_reverse_iterator  rbegin() const {return const_reverse_iterator(end());}
+            inline const_reverse_iterator  rend()   const {return const_reverse_iterator(begin());}
+
+            inline size_t                  size()   const {return m_size;}
+            inline bool                    empty()  const {return (0 == m_size);}
+
+            iterator  find(const uint64_t viewid)
+            {
+                iterator it = lower_bound(viewid);
+                if( (it != end()) && (it->first == viewid) )
+                    return it;
+                return end();
+            }
+
+            //same behavior as std::map::emplace,never overwrite existing one
+            std::pair<iterator,bool>  emplace(const uint64_t viewid,const T & value)
+            {
+                iterator it = lower_bound(viewid);
+                if( (it != end()) && (it->first == viewid) )
+                    return std::pair<iterator,bool>(it,false);
+
+                const size_t pos = it - begin();
+                if( (false == m_use_heap) && (m_size == _inline_count) ) //move to heap once inline slots are full
+                {
+                    m_heap.assign(m_inline,m_inline + m_size);
+                    m_use_heap = true;
+                }
+                if(m_use_heap)
+                {
+                    m_heap.insert(m_heap.begin() + pos,value_type(viewid,value));
+                }
+                else
+                {
+                    for(size_t i = m_size; i > pos; --i)
+                        m_inline[i] = m_inline[i - 1];
+                    m_inline[pos] = value_type(viewid,value);
+                }
+                ++m_size;
+                return std::pair<iterator,bool>(begin() + pos,true);
+            }
+
+            //return iterator of next item,note:any iterator after erased one is invalid
+            iterator  erase(iterator it)
+            {
+                const size_t pos = it - begin();
+                if(m_use_heap)
+                {
+                    m_heap.erase(m_heap.begin() + pos);
+                }
+                else
+                {
+                    for(size_t i = pos + 1; i < m_size; ++i)
+                        m_inline[i - 1] = m_inline[i];
+                }
+                --m_size;
+                return begin() + pos;
+            }
+
+            void  clear()
+            {
+                m_size = 0;
+                m_use_heap = false;
+                m_heap.clear();
+                m_heap.shrink_to_fit();
+            }
+
+        private:
+            inline value_type*         data()       {return m_use_heap ? m_heap.data() : m_inline;}
+            inline const value_type*   data() const {return m_use_heap ? m_heap.data() : m_inline;}
+            iterator  lower_bound(const uint64_t viewid)
+            {
+                iterator it = begin();
+                for(; it != end(); ++it) //linear search is faster than binary for such few items
+                {
+                    if(it->first >= viewid)
+                        break;
+                }
+                return it;
+            }
+
+        private:
+            value_type               m_inline[_inline_count];
+            std::vector<value_type>  m_heap;
+            uint32_t                 m_size;
+            bool                     m_use_heap;
+        };
+
+        //sorted array of <height#,_view_map> from lower to higher,stored at deque(chunked ring) so that append new height
+        //and clean lowest height are O(1).cached heights are mostly continuous,so find() try position of (height - lowest height)
+        //first and fall back to binary search for gaps(e.g. genesis or full block kept at cache)
+        //note:unlike std::map,emplace/erase may invalidate iterator and reference of other items
+        template<typename _view_map>
+        class xheightmap_t
+        {
+        public:
+            typedef std::pair<uint64_t,_view_map>                      value_type;
+            typedef typename std::deque<value_type>::iterator          iterator;
+            typedef typename std::deque<value_type>::reverse_iterator  reverse_iterator;
+        public:
+            inline iterator          begin()  {return m_items.begin();}
+            inline iterator          end()    {return m_items.end();}
+            inline reverse_iterator  rbegin() {return m_items.rbegin();}
+            inline reverse_iterator  rend()   {return m_items.rend();}
+
+            inline size_t            size()  const {return m_items.size();}
+            inline bool              empty() const {return m_items.empty();}
+            inline void              clear() {m_items.clear();}
+
+            iterator  find(const uint64_t height)
+            {
+                if(m_items.empty())
+                    return m_items.end();
+
+                const uint64_t lowest_height = m_items.front().first;
+                if(height < lowest_height)
+                    return m_items.end();
+
+                const uint64_t offset = height - lowest_height;
+                if( (offset < m_items.size()) && (m_items[offset].first == height) ) //fast path for continuous heights
+                    return m_items.begin() + offset;
+
+                iterator it = lower_bound(height);
+                if( (it != m_items.end()) && (it->first == height) )
+                    return it;
+                return m_items.end();
+            }
+
+            //same behavior as std::map::emplace(height,empty view map)
+            std::pair<iterator,bool>  emplace(const uint64_t height)
+            {
+                if( m_items.empty() || (m_items.back().first < height) ) //most case that append higher block
+                {
+                    m_items.push_back(value_type(height,_view_map()));
+                    return std::pair<iterator,bool>(m_items.end() - 1,true);
+                }
+                iterator it = find(height);
+                if(it != m_items.end())
+                    return std::pair<iterator,bool>(it,false);
+
+                it = m_items.insert(lower_bound(height),value_type(height,_view_map()));
+                return std::pair<iterator,bool>(it,true);
+            }
+
+            //return iterator of next item
+            iterator  erase(iterator it)
+            {
+                return m_items.erase(it);
+            }
+
+        private:
+            iterator  lower_bound(const uint64_t height)
+            {
+                return std::lower_bound(m_items.begin(),m_items.end(),height,[](const value_type & item,const uint64_t target){
+                    return item.first < target;
+                });
+            }
+
+        private:
+            std::deque<value_type>   m_items;
+        };
+
+    };//end of namespace of vstore
+};//end of namespace of top
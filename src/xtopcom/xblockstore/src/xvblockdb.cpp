@@ -227,6 +227,100 @@ namespace top
             return read_block_object_from_db(index_ptr);
         }
         
+        bool    xvblockdb_t::load_block_full(base::xvbindex_t* index_ptr, const int atag)
+        {
+            if(NULL == index_ptr)
+                return false;
+            
+            const bool need_object = (index_ptr->get_this_block() == NULL);
+            #ifdef ENABLE_METRICS
+            if(need_object) {
+                XMETRICS_GAUGE((top::metrics::E_SIMPLE_METRICS_TAG)atag, 0);
+            }
+            #endif
+            if(index_ptr->get_block_class() == base::enum_xvblock_class_nil) //nil block has no input/output resource
+                return need_object ? read_block_object_from_db(index_ptr) : false;
+            
+            base::xvblock_t* cached_block = index_ptr->get_this_block();
+            const bool need_input  = need_object || ( (cached_block->get_input() != NULL)  && (cached_block->get_input()->get_resources_hash().empty() == false)  && (cached_block->get_input()->has_resource_data() == false) );
+            const bool need_output = need_object || ( (cached_block->get_output() != NULL) && (cached_block->get_output()->get_resources_hash().empty() == false) && (cached_block->get_output()->has_resource_data() == false) );
+            if(!need_input && !need_output)
+                return false; //everything is ready
+            
+            //read all parts of block by one batch instead of serialized point lookups
+            const std::string blockobj_key = create_block_object_key(index_ptr);
+            const std::string input_res_key = create_block_input_resource_key(index_ptr);
+            const std::string output_res_key = create_block_output_resource_key(index_ptr);
+            std::vector<std::string> keys;
+            keys.push_back(need_object ? blockobj_key : std::string());
+            keys.push_back(need_input ? input_res_key : std::string());
+            keys.push_back(need_output ? output_res_key : std::string());
+            
+            std::vector<std::string> values;
+            std::vector<bool> found_flags;
+            if( (get_xdbstore()->get_values(keys,values,found_flags) == false) || (values.size() != keys.size()) || (found_flags.size() != keys.size()) )
+            {
+                xwarn("xvblockdb_t::load_block_full,fail to batch read for index(%s)",index_ptr->dump().c_str());
+                if(need_object)
+                    read_block_object_from_db(index_ptr);
+                load_block_input(index_ptr);
+                load_block_output(index_ptr);
+                return need_object && (index_ptr->get_this_block() != NULL);
+            }
+            
+            bool loaded_new_block = false;
+            if(need_object)
+            {
+                #if defined(ENABLE_METRICS)
+                if (index_ptr->get_block_level() == base::enum_xvblock_level_table) {
+                    XMETRICS_GAUGE(metrics::store_block_table_read, 1);
+                } else if (index_ptr->get_block_level() == base::enum_xvblock_level_unit) {
+                    XMETRICS_GAUGE(metrics::store_block_unit_read, 1);
+                } else {
+                    XMETRICS_GAUGE(metrics::store_block_other_read, 1);
+                }
+                #endif
+                if(found_flags[0] == false)
+                {
+                    if(index_ptr->check_store_flag(base::enum_index_store_flag_mini_block)) //has stored header and cert
+                        xerror("xvblockdb_t::load_block_full,fail to find item at DB for key(%s)",blockobj_key.c_str());
+                    else
+                        xwarn("xvblockdb_t::load_block_full,NOT stored block-object yet,index(%s) ",index_ptr->dump().c_str());
+                    return false;
+                }
+                if(attach_block_object(index_ptr,blockobj_key,values[0].data(),values[0].size()) == false)
+                    return false;
+                loaded_new_block = true;
+            }
+            
+            base::xvblock_t* block_ptr = index_ptr->get_this_block();
+            if(  (block_ptr->get_input() != NULL)
+               &&(block_ptr->get_input()->get_resources_hash().empty() == false)
+               &&(block_ptr->get_input()->has_resource_data() == false) )
+            {
+                #if defined(ENABLE_METRICS)
+                XMETRICS_GAUGE(metrics::store_block_input_read, 1);
+                #endif
+                if(found_flags[1] == false)
+                    xwarn_err("xvblockdb_t::load_block_full,fail to read resource from db for path(%s)",input_res_key.c_str());
+                else if(block_ptr->set_input_resources(values[1]) == false)
+                    xerror("xvblockdb_t::load_block_full,load bad input-resource for key(%s)",input_res_key.c_str());
+            }
+            if(  (block_ptr->get_output() != NULL)
+               &&(block_ptr->get_output()->get_resources_hash().empty() == false)
+               &&(block_ptr->get_output()->has_resource_data() == false) )
+            {
+                #if defined(ENABLE_METRICS)
+                XMETRICS_GAUGE(metrics::store_block_output_read, 1);
+                #endif
+                if(found_flags[2] == false)
+                    xwarn_err("xvblockdb_t::load_block_full,fail to read resource from db for path(%s)",output_res_key.c_str());
+                else if(block_ptr->set_output_resources(values[2]) == false)
+                    xerror("xvblockdb_t::load_block_full,read bad output-resource for key(%s)",output_res_key.c_str());
+            }
+            return loaded_new_block;
+        }
+        
         int    xvblockdb_t::save_block(base::xvbindex_t* index_ptr)
         {
             if(NULL == index_ptr)
@@ -254,28 +348,42 @@ namespace top
                 return -1;//invalid params
             }
             
-            const int object_stored_flag = write_block_object_to_db(index_ptr,block_ptr);
+            std::map<std::string,std::string> batch_values; //object,input and output go to DB by one batch
+            const int object_stored_flag = write_block_object_to_db(index_ptr,block_ptr,batch_values);
             if(object_stored_flag < 0)
             {
                 xerror("xvblockdb_t::save_block,fail for write_block_object_to_db,index(%s) and  block(%s)",index_ptr->dump().c_str(),block_ptr->dump().c_str());
                 return object_stored_flag;
             }
+            const bool object_changed = (batch_values.empty() == false);
             
+            int combined_stored_flags = object_stored_flag;
             //new version(>=1) of block may serialize seperately
             if(block_ptr->get_block_class() == base::enum_xvblock_class_nil)
             {
-                return (object_stored_flag | base::enum_index_store_flag_input_resource | base::enum_index_store_flag_output_resource);
+                combined_stored_flags |= (base::enum_index_store_flag_input_resource | base::enum_index_store_flag_output_resource);
+            }
+            else
+            {
+                const int input_stored_flag  = write_block_input_to_db(index_ptr,block_ptr,batch_values);
+                const int output_stored_flag = write_block_output_to_db(index_ptr,block_ptr,batch_values);
+                if(input_stored_flag > 0)
+                    combined_stored_flags |= input_stored_flag;
+                if(output_stored_flag > 0)
+                    combined_stored_flags |= output_stored_flag;
             }
             
-            const int input_stored_flag  = write_block_input_to_db(index_ptr,block_ptr);
-            const int output_stored_flag = write_block_output_to_db(index_ptr,block_ptr);
- 
-            int combined_stored_flags = object_stored_flag;
-            if(input_stored_flag > 0)
-                combined_stored_flags |= input_stored_flag;
-            if(output_stored_flag > 0)
-                combined_stored_flags |= output_stored_flag;
-            
+            if(batch_values.empty() == false)
+            {
+                if(write_values_to_db(batch_values) == false)
+                {
+                    xerror("xvblockdb_t::save_block,fail to store block(%s),index(%s)",block_ptr->dump().c_str(),index_ptr->dump().c_str());
+                    return -2; //failed
+                }
+                if(object_changed)
+                    block_ptr->reset_modified_count();//cleanup flag of modification
+                xinfo("xvblockdb_t::save_block,stored DB for block(%s) and index_ptr(%s),parts=%zu",block_ptr->dump().c_str(), index_ptr->dump().c_str(),batch_values.size());
+            }
             return combined_stored_flags;//return flags to caller who need set xvbindex_t
         }
 
@@ -357,13 +465,13 @@ namespace top
             if(index_obj->check_store_flag(base::enum_index_store_flag_main_entry)) //main index for this height
             {
                 const std::string key_path = create_block_index_key(*index_obj,index_obj->get_height(),prunable_block);
-                is_stored_db_successful = get_xdbstore()->set_value(key_path,index_bin);
+                is_stored_db_successful = write_values_to_db({{key_path,index_bin}});
                 xdbg("xvblockdb_t::write_index_to_db for main entry.index=%s",index_obj->dump().c_str());
             }
             else
             {
                 const std::string key_path = create_block_index_key(*index_obj,index_obj->get_height(),index_obj->get_viewid(),prunable_block);
-                is_stored_db_successful = get_xdbstore()->set_value(key_path,index_bin);
+                is_stored_db_successful = write_values_to_db({{key_path,index_bin}});
                 xdbg("xvblockdb_t::write_index_to_db for other entry.index=%s",index_obj->dump().c_str());
             }
             
@@ -380,6 +488,16 @@ namespace top
             return true;
         }
         
+        bool   xvblockdb_t::write_values_to_db(const std::map<std::string,std::string> & values)
+        {
+            //values are readable once queued,and DB commit batches in order,so caller need not wait
+            const std::string first_key = values.begin()->first;
+            return get_xdbstore()->set_values_async(values,[first_key](bool result) {
+                if(false == result)
+                    xerror("xvblockdb_t::write_values_to_db,fail to commit batch of key(%s)",first_key.c_str());
+            });
+        }
+        
         //return map sorted by viewid from lower to high,caller respond to release ptr later
         std::vector<base::xvbindex_t*>   xvblockdb_t::read_index_from_db(const base::xvaccount_t & account,const uint64_t target_height,bool prunable_block)
         {
@@ -458,15 +576,16 @@ namespace top
             #if defined(ENABLE_METRICS)
             XMETRICS_GAUGE(metrics::store_block_index_read, 1);
             #endif
-            const std::string index_bin = get_xdbstore()->get_value(index_db_key_path);
-            if(index_bin.empty())
+            std::shared_ptr<base::xvdbvalue_t> index_bin = get_xdbstore()->get_value_pinned(index_db_key_path);
+            if( (index_bin == nullptr) || index_bin->empty() )
             {
                 xdbg("xvblockdb_t::read_index_from_db,fail to read from db for path(%s)",index_db_key_path.c_str());
                 return NULL;
             }
             
             base::xvbindex_t * new_index_obj = new base::xvbindex_t();
-            if(new_index_obj->serialize_from(index_bin) <= 0)
+            base::xstream_t _stream(base::xcontext_t::instance(),(uint8_t*)index_bin->data(),(uint32_t)index_bin->size());
+            if(new_index_obj->serialize_from(_stream) <= 0)
             {
                 xerror("xvblockdb_t::read_index_from_db,fail to serialize from db for path(%s)",index_db_key_path.c_str());
                 new_index_obj->release_ref();
@@ -481,7 +600,7 @@ namespace top
             return new_index_obj;
         }
     
-        int    xvblockdb_t::write_block_object_to_db(base::xvbindex_t* index_ptr,base::xvblock_t * block_ptr)
+        int    xvblockdb_t::write_block_object_to_db(base::xvbindex_t* index_ptr,base::xvblock_t * block_ptr,std::map<std::string,std::string> & batch_values)
         {
             if(block_ptr == NULL)
                 return -1;//invalid params
@@ -494,22 +613,11 @@ namespace top
                 std::string blockobj_bin;
                 block_ptr->serialize_to_string(blockobj_bin);
                 const std::string blockobj_key = create_block_object_key(index_ptr);
-                if(get_xdbstore()->set_value(blockobj_key, blockobj_bin))
-                {
-                    update_block_write_metrics(block_ptr->get_block_level(), block_ptr->get_block_class(), enum_blockstore_metrics_type_block_object, blockobj_bin.size());
-                    
-                    xinfo("xvblockdb_t::write_block_object_to_db,stored DB at key(%s) for block(%s) and index_ptr(%s)",blockobj_key.c_str(),block_ptr->dump().c_str(), index_ptr->dump().c_str());
-                    
-                    block_ptr->reset_modified_count();//cleanup flag of modification
-                    //has stored entity of input/output inside of block
-                    return stored_flags;
-                }
-                else
-                {
-                    xerror("xvblockdb_t::write_block_object_to_db,fail to store header for block(%s),index(%s)",block_ptr->dump().c_str(),index_ptr->dump().c_str());
-                    return -2; //failed
-                }
+                update_block_write_metrics(block_ptr->get_block_level(), block_ptr->get_block_class(), enum_blockstore_metrics_type_block_object, blockobj_bin.size());
+                xdbg("xvblockdb_t::write_block_object_to_db,put key(%s) for block(%s)",blockobj_key.c_str(),block_ptr->dump().c_str());
+                batch_values[blockobj_key] = std::move(blockobj_bin);
             }
+            //has stored entity of input/output inside of block
             return stored_flags;
         }
         
@@ -533,8 +641,8 @@ namespace top
                 #endif
                 
                 const std::string blockobj_key = create_block_object_key(index_ptr);
-                const std::string blockobj_bin = from_db->get_value(blockobj_key);
-                if(blockobj_bin.empty())
+                std::shared_ptr<base::xvdbvalue_t> blockobj_bin = from_db->get_value_pinned(blockobj_key);
+                if( (blockobj_bin == nullptr) || blockobj_bin->empty() )
                 {
                     if(index_ptr->check_store_flag(base::enum_index_store_flag_mini_block)) //has stored header and cert
                         xerror("xvblockdb_t::read_block_object_from_db,fail to find item at DB for key(%s)",blockobj_key.c_str());
@@ -544,44 +652,51 @@ namespace top
                     return false;
                 }
                 
-                base::xauto_ptr<base::xvblock_t> new_block_ptr(base::xvblock_t::create_block_object(blockobj_bin));
-                if(!new_block_ptr)
-                {
-                    xerror("xvblockdb_t::read_block_object_from_db,bad data at DB for key(%s)",blockobj_key.c_str());
+                if(attach_block_object(index_ptr,blockobj_key,blockobj_bin->data(),blockobj_bin->size()) == false)
                     return false;
-                }
-                
-                if(  (index_ptr->get_height()    != new_block_ptr->get_height())
-                   ||(index_ptr->get_viewid()    != new_block_ptr->get_viewid())
-                   ||(index_ptr->get_block_hash()!= new_block_ptr->get_block_hash())
-                   ||(index_ptr->get_account()   != new_block_ptr->get_account()) )
-                {
-                    xerror("xvblockdb_t::read_block_object_from_db,fail as index(%s) != block(%s)",index_ptr->dump().c_str(),new_block_ptr->dump().c_str());
-                    return false;//invalid params
-                }
-                
-                //sync flags to raw block if apply
-                const int index_flags = index_ptr->get_block_flags() & base::enum_xvblock_flags_high4bit_mask;
-                const int block_flags = new_block_ptr->get_block_flags() & base::enum_xvblock_flags_high4bit_mask;
-                if(index_flags > block_flags)
-                    new_block_ptr->reset_block_flags(index_ptr->get_block_flags());
-                else if(index_flags < block_flags)
-                {
-                    #ifndef DEBUG
-                    xassert(0); //should not happen at release that dont have test blocks
-                    #endif
-                }
-                
-                new_block_ptr->set_block_flag(base::enum_xvblock_flag_stored);//force add stored flag
-                new_block_ptr->reset_modified_count();//force remove flag of modified
-                
-                if(index_ptr->get_this_block() == NULL)//double check again
-                    index_ptr->reset_this_block(new_block_ptr.get(),true);//link to raw block for index
             }
             return (index_ptr->get_this_block() != NULL);
         }
         
-        int    xvblockdb_t::write_block_input_to_db(base::xvbindex_t* index_ptr,base::xvblock_t * block_ptr)
+        bool    xvblockdb_t::attach_block_object(base::xvbindex_t* index_ptr,const std::string & blockobj_key,const char* data,const size_t size)
+        {
+            base::xauto_ptr<base::xvblock_t> new_block_ptr(base::xvblock_t::create_block_object(data,size));
+            if(!new_block_ptr)
+            {
+                xerror("xvblockdb_t::attach_block_object,bad data at DB for key(%s)",blockobj_key.c_str());
+                return false;
+            }
+            
+            if(  (index_ptr->get_height()    != new_block_ptr->get_height())
+               ||(index_ptr->get_viewid()    != new_block_ptr->get_viewid())
+               ||(index_ptr->get_block_hash()!= new_block_ptr->get_block_hash())
+               ||(index_ptr->get_account()   != new_block_ptr->get_account()) )
+            {
+                xerror("xvblockdb_t::attach_block_object,fail as index(%s) != block(%s)",index_ptr->dump().c_str(),new_block_ptr->dump().c_str());
+                return false;//invalid params
+            }
+            
+            //sync flags to raw block if apply
+            const int index_flags = index_ptr->get_block_flags() & base::enum_xvblock_flags_high4bit_mask;
+            const int block_flags = new_block_ptr->get_block_flags() & base::enum_xvblock_flags_high4bit_mask;
+            if(index_flags > block_flags)
+                new_block_ptr->reset_block_flags(index_ptr->get_block_flags());
+            else if(index_flags < block_flags)
+            {
+                #ifndef DEBUG
+                xassert(0); //should not happen at release that dont have test blocks
+                #endif
+            }
+            
+            new_block_ptr->set_block_flag(base::enum_xvblock_flag_stored);//force add stored flag
+            new_block_ptr->reset_modified_count();//force remove flag of modified
+            
+            if(index_ptr->get_this_block() == NULL)//double check again
+                index_ptr->reset_this_block(new_block_ptr.get(),true);//link to raw block for index
+            return (index_ptr->get_this_block() != NULL);
+        }
+        
+        int    xvblockdb_t::write_block_input_to_db(base::xvbindex_t* index_ptr,base::xvblock_t * block_ptr,std::map<std::string,std::string> & batch_values)
         {
             if(block_ptr == NULL)
                 return -1; //invalid params
@@ -602,16 +717,9 @@ namespace top
                         update_block_write_metrics(block_ptr->get_block_level(), block_ptr->get_block_class(), enum_blockstore_metrics_type_block_input_res, input_res_bin.size());
                         
                         const std::string input_res_key = create_block_input_resource_key(index_ptr);
-                        if(get_xdbstore()->set_value(input_res_key, input_res_bin))
-                        {
-                            xdbg("xvblockdb_t::write_block_input_to_db,store input resource to DB for block(%s),bin_size=%zu",index_ptr->dump().c_str(), input_res_bin.size());
-                            return base::enum_index_store_flag_input_resource;
-                        }
-                        else
-                        {
-                            xerror("xvblockdb_t::write_block_input_to_db,fail to store input resource for block(%s)",index_ptr->dump().c_str());
-                            return -3; //failed
-                        }
+                        xdbg("xvblockdb_t::write_block_input_to_db,store input resource to DB for block(%s),bin_size=%zu",index_ptr->dump().c_str(), input_res_bin.size());
+                        batch_values[input_res_key] = input_res_bin;
+                        return base::enum_index_store_flag_input_resource;
                     }
                     else //fail to found resource data for input of block
                     {
@@ -661,7 +769,7 @@ namespace top
             return (block_ptr->get_input() != NULL);
         }
         
-        int    xvblockdb_t::write_block_output_to_db(base::xvbindex_t* index_ptr,base::xvblock_t * block_ptr)
+        int    xvblockdb_t::write_block_output_to_db(base::xvbindex_t* index_ptr,base::xvblock_t * block_ptr,std::map<std::string,std::string> & batch_values)
         {
             if(block_ptr == NULL)
                 return -1; //invalid params
@@ -680,18 +788,10 @@ namespace top
                     if(output_res_bin.empty() == false)
                     {
                         const std::string output_res_key = create_block_output_resource_key(index_ptr);
-                        if(get_xdbstore()->set_value(output_res_key, output_res_bin))
-                        {
-                            update_block_write_metrics(block_ptr->get_block_level(), block_ptr->get_block_class(), enum_blockstore_metrics_type_block_output_res, output_res_bin.size());
-
-                            xdbg("xvblockdb_t::write_block_output_to_db,store output resource to DB for block(%s),bin_size=%zu",index_ptr->dump().c_str(), output_res_bin.size());
-                            return base::enum_index_store_flag_output_resource;
-                        }
-                        else
-                        {
-                            xerror("xvblockdb_t::write_block_output_to_db,fail to store output resource for block(%s)",index_ptr->dump().c_str());
-                            return -3; //failed
-                        }
+                        update_block_write_metrics(block_ptr->get_block_level(), block_ptr->get_block_class(), enum_blockstore_metrics_type_block_output_res, output_res_bin.size());
+                        xdbg("xvblockdb_t::write_block_output_to_db,store output resource to DB for block(%s),bin_size=%zu",index_ptr->dump().c_str(), output_res_bin.size());
+                        batch_values[output_res_key] = output_res_bin;
+                        return base::enum_index_store_flag_output_resource;
                     }
                     else
                     {
@@ -749,10 +849,10 @@ namespace top
             base::xvblock_t* main_entry_block_ptr = NULL;
             //step#1: try load committed block directly (hit most case)
             const std::string target_block_key = base::xvdbkey_t::create_prunable_block_object_key(account,target_height);
-            const std::string target_block_bin = get_xdbstore()->get_value(target_block_key);
-            if(target_block_bin.empty() == false)
+            std::shared_ptr<base::xvdbvalue_t> target_block_bin = get_xdbstore()->get_value_pinned(target_block_key);
+            if( (target_block_bin != nullptr) && (target_block_bin->empty() == false) )
             {
-                main_entry_block_ptr = base::xvblock_t::create_block_object(target_block_bin);
+                main_entry_block_ptr = base::xvblock_t::create_block_object(target_block_bin->data(),target_block_bin->size());
                 xassert(main_entry_block_ptr != NULL);
                 if(main_entry_block_ptr)
                 {
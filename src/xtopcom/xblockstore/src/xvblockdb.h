@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <map>
 #include "xvledger/xvaccount.h"
 #include "xvledger/xvblock.h"
 #include "xvledger/xvbindex.h"
@@ -46,6 +47,8 @@ namespace top
             bool                load_block_output(base::xvbindex_t* target_index,base::xvblock_t * target_block);
             
             bool                load_block_object(base::xvbindex_t* index_ptr, const int atag = 0);
+            //load block-object(if not loaded yet) + input + output by one batch read,return true if block-object is new loaded
+            bool                load_block_full(base::xvbindex_t* index_ptr, const int atag = 0);
 
             bool                delete_block(base::xvbindex_t* index_ptr);
             
@@ -61,18 +64,22 @@ namespace top
             
         protected:
             bool                write_index_to_db(base::xvbindex_t* index_obj);
+            //write by one batch without waiting for commit when DB has write queue,commit failure is logged by callback
+            bool                write_values_to_db(const std::map<std::string,std::string> & values);
             base::xvbindex_t*   read_index_from_db(const std::string & index_db_key_path);
             //return map sorted by viewid from lower to high,caller respond to release ptr later
             std::vector<base::xvbindex_t*> read_index_from_db(const base::xvaccount_t & account,const uint64_t target_height,bool prunable_block);
             
         protected:
             //when successful return the comibned stored-flags, return 0 if nothing changed, but return < 0 when failed
-            int                 write_block_object_to_db(base::xvbindex_t* index_ptr,base::xvblock_t * block_ptr);
-            int                 write_block_input_to_db(base::xvbindex_t* index_ptr,base::xvblock_t * block_ptr);
-            int                 write_block_output_to_db(base::xvbindex_t* index_ptr,base::xvblock_t * block_ptr);
+            //values are put into batch_values,and save_block write them by one batch
+            int                 write_block_object_to_db(base::xvbindex_t* index_ptr,base::xvblock_t * block_ptr,std::map<std::string,std::string> & batch_values);
+            int                 write_block_input_to_db(base::xvbindex_t* index_ptr,base::xvblock_t * block_ptr,std::map<std::string,std::string> & batch_values);
+            int                 write_block_output_to_db(base::xvbindex_t* index_ptr,base::xvblock_t * block_ptr,std::map<std::string,std::string> & batch_values);
         protected:
             bool                read_block_object_from_db(base::xvbindex_t* index_ptr);
             bool                read_block_object_from_db(base::xvbindex_t* index_ptr,base::xvdbstore_t* from_db);
+            bool                attach_block_object(base::xvbindex_t* index_ptr,const std::string & blockobj_key,const char* data,const size_t size);
             bool                read_block_input_from_db(base::xvbindex_t* index_ptr,base::xvblock_t * block_ptr,base::xvdbstore_t* from_db);
             bool                read_block_output_from_db(base::xvbindex_t* index_ptr,base::xvblock_t * block_ptr,base::xvdbstore_t* from_db);
             
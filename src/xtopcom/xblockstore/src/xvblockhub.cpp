@@ -203,23 +203,20 @@ namespace top
                     if((int)m_all_blocks.size() <= keep_blocks_count)//clean enough
                         break;
 
-                    auto old_height_it = height_it; //copy first
-                    ++height_it;                    //move next in advance
-
-                    if(old_height_it->second.empty()) //clean empty first if have
+                    if(height_it->second.empty()) //clean empty first if have
                     {
-                        m_all_blocks.erase(old_height_it);
+                        height_it = m_all_blocks.erase(height_it);
                         XMETRICS_GAUGE(metrics::blockstore_cache_block_total, -1);
                         continue;
                     }
 
-                    if(   (old_height_it->first != m_meta->_highest_full_block_height)    //keep latest_full_block
-                       && (old_height_it->first <  m_meta->_highest_commit_block_height)  //keep latest_committed block
-                       && (old_height_it->first != m_meta->_highest_lock_block_height)    //keep latest_lock_block
-                       && (old_height_it->first != m_meta->_highest_cert_block_height)    //keep latest_cert block
-                       && (old_height_it->first != m_meta->_highest_connect_block_height))//keep latest_connect_block
+                    if(   (height_it->first != m_meta->_highest_full_block_height)    //keep latest_full_block
+                       && (height_it->first <  m_meta->_highest_commit_block_height)  //keep latest_committed block
+                       && (height_it->first != m_meta->_highest_lock_block_height)    //keep latest_lock_block
+                       && (height_it->first != m_meta->_highest_cert_block_height)    //keep latest_cert block
+                       && (height_it->first != m_meta->_highest_connect_block_height))//keep latest_connect_block
                     {
-                        auto & view_map = old_height_it->second;
+                        auto & view_map = height_it->second;
                         #ifdef ENABLE_METRICS
                         auto erase_count = view_map.size();
                         #endif
@@ -245,18 +242,23 @@ namespace top
                             it->second->release_ref();
                         }
                         //force to clean all prev_pr of next height
-                        if(height_it != m_all_blocks.end())
+                        auto next_height_it = height_it + 1;
+                        if(next_height_it != m_all_blocks.end())
                         {
-                            auto & view_map = height_it->second;
+                            auto & view_map = next_height_it->second;
                             for(auto it = view_map.begin(); it != view_map.end(); ++it)
                                 it->second->reset_prev_block(NULL);
                         }
                         //erase the this iterator finally
-                        m_all_blocks.erase(old_height_it);
+                        height_it = m_all_blocks.erase(height_it);
 
                         XMETRICS_GAUGE(metrics::blockstore_cache_block_total, -1 * erase_count);
 
                     }
+                    else
+                    {
+                        ++height_it;
+                    }
                 }
             }
             else if(force_release_unused_block) //force release block that only hold by internal
@@ -268,11 +270,9 @@ namespace top
                 
                 for(auto height_it = m_all_blocks.begin(); height_it != m_all_blocks.end();)//search from lowest hight to higher
                 {
-                    auto old_height_it = height_it; //copy first
-                    ++height_it;                    //move next in advance
-                    if(old_height_it->second.empty()) //clean empty first if have
+                    if(height_it->second.empty()) //clean empty first if have
                     {
-                        m_all_blocks.erase(old_height_it);
+                        height_it = m_all_blocks.erase(height_it);
                         
                         XMETRICS_GAUGE(metrics::blockstore_cache_block_total, -1);
                         
@@ -280,13 +280,13 @@ namespace top
                     }
 
                     bool cleaned_one = false;
-                    if(   (old_height_it->first != m_meta->_highest_full_block_height)    //keep latest_full_block
-                       && (old_height_it->first <  m_meta->_highest_commit_block_height)  //keep latest_committed block
-                       && (old_height_it->first != m_meta->_highest_lock_block_height)    //keep latest_lock_block
-                       && (old_height_it->first != m_meta->_highest_cert_block_height)    //keep latest_cert block
-                       && (old_height_it->first != m_meta->_highest_connect_block_height))//keep latest_connect_block
+                    if(   (height_it->first != m_meta->_highest_full_block_height)    //keep latest_full_block
+                       && (height_it->first <  m_meta->_highest_commit_block_height)  //keep latest_committed block
+                       && (height_it->first != m_meta->_highest_lock_block_height)    //keep latest_lock_block
+                       && (height_it->first != m_meta->_highest_cert_block_height)    //keep latest_cert block
+                       && (height_it->first != m_meta->_highest_connect_block_height))//keep latest_connect_block
                     {
-                        auto & view_map = old_height_it->second;
+                        auto & view_map = height_it->second;
                         for(auto it = view_map.begin(); it != view_map.end(); ++it)
                         {
                             if(it->second->check_store_flag(base::enum_index_store_flag_non_index) == false)
@@ -311,6 +311,8 @@ namespace top
                     }
                     if(cleaned_one)
                         break;
+                    
+                    ++height_it;
                 }
             }
             return true;
@@ -1281,13 +1283,13 @@ namespace top
                 return nullptr;
 
             //note: emplace return a pair<iterator,bool>, value of bool indicate whether inserted or not, value of iterator point to inserted it
-            auto height_map_pos  = m_all_blocks.emplace(this_block->get_height(),std::map<uint64_t,base::xvbindex_t*>());
+            auto height_map_pos  = m_all_blocks.emplace(this_block->get_height());
             auto & target_height_map     = height_map_pos.first->second;//hight_map_pos.first->first is height, and hight_map_pos.first->second is viewmap
             return cache_index(this_block,target_height_map);
         }
 
         //return cached ptr if successful inserted into cache,otherwise return nullptr,which may bring better performance
-        base::xvbindex_t*   xblockacct_t::cache_index(base::xvbindex_t* this_block,std::map<uint64_t,base::xvbindex_t*> & target_height_map)
+        base::xvbindex_t*   xblockacct_t::cache_index(base::xvbindex_t* this_block,xvbindex_viewmap_t & target_height_map)
         {
             if(nullptr == this_block)
                 return nullptr;
@@ -1681,7 +1683,7 @@ namespace top
             return true;//nothing to rebase
         }
 
-        bool   xblockacct_t::rebase_chain_at_height(std::map<uint64_t,base::xvbindex_t*> & target_height_map)
+        bool   xblockacct_t::rebase_chain_at_height(xvbindex_viewmap_t & target_height_map)
         {
             if(target_height_map.size() > 1) //no need handle if there is only 0/1 candidate block
             {
@@ -1689,11 +1691,8 @@ namespace top
                 uint64_t cur_max_weight = 0;//init to 0
                 for(auto it = target_height_map.begin(); it != target_height_map.end();)//counting every blocks at this height
                 {
-                    auto cur_it = it;
-                    ++it;
-
-                    uint64_t weight = cal_index_base_weight(cur_it->second);
-                    if(cur_it->second->check_block_flag(base::enum_xvblock_flag_committed))
+                    uint64_t weight = cal_index_base_weight(it->second);
+                    if(it->second->check_block_flag(base::enum_xvblock_flag_committed))
                     {
                         if(false == has_commit_already)
                         {
@@ -1701,46 +1700,46 @@ namespace top
                         }
                         else
                         {
-                            xerror("xblockacct_t::rebase_chain_at_height,error-found forked commiteded block(%s)",cur_it->second->dump().c_str());
-
-                            //exception handle, force reset weight to 0
-                            weight = 0;
+                            xerror("xblockacct_t::rebase_chain_at_height,error-found forked commiteded block(%s)",it->second->dump().c_str());
 
                             //exception handle, force keep the oldest one
-                            base::xvbindex_t * index_to_remove = cur_it->second;
+                            base::xvbindex_t * index_to_remove = it->second;
                             //erase from map first
-                            target_height_map.erase(cur_it);
+                            it = target_height_map.erase(it);
                             //delete data at DB then
                             get_blockdb_ptr()->delete_block(index_to_remove);
                             //close and release object
                             index_to_remove->close();
                             index_to_remove->release_ref();
+                            continue; //exception handle, force reset weight to 0
                         }
                     }
                     cur_max_weight = std::max(cur_max_weight,weight);//pick bigger one
+                    ++it;
                 }
 
                 //resolve any blocks of lower weight than max one
                 for(auto it = target_height_map.begin(); it != target_height_map.end();)
                 {
-                    auto cur_it = it;
-                    ++it;
-
-                    const uint64_t weight = cal_index_base_weight(cur_it->second);
+                    const uint64_t weight = cal_index_base_weight(it->second);
 
                     if(weight < cur_max_weight) //remove lower one
                     {
-                        xinfo("xblockacct_t::rebase_chain_at_height,remove existing lower-weight' block(%s) < cur_max_weight(%" PRIu64 ")",cur_it->second->dump().c_str(),cur_max_weight);
+                        xinfo("xblockacct_t::rebase_chain_at_height,remove existing lower-weight' block(%s) < cur_max_weight(%" PRIu64 ")",it->second->dump().c_str(),cur_max_weight);
 
-                        base::xvbindex_t * index_to_remove = cur_it->second;
+                        base::xvbindex_t * index_to_remove = it->second;
                         //erase from map first
-                        target_height_map.erase(cur_it);
+                        it = target_height_map.erase(it);
                         //delete data at DB then
                         get_blockdb_ptr()->delete_block(index_to_remove);
                         //close and release object
                         index_to_remove->close();
                         index_to_remove->release_ref();
                     }
+                    else
+                    {
+                        ++it;
+                    }
                 }
                 xassert(target_height_map.size() >= 1); //at least one block kept
             }
@@ -1760,7 +1759,7 @@ namespace top
             return true;//nothing to resort
         }
         
-        bool   xblockacct_t::resort_index_of_store(std::map<uint64_t,base::xvbindex_t*> & target_height_map)
+        bool   xblockacct_t::resort_index_of_store(xvbindex_viewmap_t & target_height_map)
         {
             if(target_height_map.empty())//nothing need resor
                 return true;
@@ -1837,7 +1836,7 @@ namespace top
             return true;//nothing to conflict
         }
 
-        bool   xblockacct_t::precheck_new_index(base::xvbindex_t * new_index,std::map<uint64_t,base::xvbindex_t*> & target_height_map)
+        bool   xblockacct_t::precheck_new_index(base::xvbindex_t * new_index,xvbindex_viewmap_t & target_height_map)
         {
             if(NULL == new_index)
                 return false;
@@ -1901,7 +1900,7 @@ namespace top
             }
 
             //note: emplace return a pair<iterator,bool>, value of bool indicate whether inserted or not, value of iterator point to inserted it
-            auto height_map_pos  = m_all_blocks.emplace(new_idx->get_height(),std::map<uint64_t,base::xvbindex_t*>());
+            auto height_map_pos  = m_all_blocks.emplace(new_idx->get_height());
             auto & height_view_map = height_map_pos.first->second;//hight_map_pos.first->first is height, and hight_map_pos.first->second is viewmap
 
             //pre-check whether accept this new index
@@ -1949,11 +1948,21 @@ namespace top
                 }
                 cached_index_ptr->set_modified_flag(); //force set flag to store later
                 
+                const uint64_t cached_index_height = cached_index_ptr->get_height();
+                const uint64_t cached_index_viewid = cached_index_ptr->get_viewid();
                 //connect as chain,and check connected_flag and meta
                 connect_index(cached_index_ptr);//here may change index'status
+                
+                //connect_index may load other heights into cache,so find view map again instead of using height_view_map
+                auto cached_height_pos = m_all_blocks.find(cached_index_height);
+                if(cached_height_pos == m_all_blocks.end())
+                {
+                    xdbg("xblockacct_t::new_index,failed-new index (%s) erased after connect",new_idx->dump().c_str());
+                    return nullptr;
+                }
                 //rebase forked blocks if have ,after connect_index
-                rebase_chain_at_height(height_view_map);
-                if(height_view_map.find(cached_index_ptr->get_viewid()) == height_view_map.end())
+                rebase_chain_at_height(cached_height_pos->second);
+                if(cached_height_pos->second.find(cached_index_viewid) == cached_height_pos->second.end())
                 {
                     xdbg("xblockacct_t::new_index,failed-new index (%s) erased after rebase",new_idx->dump().c_str());
                     return nullptr;
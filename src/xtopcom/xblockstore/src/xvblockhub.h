@@ -9,11 +9,15 @@
 #include <map>
 #include "xvblockdb.h"
 #include "xbkstoreutl.h"
+#include "xvbindexmap.h"
 
 namespace top
 {
     namespace store
     {
+        typedef xviewmap_t<base::xvbindex_t*>       xvbindex_viewmap_t;   //<view#,block*> sort from lower to higher
+        typedef xheightmap_t<xvbindex_viewmap_t>    xvbindex_heightmap_t; //<height#,<view#,block*> > sort from lower to higher
+    
         //each account has own virtual store
         class xblockacct_t : public xvblockplugin_t
         {
@@ -100,19 +104,19 @@ namespace top
 
         protected: //help functions
             bool                resort_index_of_store(const uint64_t target_height);
-            bool                resort_index_of_store(std::map<uint64_t,base::xvbindex_t*> & target_height_map);
+            bool                resort_index_of_store(xvbindex_viewmap_t & target_height_map);
             const uint64_t      cal_index_base_weight(base::xvbindex_t * index);
             //define weight system for block' weight = ([status]) + [prev-connected]
             //to speed up clean up any forked or useless block, let it allow store first then rebase it
             bool                rebase_chain_at_height(const uint64_t target_height);
-            bool                rebase_chain_at_height(std::map<uint64_t,base::xvbindex_t*> & target_height_map);
+            bool                rebase_chain_at_height(xvbindex_viewmap_t & target_height_map);
 
             bool                precheck_new_index(base::xvbindex_t * new_index);
-            bool                precheck_new_index(base::xvbindex_t * new_index,std::map<uint64_t,base::xvbindex_t*> & target_height_map);
+            bool                precheck_new_index(base::xvbindex_t * new_index,xvbindex_viewmap_t & target_height_map);
 
             base::xvbindex_t*   new_index(base::xvblock_t* new_raw_block);
             base::xvbindex_t*   cache_index(base::xvbindex_t* this_block);//return cached ptr for performance
-            base::xvbindex_t*   cache_index(base::xvbindex_t* this_block,std::map<uint64_t,base::xvbindex_t*> & target_height_map);
+            base::xvbindex_t*   cache_index(base::xvbindex_t* this_block,xvbindex_viewmap_t & target_height_map);
 
             bool                link_neighbor(base::xvbindex_t* this_block);//just connect prev and next index of list
             bool                full_connect_to(base::xvbindex_t* this_block);//connect to all the way to fullblock or geneis
@@ -139,7 +143,7 @@ namespace top
             base::xblockmeta_t * m_meta;
             xvblockdb_t*         m_blockdb_ptr;
             std::deque<xblockevent_t> m_events_queue;  //stored event
-            std::map<uint64_t,std::map<uint64_t,base::xvbindex_t*> > m_all_blocks;  // < height#, <view#,block*> > sort from lower to higher
+            xvbindex_heightmap_t m_all_blocks;  // < height#, <view#,block*> > sort from lower to higher
         };
 
         //xchainacct_t transfer block status from lower stage to higher : from cert ->lock->commit
@@ -110,7 +110,7 @@ namespace top
                 xwarn_err("xvblockstore invalid account=%s",account_vid.get_address().c_str());\
                 return nullptr;\
             }\
-            auto_xblockacct_ptr account_obj(target_table->get_lock(),this); \
+            auto_xblockacct_ptr account_obj(target_table->get_lock(account_vid),this); \
             get_block_account(target_table,account_vid.get_address(),account_obj); \
 
         #define LOAD_BLOCKACCOUNT_PLUGIN2(account_obj,account_vid) \
@@ -124,7 +124,7 @@ namespace top
                 xwarn_err("xvblockstore invalid account=%s",account_vid.get_address().c_str());\
                 return 0;\
             }\
-            auto_xblockacct_ptr account_obj(target_table->get_lock(),this); \
+            auto_xblockacct_ptr account_obj(target_table->get_lock(account_vid),this); \
             get_block_account(target_table,account_vid.get_address(),account_obj); \
 
         xvblockstore_impl::xvblockstore_impl(base::xcontext_t & _context,const int32_t target_thread_id,base::xvdbstore_t* xvdb_ptr)
@@ -219,18 +219,17 @@ namespace top
                   
                     XMETRICS_GAUGE((top::metrics::E_SIMPLE_METRICS_TAG)atag, 0);
                     XMETRICS_GAUGE(metrics::blockstore_blk_load, 0);
-                    loaded_new_block = get_blockdb_ptr()->load_block_object(target_index, atag);
+                    if(ask_full_load)
+                        loaded_new_block = get_blockdb_ptr()->load_block_full(target_index, atag);
+                    else
+                        loaded_new_block = get_blockdb_ptr()->load_block_object(target_index, atag);
                 } else {  // load from cache
                   
                     XMETRICS_GAUGE((top::metrics::E_SIMPLE_METRICS_TAG)atag, 1);
                     XMETRICS_GAUGE(metrics::blockstore_blk_load, 1);
                     
-                }
-
-                if(ask_full_load)
-                {
-                    get_blockdb_ptr()->load_block_input(target_index);
-                    get_blockdb_ptr()->load_block_output(target_index);
+                    if(ask_full_load)
+                        get_blockdb_ptr()->load_block_full(target_index, atag);
                 }
                 if(target_index->get_this_block() != NULL)
                 {
@@ -781,9 +780,23 @@ namespace top
             base::xvtransaction_store_ptr_t txstore = make_object_ptr<base::xvtransaction_store_t>();
             METRICS_TAG(atag, 1);
 
-            if(type == base::enum_transaction_subtype_all || type == base::enum_transaction_subtype_self || type == base::enum_transaction_subtype_send)
+            const bool query_send = (type == base::enum_transaction_subtype_all || type == base::enum_transaction_subtype_self || type == base::enum_transaction_subtype_send);
+            const bool query_recv = (type == base::enum_transaction_subtype_all || type == base::enum_transaction_subtype_recv);
+            const bool query_confirm = (type == base::enum_transaction_subtype_all || type == base::enum_transaction_subtype_confirm);
+            //load all wanted indexs by one DB round-trip
+            std::vector<base::xvtxkey_t> tx_keys;
+            if(query_send)
+                tx_keys.emplace_back(txhash, base::enum_transaction_subtype_send);
+            if(query_recv)
+                tx_keys.emplace_back(txhash, base::enum_transaction_subtype_recv);
+            if(query_confirm)
+                tx_keys.emplace_back(txhash, base::enum_transaction_subtype_confirm);
+            std::vector<base::xvtxindex_ptr> txindexs = base::xvchain_t::instance().get_xtxstore()->load_tx_idxs(tx_keys);
+            size_t txindex_pos = 0;
+
+            if(query_send)
             {
-                base::xvtxindex_ptr send_txindex = base::xvchain_t::instance().get_xtxstore()->load_tx_idx(txhash, base::enum_transaction_subtype_send);
+                base::xvtxindex_ptr send_txindex = txindexs[txindex_pos++];
                 if(nullptr == send_txindex)
                 {
                     xwarn("xvblockstore_impl::query_tx fail-send tx index not find.tx=%s", base::xstring_utl::to_hex(txhash).c_str());
@@ -818,9 +831,9 @@ namespace top
                     return txstore;
                 }
             }
-            if(type == base::enum_transaction_subtype_all || type == base::enum_transaction_subtype_recv)
+            if(query_recv)
             {
-                base::xvtxindex_ptr txindex = base::xvchain_t::instance().get_xtxstore()->load_tx_idx(txhash, base::enum_transaction_subtype_recv);
+                base::xvtxindex_ptr txindex = txindexs[txindex_pos++];
                 if(!txindex)
                 {
                     xwarn("xvblockstore_impl::query_tx recv tx not find.tx=%s", base::xstring_utl::to_hex(txhash).c_str());
@@ -828,9 +841,9 @@ namespace top
                 }
                 txstore->set_recv_block_info(txindex);
             }
-            if(type == base::enum_transaction_subtype_all || type == base::enum_transaction_subtype_confirm)
+            if(query_confirm)
             {
-                base::xvtxindex_ptr txindex = base::xvchain_t::instance().get_xtxstore()->load_tx_idx(txhash, base::enum_transaction_subtype_confirm);
+                base::xvtxindex_ptr txindex = txindexs[txindex_pos++];
                 if(!txindex)
                 {
                     xwarn("xvblockstore_impl::query_tx confirm tx not find.tx=%s", base::xstring_utl::to_hex(txhash).c_str());
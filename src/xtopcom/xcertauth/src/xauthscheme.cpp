@@ -25,6 +25,14 @@ namespace top
         xauthscheme_t::~xauthscheme_t()
         {
         }
+    
+        void  xauthscheme_t::verify_sign_batch(std::vector<xsign_verify_item_t> & items)
+        {
+            for(auto & item : items)
+            {
+                item.result = verify_sign(*item.signer,item.target_hash,item.signature,item.auth_mutisign_token);
+            }
+        }
         
     }; //end of namespace of auth
 };//end of namesapce of top
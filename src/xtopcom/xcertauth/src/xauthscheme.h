@@ -11,6 +11,16 @@ namespace top
 {
     namespace auth
     {
+        //one single-signature to verify by verify_sign_batch
+        struct xsign_verify_item_t
+        {
+            const base::xvnode_t*  signer;
+            std::string            target_hash;
+            std::string            signature;
+            uint64_t               auth_mutisign_token;
+            bool                   result;
+        };
+    
         class xauthscheme_t : public base::xrefcount_t
         {
         public:
@@ -26,6 +36,9 @@ namespace top
             
             virtual bool                 verify_sign(const base::xvnode_t & signer,const std::string & target_hash,const std::string & signature,const uint64_t auth_mutisign_token) = 0;
             
+            //verify many signatures at one call and write result of each item,default implementation verify them one by one
+            virtual void                 verify_sign_batch(std::vector<xsign_verify_item_t> & items);
+            
             //return a merged signature
             virtual const std::string    merge_muti_sign(const base::xvnodegroup_t & nodes_group,const std::vector<xvip2_t> & muti_nodes,const std::vector<std::string> & muti_signatures,const uint64_t shared_mutisign_token) = 0;
             
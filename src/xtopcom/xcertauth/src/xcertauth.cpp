@@ -39,6 +39,7 @@ namespace top
 
             virtual base::enum_vcert_auth_result     verify_sign(const xvip2_t & signer,const base::xvqcert_t * test_for_cert,const std::string & block_account)  override;
             virtual base::enum_vcert_auth_result     verify_sign(const xvip2_t & signer,const base::xvblock_t * test_for_block) override;
+            virtual void                             verify_sign_batch(const std::vector<xvip2_t> & signers,const std::vector<base::xvqcert_t*> & certs,const std::string & block_account,std::vector<base::enum_vcert_auth_result> & results) override;
 
         public:
             //merge multiple single-signature into threshold signature,and return a merged signature
@@ -60,7 +61,7 @@ namespace top
 
         private:
             const std::string   do_sign_impl(const xvip2_t & signer,const base::xvqcert_t * sign_for_cert,const uint64_t random_seed);
-            base::enum_vcert_auth_result            verify_sign_impl(const xvip2_t & signer,const base::xvqcert_t * test_for_cert);
+            base::enum_vcert_auth_result            prepare_verify_sign(const xvip2_t & signer,const base::xvqcert_t * test_for_cert,const std::string & block_account,xsign_verify_item_t & item,base::xvnode_t* & verify_node);
             base::enum_vcert_auth_result            verify_muti_sign_impl(const base::xvqcert_t * test_for_cert);
 
             xauthscheme_t*       get_auth_scheme(const base::xvqcert_t * test_for_cert);
@@ -254,60 +255,120 @@ namespace top
         }
 
         ///////////////////////////////////////////verify_sign/////////////////////////////////////////////////////////
-        base::enum_vcert_auth_result   xauthcontext_t_impl::verify_sign_impl(const xvip2_t & signer,const base::xvqcert_t * test_for_cert)
+        //checks shared by verify_sign and verify_sign_batch,on success fill item and return a referenced verify_node that caller must release
+        base::enum_vcert_auth_result   xauthcontext_t_impl::prepare_verify_sign(const xvip2_t & signer,const base::xvqcert_t * test_for_cert,const std::string & block_account,xsign_verify_item_t & item,base::xvnode_t* & verify_node)
         {
+            verify_node = NULL;
+            if(NULL == test_for_cert)
+                return base::enum_vcert_auth_result::enum_bad_cert;
+
+            if(false == verify_validator_addr(block_account,test_for_cert))
+            {
+                xerror("xauthcontext_t_impl::verify_sign,fail-validator address for block:%s",test_for_cert->dump().c_str());
+                return base::enum_vcert_auth_result::enum_bad_address;
+            }
+            if(false == test_for_cert->is_valid())
+            {
+                xerror("xauthcontext_t_impl::verify_sign,fail-an undeliver cert:%s",test_for_cert->dump().c_str());
+                return base::enum_vcert_auth_result::enum_bad_cert;
+            }
             if(test_for_cert->get_consensus_type() != base::enum_xconsensus_type_xhbft)
             {
                 xerror("xauthcontext_t_impl::verify_sign,fail-cert_auth requrest enum_xconsensus_type_xhbft for cert:%s",test_for_cert->dump().c_str());
                 return base::enum_vcert_auth_result::enum_bad_consensus;
             }
-            xauthscheme_t * verify_scheme_obj = get_auth_scheme(test_for_cert);
-            if(NULL == verify_scheme_obj)
+            if(NULL == get_auth_scheme(test_for_cert))
             {
                 xerror("xauthcontext_t_impl::verify_sign,fail-found related auth scheme for cert:%s",test_for_cert->dump().c_str());
                 return base::enum_vcert_auth_result::enum_bad_scheme;
             }
-            base::xauto_ptr<base::xvnode_t> verify_node = m_node_service.get_node(signer);
-            if(verify_node == nullptr)
+            base::xauto_ptr<base::xvnode_t> found_node = m_node_service.get_node(signer);
+            if(found_node == nullptr)
             {
                 xerror("xauthcontext_t_impl::verify_sign,fail-found target nodes for signer(%" PRIx64 " : %" PRIx64 ")",signer.high_addr,signer.low_addr);
                 return base::enum_vcert_auth_result::enum_nodes_notfound;
             }
-            const uint64_t auth_mutisign_token = test_for_cert->get_viewid() + test_for_cert->get_viewtoken();
-            const std::string ask_verify_hash = test_for_cert->get_hash_to_sign();
             if(test_for_cert->is_validator(signer))
-            {
-                if(verify_scheme_obj->verify_sign(*verify_node, ask_verify_hash, test_for_cert->get_verify_signature(),auth_mutisign_token))
-                    return base::enum_vcert_auth_result::enum_successful;
-            }
+                item.signature = test_for_cert->get_verify_signature();
             else if(test_for_cert->is_auditor(signer))
+                item.signature = test_for_cert->get_audit_signature();
+            else
             {
-                if(verify_scheme_obj->verify_sign(*verify_node, ask_verify_hash, test_for_cert->get_audit_signature(),auth_mutisign_token))
-                    return base::enum_vcert_auth_result::enum_successful;
+                xwarn_err("xauthcontext_t_impl::verify_sign,fail-invalid signer(%" PRIx64 " : %" PRIx64 ") for cert=%s",signer.high_addr,signer.low_addr,test_for_cert->dump().c_str());
+                return base::enum_vcert_auth_result::enum_verify_fail;
             }
-            xwarn_err("xauthcontext_t_impl::verify_sign,fail-invalid signer(%" PRIx64 " : %" PRIx64 ") for cert=%s",signer.high_addr,signer.low_addr,test_for_cert->dump().c_str());
-            return base::enum_vcert_auth_result::enum_verify_fail;
+            verify_node = found_node.get();
+            verify_node->add_ref();
+
+            item.signer = verify_node;
+            item.target_hash = test_for_cert->get_hash_to_sign();
+            item.auth_mutisign_token = test_for_cert->get_viewid() + test_for_cert->get_viewtoken();
+            item.result = false;
+            return base::enum_vcert_auth_result::enum_successful;
         }
         base::enum_vcert_auth_result   xauthcontext_t_impl::verify_sign(const xvip2_t & signer,const base::xvqcert_t * test_for_cert,const std::string & block_account)
         {
-            if(NULL == test_for_cert)
-                return base::enum_vcert_auth_result::enum_bad_cert;
+            xsign_verify_item_t item;
+            base::xvnode_t * verify_node = NULL;
+            base::enum_vcert_auth_result result = prepare_verify_sign(signer,test_for_cert,block_account,item,verify_node);
+            if(result == base::enum_vcert_auth_result::enum_successful)
+            {
+                if(false == get_auth_scheme(test_for_cert)->verify_sign(*verify_node,item.target_hash,item.signature,item.auth_mutisign_token))
+                {
+                    xwarn_err("xauthcontext_t_impl::verify_sign,fail-invalid signer(%" PRIx64 " : %" PRIx64 ") for cert=%s",signer.high_addr,signer.low_addr,test_for_cert->dump().c_str());
+                    result = base::enum_vcert_auth_result::enum_verify_fail;
+                }
+                verify_node->release_ref();
+            }
+            if(result != base::enum_vcert_auth_result::enum_successful)
+                xwarn("xauthcontext_t_impl::verify_sign,fail-with error code:%d",result);
+            return result;
+        }
+        void   xauthcontext_t_impl::verify_sign_batch(const std::vector<xvip2_t> & signers,const std::vector<base::xvqcert_t*> & certs,const std::string & block_account,std::vector<base::enum_vcert_auth_result> & results)
+        {
+            results.assign(certs.size(),base::enum_vcert_auth_result::enum_verify_fail);
+            if(signers.size() != certs.size())
+            {
+                xerror("xauthcontext_t_impl::verify_sign_batch,fail-unmatched signers(%zu) and certs(%zu)",signers.size(),certs.size());
+                return;
+            }
 
-            if(false == verify_validator_addr(block_account,test_for_cert))
+            //same checks as verify_sign,then group good items by scheme
+            std::vector<base::xvnode_t*>     verify_nodes;   //hold reference until verify finished
+            std::vector<xsign_verify_item_t> scheme_items[base::enum_xvchain_sign_scheme_max + 1];
+            std::vector<size_t>              scheme_indexes[base::enum_xvchain_sign_scheme_max + 1];
+            for(size_t i = 0; i < certs.size(); ++i)
             {
-                xerror("xauthcontext_t_impl::verify_sign,fail-validator address for block:%s",test_for_cert->dump().c_str());
-                return base::enum_vcert_auth_result::enum_bad_address;
+                xsign_verify_item_t item;
+                base::xvnode_t * verify_node = NULL;
+                results[i] = prepare_verify_sign(signers[i],certs[i],block_account,item,verify_node);
+                if(results[i] != base::enum_vcert_auth_result::enum_successful)
+                    continue;
+
+                results[i] = base::enum_vcert_auth_result::enum_verify_fail;  //until signature verified
+                verify_nodes.push_back(verify_node);
+                const int scheme = certs[i]->get_crypto_sign_type();
+                scheme_items[scheme].push_back(item);
+                scheme_indexes[scheme].push_back(i);
             }
 
-            if(false == test_for_cert->is_valid())
+            for(int scheme = 0; scheme <= base::enum_xvchain_sign_scheme_max; ++scheme)
             {
-                xerror("xauthcontext_t_impl::verify_sign,fail-an undeliver cert:%s",test_for_cert->dump().c_str());
-                return base::enum_vcert_auth_result::enum_bad_cert;
+                if(scheme_items[scheme].empty())
+                    continue;
+
+                m_auth_schemes[scheme]->verify_sign_batch(scheme_items[scheme]);
+                for(size_t j = 0; j < scheme_items[scheme].size(); ++j)
+                {
+                    if(scheme_items[scheme][j].result)
+                        results[scheme_indexes[scheme][j]] = base::enum_vcert_auth_result::enum_successful;
+                    else
+                        xwarn("xauthcontext_t_impl::verify_sign_batch,fail-verify signature for cert=%s",certs[scheme_indexes[scheme][j]]->dump().c_str());
+                }
             }
-            base::enum_vcert_auth_result result = verify_sign_impl(signer,test_for_cert);
-            if(result != base::enum_vcert_auth_result::enum_successful)
-                xwarn("xauthcontext_t_impl::verify_sign,fail-with error code:%d",result);
-            return result;
+
+            for(auto node : verify_nodes)
+                node->release_ref();
         }
         base::enum_vcert_auth_result   xauthcontext_t_impl::verify_sign(const xvip2_t & signer,const base::xvblock_t * test_for_block)
         {
@@ -0,0 +1,220 @@
+// Copyright (c) 2018-2020 Telos Foundation & contributors
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <cinttypes>
+#include "xbase/xutl.h"
+#include "xpubkeycache.h"
+#include "xmutisig/xschnorr/xschnorr.h"
+#include "xmutisig/xmutisig.h"
+
+namespace top
+{
+    namespace auth
+    {
+        xaggpubkey_cache_t::xaggpubkey_cache_t()
+        {
+            m_access_clock      = 0;
+            m_hit_count         = 0;
+            m_incremental_count = 0;
+            m_miss_count        = 0;
+        }
+
+        xaggpubkey_cache_t::~xaggpubkey_cache_t()
+        {
+        }
+
+        xaggpubkey_cache_t::xgroup_pubkeys_t &  xaggpubkey_cache_t::get_group(const xvip2_t & group_xip2,const uint32_t group_size)
+        {
+            const std::pair<uint64_t,uint64_t> group_key(group_xip2.high_addr,group_xip2.low_addr);
+            auto it = m_groups.find(group_key);
+            if(it == m_groups.end())
+            {
+                if(m_groups.size() >= enum_max_cached_groups) //evict the least recent used group
+                {
+                    auto oldest_it = m_groups.begin();
+                    for(auto scan_it = m_groups.begin(); scan_it != m_groups.end(); ++scan_it)
+                    {
+                        if(scan_it->second.last_access < oldest_it->second.last_access)
+                            oldest_it = scan_it;
+                    }
+                    m_groups.erase(oldest_it);
+                }
+                it = m_groups.emplace(group_key,xgroup_pubkeys_t()).first;
+            }
+            xgroup_pubkeys_t & group = it->second;
+            if(group.slot_key_strs.size() != group_size)
+            {
+                group.slot_key_strs.assign(group_size,std::string());
+                group.slot_keys.assign(group_size,nullptr);
+                group.aggregated_keys.clear();
+            }
+            group.last_access = ++m_access_clock;
+            return group;
+        }
+
+        std::shared_ptr<xmutisig::xpubkey>  xaggpubkey_cache_t::get_aggregated_pubkey(const xvip2_t & group_xip2,const uint32_t group_size,const std::vector<uint32_t> & signer_slots,const std::vector<std::string> & signer_pubkeys)
+        {
+            if(signer_slots.empty() || (signer_slots.size() != signer_pubkeys.size()) )
+                return nullptr;
+
+            std::string signers_bitmap((group_size + 7) / 8,0);
+            for(auto slot : signer_slots)
+            {
+                if(slot >= group_size)
+                    return nullptr;
+                signers_bitmap[slot >> 3] |= (char)(1 << (slot & 7));
+            }
+
+            std::shared_ptr<xmutisig::xpubkey>               base_aggregated_pubkey;
+            std::vector<uint32_t>                            add_slots;
+            std::vector<uint32_t>                            sub_slots;
+            std::map<uint32_t,std::shared_ptr<xmutisig::xpubkey> > slot_keys; //keys of add_slots & sub_slots
+            std::map<uint32_t,std::string>                   slot_key_strs;    //key strs of add_slots
+            {
+                std::lock_guard<std::mutex> locker(m_lock);
+                xgroup_pubkeys_t & group = get_group(group_xip2,group_size);
+                for(size_t i = 0; i < signer_slots.size(); ++i)
+                {
+                    std::string & cached_str = group.slot_key_strs[signer_slots[i]];
+                    if(cached_str != signer_pubkeys[i])
+                    {
+                        if(false == cached_str.empty()) //node of slot changed,all aggregated keys are useless now
+                        {
+                            xwarn("xaggpubkey_cache_t::get_aggregated_pubkey,pubkey changed at slot(%u) of group(%" PRIx64 " : %" PRIx64 ")",signer_slots[i],group_xip2.high_addr,group_xip2.low_addr);
+                            group.aggregated_keys.clear();
+                            group.slot_keys[signer_slots[i]] = nullptr;
+                        }
+                        cached_str = signer_pubkeys[i];
+                    }
+                }
+
+                //search exact same signers,or the closest one
+                auto closest_it = group.aggregated_keys.end();
+                size_t closest_distance = signer_slots.size() / 2; //derive only when it is cheaper than aggregate all
+                for(auto it = group.aggregated_keys.begin(); it != group.aggregated_keys.end(); ++it)
+                {
+                    size_t distance = 0;
+                    for(size_t i = 0; i < signers_bitmap.size(); ++i)
+                        distance += __builtin_popcount((uint8_t)(signers_bitmap[i] ^ it->signers_bitmap[i]));
+
+                    if(0 == distance)
+                    {
+                        std::shared_ptr<xmutisig::xpubkey> found_pubkey = it->aggregated_pubkey;
+                        if(it != group.aggregated_keys.begin())
+                        {
+                            xsigners_aggkey_t found_item = *it;
+                            group.aggregated_keys.erase(it);
+                            group.aggregated_keys.push_front(found_item);
+                        }
+                        ++m_hit_count;
+                        return found_pubkey;
+                    }
+                    if(distance < closest_distance)
+                    {
+                        closest_distance = distance;
+                        closest_it = it;
+                    }
+                }
+
+                if(closest_it != group.aggregated_keys.end())
+                {
+                    for(uint32_t slot = 0; slot < group_size; ++slot)
+                    {
+                        const bool is_new_signer = (signers_bitmap[slot >> 3] >> (slot & 7)) & 1;
+                        const bool is_old_signer = (closest_it->signers_bitmap[slot >> 3] >> (slot & 7)) & 1;
+                        if(is_new_signer && !is_old_signer)
+                            add_slots.push_back(slot);
+                        else if(!is_new_signer && is_old_signer)
+                            sub_slots.push_back(slot);
+                    }
+                    base_aggregated_pubkey = closest_it->aggregated_pubkey;
+                    for(auto slot : sub_slots)
+                    {
+                        if(group.slot_keys[slot] == nullptr) //should not happen,but aggregate all for safety
+                        {
+                            base_aggregated_pubkey = nullptr;
+                            break;
+                        }
+                        slot_keys[slot] = group.slot_keys[slot];
+                    }
+                }
+                if(base_aggregated_pubkey == nullptr)
+                {
+                    add_slots = signer_slots;
+                    sub_slots.clear();
+                    slot_keys.clear();
+                }
+                for(auto slot : add_slots)
+                {
+                    slot_keys[slot] = group.slot_keys[slot];
+                    slot_key_strs[slot] = group.slot_key_strs[slot];
+                }
+            }
+
+            //parse and add/sub EC points without lock,they are heavy
+            std::vector<const xmutisig::xpubkey*> add_keys;
+            std::vector<const xmutisig::xpubkey*> sub_keys;
+            add_keys.reserve(add_slots.size());
+            sub_keys.reserve(sub_slots.size());
+            for(auto slot : add_slots)
+            {
+                std::shared_ptr<xmutisig::xpubkey> & key = slot_keys[slot];
+                if(key == nullptr)
+                {
+                    key = std::make_shared<xmutisig::xpubkey>(slot_key_strs[slot]);
+                    if(key->ec_point() == nullptr)
+                    {
+                        xerror("xaggpubkey_cache_t::get_aggregated_pubkey,fail-an invalid public key at slot(%u) of group(%" PRIx64 " : %" PRIx64 ")",slot,group_xip2.high_addr,group_xip2.low_addr);
+                        return nullptr;
+                    }
+                }
+                add_keys.push_back(key.get());
+            }
+            for(auto slot : sub_slots)
+                sub_keys.push_back(slot_keys[slot].get());
+
+            std::shared_ptr<xmutisig::xpubkey> new_aggregated_pubkey;
+            if(base_aggregated_pubkey != nullptr)
+            {
+                new_aggregated_pubkey = xmutisig::xmutisig::adjust_aggregated_pubkey(*base_aggregated_pubkey,add_keys,sub_keys,xmutisig::xschnorr::instance());
+                ++m_incremental_count;
+            }
+            else
+            {
+                const xmutisig::xpubkey * first_key = add_keys.front();
+                add_keys.erase(add_keys.begin());
+                new_aggregated_pubkey = xmutisig::xmutisig::adjust_aggregated_pubkey(*first_key,add_keys,sub_keys,xmutisig::xschnorr::instance());
+                ++m_miss_count;
+            }
+            if(new_aggregated_pubkey == nullptr)
+            {
+                xerror("xaggpubkey_cache_t::get_aggregated_pubkey,fail-aggregate pubkeys for group(%" PRIx64 " : %" PRIx64 ")",group_xip2.high_addr,group_xip2.low_addr);
+                return nullptr;
+            }
+
+            {
+                std::lock_guard<std::mutex> locker(m_lock);
+                xgroup_pubkeys_t & group = get_group(group_xip2,group_size);
+                for(auto & it : slot_key_strs) //keep parsed keys for later add/sub
+                {
+                    if( (group.slot_key_strs[it.first] == it.second) && (group.slot_keys[it.first] == nullptr) )
+                        group.slot_keys[it.first] = slot_keys[it.first];
+                }
+                for(size_t i = 0; i < signer_slots.size(); ++i) //not cache it if any node changed meantime
+                {
+                    if(group.slot_key_strs[signer_slots[i]] != signer_pubkeys[i])
+                        return new_aggregated_pubkey;
+                }
+                xsigners_aggkey_t new_item;
+                new_item.signers_bitmap    = signers_bitmap;
+                new_item.aggregated_pubkey = new_aggregated_pubkey;
+                group.aggregated_keys.push_front(new_item);
+                if(group.aggregated_keys.size() > enum_max_cached_signers_per_group)
+                    group.aggregated_keys.pop_back();
+            }
+            return new_aggregated_pubkey;
+        }
+
+    }; //end of namespace of auth
+};//end of namesapce of top
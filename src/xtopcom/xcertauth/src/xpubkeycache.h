@@ -0,0 +1,69 @@
+// Copyright (c) 2018-2020 Telos Foundation & contributors
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#pragma once
+
+#include <map>
+#include <deque>
+#include <atomic>
+#include <mutex>
+#include <memory>
+#include <string>
+#include <vector>
+#include "xvledger/xvcnode.h"
+#include "xmutisig/xkeys/xpubkey.h"
+
+namespace top
+{
+    namespace auth
+    {
+        //cache of aggregated public keys for each election group(group xip2 carry election round as well)
+        //every QC of same group has nearly same signers,so reuse last aggregated pubkey instead of sum all signers' pubkey again,
+        //and derive from the closest cached one by add/subtract few different signers when signers changed a little
+        class xaggpubkey_cache_t
+        {
+            enum
+            {
+                enum_max_cached_groups          = 256,  //groups kept at cache,consensus & sync only touch recent rounds
+                enum_max_cached_signers_per_group = 8,  //different signer-bitmap kept for each group
+            };
+            struct xsigners_aggkey_t
+            {
+                std::string                         signers_bitmap;  //bit of slot is set if node signed
+                std::shared_ptr<xmutisig::xpubkey>  aggregated_pubkey;
+            };
+            struct xgroup_pubkeys_t
+            {
+                std::vector<std::string>                         slot_key_strs;  //sign pubkey of each node slot,empty if not loaded yet
+                std::vector<std::shared_ptr<xmutisig::xpubkey> > slot_keys;      //parsed pubkey of each node slot
+                std::deque<xsigners_aggkey_t>                    aggregated_keys;//most recent used at front
+                uint64_t                                         last_access;
+            };
+        public:
+            xaggpubkey_cache_t();
+            ~xaggpubkey_cache_t();
+        private:
+            xaggpubkey_cache_t(const xaggpubkey_cache_t &);
+            xaggpubkey_cache_t & operator = (const xaggpubkey_cache_t &);
+        public:
+            //signer_slots are node slots that signed,signer_pubkeys are their sign pubkey with same order,slots must be unique
+            //return nullptr when fail to parse or aggregate pubkeys
+            std::shared_ptr<xmutisig::xpubkey>  get_aggregated_pubkey(const xvip2_t & group_xip2,const uint32_t group_size,const std::vector<uint32_t> & signer_slots,const std::vector<std::string> & signer_pubkeys);
+
+            const uint64_t  get_hit_count()         const {return m_hit_count;}
+            const uint64_t  get_incremental_count() const {return m_incremental_count;}
+            const uint64_t  get_miss_count()        const {return m_miss_count;}
+        private:
+            xgroup_pubkeys_t &  get_group(const xvip2_t & group_xip2,const uint32_t group_size);
+        private:
+            std::mutex                                                   m_lock;
+            std::map<std::pair<uint64_t,uint64_t>,xgroup_pubkeys_t>     m_groups;//key by <high_addr,low_addr> of group xip2
+            uint64_t                                                     m_access_clock;
+            std::atomic<uint64_t>                                        m_hit_count;        //exactly same signers
+            std::atomic<uint64_t>                                        m_incremental_count;//derived from closest signers
+            std::atomic<uint64_t>                                        m_miss_count;       //aggregated from all signers
+        };
+
+    }; //end of namespace of auth
+};//end of namesapce of top
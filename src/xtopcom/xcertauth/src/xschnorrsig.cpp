@@ -107,6 +107,73 @@ namespace top
             return false;
         }
         
+        void  xschnorrsig_t::verify_sign_batch(std::vector<xsign_verify_item_t> & items)
+        {
+            std::vector<size_t>              batch_indexes;
+            std::vector<std::string>         batch_msgs;
+            std::vector<xmutisig::xpubkey>   batch_pubkeys;
+            std::vector<std::string>         batch_seals;
+            std::vector<std::string>         batch_points;
+            batch_indexes.reserve(items.size());
+            batch_msgs.reserve(items.size());
+            batch_pubkeys.reserve(items.size());
+            batch_seals.reserve(items.size());
+            batch_points.reserve(items.size());
+            for(size_t i = 0; i < items.size(); ++i)
+            {
+                xsign_verify_item_t & item = items[i];
+                item.result = false;
+                if(item.signature.empty() || item.target_hash.empty() || (0 == item.auth_mutisign_token))
+                {
+                    xerror("xschnorrsig_t::verify_sign_batch,fail-bad parameters");
+                    continue;
+                }
+                xmutisigdata_t schnorr_sig_data;
+                if(schnorr_sig_data.serialize_from_string(item.signature) <= 0)
+                {
+                    xerror("xschnorrsig_t::verify_sign_batch,fail-bad signature");
+                    continue;
+                }
+                if(schnorr_sig_data.get_mutisig_token() != item.auth_mutisign_token)
+                {
+                    xerror("xschnorrsig_t::verify_sign_batch,fail-unmatched tokens,token(%" PRIx64 ") != auth-token(%" PRIx64 ") ",schnorr_sig_data.get_mutisig_token(),item.auth_mutisign_token);
+                    continue;
+                }
+                xmutisig::xpubkey _singer_public_key(item.signer->get_sign_pubkey());
+                if(_singer_public_key.ec_point() == nullptr)
+                {
+                    xerror("xschnorrsig_t::verify_sign_batch,fail-an invalid public key for signer(%s)",item.signer->get_account().c_str());
+                    continue;
+                }
+                batch_indexes.push_back(i);
+                batch_msgs.push_back(item.target_hash);
+                batch_pubkeys.push_back(_singer_public_key);
+                batch_seals.push_back(schnorr_sig_data.get_mutisig_seal());
+                batch_points.push_back(schnorr_sig_data.get_mutisig_point());
+            }
+            if(batch_indexes.empty())
+                return;
+            
+            std::vector<const xmutisig::xpubkey*> batch_pubkey_ptrs;
+            batch_pubkey_ptrs.reserve(batch_pubkeys.size());
+            for(auto & pubkey : batch_pubkeys)
+                batch_pubkey_ptrs.push_back(&pubkey);
+            
+            if(xmutisig::xmutisig::verify_sign_batch(batch_msgs,batch_pubkey_ptrs,batch_seals,batch_points,xmutisig::xschnorr::instance()))
+            {
+                for(auto index : batch_indexes)
+                    items[index].result = true;
+                return;
+            }
+            
+            //at least one is bad,so find out them by verify one by one
+            xwarn("xschnorrsig_t::verify_sign_batch,batch of %zu failed,fall back to verify one by one",batch_indexes.size());
+            for(size_t i = 0; i < batch_indexes.size(); ++i)
+            {
+                items[batch_indexes[i]].result = xmutisig::xmutisig::verify_sign(batch_msgs[i],batch_pubkeys[i],batch_seals[i],batch_points[i],xmutisig::xschnorr::instance());
+            }
+        }
+        
         //return a merged & aggregated signature,muti_nodes must be at nodes of group
         const std::string    xschnorrsig_t::merge_muti_sign(const base::xvnodegroup_t & nodes_group,const std::vector<xvip2_t> & muti_nodes,const std::vector<std::string> & muti_signatures,const uint64_t auth_mutisign_token)
         {
@@ -221,7 +288,9 @@ namespace top
                     return false;
                 }
 
-                std::vector<xmutisig::xpubkey> muti_signers_pubkey;
+                std::vector<uint32_t>    muti_signers_slot;
+                std::vector<std::string> muti_signers_pubkey;
+                muti_signers_slot.reserve(nodebits.get_alloc_bits());
                 muti_signers_pubkey.reserve(nodebits.get_alloc_bits());
                 for(int i = 0; i < nodebits.get_alloc_bits(); ++i)
                 {
@@ -240,7 +309,10 @@ namespace top
                             {
                                 auto key_insert_result = exclude_keys.emplace(_node_ptr->get_sign_pubkey());
                                 if(key_insert_result.second)//insert successful
-                                    muti_signers_pubkey.emplace_back(xmutisig::xpubkey(_node_ptr->get_sign_pubkey()));
+                                {
+                                    muti_signers_slot.push_back((uint32_t)i);
+                                    muti_signers_pubkey.push_back(_node_ptr->get_sign_pubkey());
+                                }
                             }
                             else
                             {
@@ -254,7 +326,8 @@ namespace top
                     xerror("xschnorrsig_t::verify_muti_sign,fail-too little signers(%d) < sig_threshold(%u)",(int32_t)muti_signers_pubkey.size(),sig_threshold);
                     return false;
                 }
-                std::shared_ptr<xmutisig::xpubkey> vote_agg_pub = xmutisig::xmutisig::aggregate_pubkeys_2(muti_signers_pubkey, xmutisig::xschnorr::instance());
+                //same group sign most of blocks with nearly same nodes,so cache is used instead of aggregate every pubkey
+                std::shared_ptr<xmutisig::xpubkey> vote_agg_pub = m_aggregated_pubkeys.get_aggregated_pubkey(group.get_xip2_addr(),group.get_size(),muti_signers_slot,muti_signers_pubkey);
                 if(vote_agg_pub == nullptr)
                 {
                     xerror("xschnorrsig_t::verify_muti_sign,fail-aggregate pubkeys with size(%d)",(int32_t)muti_signers_pubkey.size());
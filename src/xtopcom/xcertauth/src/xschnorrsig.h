@@ -5,6 +5,7 @@
 #pragma once
 
 #include "xauthscheme.h"
+#include "xpubkeycache.h"
 
 namespace top
 {
@@ -25,6 +26,9 @@ namespace top
             
             virtual bool                 verify_sign(const base::xvnode_t & signer,const std::string & target_hash,const std::string & signature,const uint64_t auth_mutisign_token) override;
             
+            //verify all good-format signatures by one multi-scalar multiplication,fall back to verify one by one if batch failed
+            virtual void                 verify_sign_batch(std::vector<xsign_verify_item_t> & items) override;
+            
             //return a merged & aggregated signature,muti_nodes must be at same group of network
             virtual const std::string    merge_muti_sign(const base::xvnodegroup_t & nodes_group,const std::vector<xvip2_t> & muti_nodes,const std::vector<std::string> & muti_signatures,const uint64_t auth_mutisign_token) override;
             
@@ -32,6 +36,8 @@ namespace top
             
         public:
             virtual bool                 create_keypair(std::string & prikey,std::string & pubkey) override;
+        private:
+            xaggpubkey_cache_t           m_aggregated_pubkeys;
         };
         
     }; //end of namespace of auth
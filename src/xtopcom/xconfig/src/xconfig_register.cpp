@@ -92,6 +92,10 @@ void xconfig_register_t::init_static_config() {
     XADD_OFFCHAIN_PARAMETER(log_level);
     XADD_OFFCHAIN_PARAMETER(log_path);
     XADD_OFFCHAIN_PARAMETER(db_path);
+    XADD_OFFCHAIN_PARAMETER(db_default_cf_profile);
+    XADD_OFFCHAIN_PARAMETER(db_block_cf_profile);
+    XADD_OFFCHAIN_PARAMETER(db_write_pipeline);
+    XADD_OFFCHAIN_PARAMETER(db_wal_sync);
     XADD_OFFCHAIN_PARAMETER(ip);
     XADD_OFFCHAIN_PARAMETER(root_hash);
 
@@ -107,6 +111,11 @@ void xconfig_register_t::init_static_config() {
     XADD_OFFCHAIN_PARAMETER(recv_tx_cache_window);
     XADD_OFFCHAIN_PARAMETER(config_property_alias_name_max_len);
     XADD_OFFCHAIN_PARAMETER(edge_max_msg_packet_size);
+    XADD_OFFCHAIN_PARAMETER(vhost_dispatch_lanes_count);
+    XADD_OFFCHAIN_PARAMETER(http_io_threads);
+    XADD_OFFCHAIN_PARAMETER(http_worker_threads);
+    XADD_OFFCHAIN_PARAMETER(http_worker_queue_size);
+    XADD_OFFCHAIN_PARAMETER(http_method_max_concurrency);
     XADD_OFFCHAIN_PARAMETER(chain_name);
     XADD_OFFCHAIN_PARAMETER(root_hash);
     XADD_OFFCHAIN_PARAMETER(leader_election_round);
@@ -153,6 +153,11 @@ XDEFINE_CONFIGURATION(recv_tx_cache_window);
 XDEFINE_CONFIGURATION(config_property_alias_name_max_len);
 XDEFINE_CONFIGURATION(account_send_queue_tx_max_num);
 XDEFINE_CONFIGURATION(edge_max_msg_packet_size);
+XDEFINE_CONFIGURATION(vhost_dispatch_lanes_count);
+XDEFINE_CONFIGURATION(http_io_threads);
+XDEFINE_CONFIGURATION(http_worker_threads);
+XDEFINE_CONFIGURATION(http_worker_queue_size);
+XDEFINE_CONFIGURATION(http_method_max_concurrency);
 XDEFINE_CONFIGURATION(leader_election_round);
 XDEFINE_CONFIGURATION(unitblock_confirm_tx_batch_num);
 XDEFINE_CONFIGURATION(unitblock_recv_transfer_tx_batch_num);
@@ -177,6 +182,10 @@ XDEFINE_CONFIGURATION(network_id);
 XDEFINE_CONFIGURATION(log_level);
 XDEFINE_CONFIGURATION(log_path);
 XDEFINE_CONFIGURATION(db_path);
+XDEFINE_CONFIGURATION(db_default_cf_profile);
+XDEFINE_CONFIGURATION(db_block_cf_profile);
+XDEFINE_CONFIGURATION(db_write_pipeline);
+XDEFINE_CONFIGURATION(db_wal_sync);
 XDEFINE_CONFIGURATION(ip);
 /* end of development parameters */
 
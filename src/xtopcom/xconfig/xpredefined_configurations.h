@@ -361,6 +361,11 @@ XDECLARE_CONFIGURATION(recv_tx_cache_window, std::uint32_t, 30);
 XDECLARE_CONFIGURATION(account_send_queue_tx_max_num, std::uint32_t, 16);
 XDECLARE_CONFIGURATION(config_property_alias_name_max_len, std::uint32_t, 32);
 XDECLARE_CONFIGURATION(edge_max_msg_packet_size, std::uint32_t, 50000);
+XDECLARE_CONFIGURATION(vhost_dispatch_lanes_count, std::uint32_t, 4); // threads dispatching received vnetwork messages
+XDECLARE_CONFIGURATION(http_io_threads, std::uint32_t, 2);              // threads accepting and parsing rpc http requests
+XDECLARE_CONFIGURATION(http_worker_threads, std::uint32_t, 8);          // threads executing rpc http requests
+XDECLARE_CONFIGURATION(http_worker_queue_size, std::uint32_t, 4096);    // queued rpc http requests over this are rejected
+XDECLARE_CONFIGURATION(http_method_max_concurrency, std::uint32_t, 4);  // max executing requests of one rpc method
 XDECLARE_CONFIGURATION(executor_max_total_sessions_service_counts, std::uint32_t, 1000); // service count all sessions per time interval
 XDECLARE_CONFIGURATION(executor_max_session_service_counts, std::uint32_t, 600);         // service count per session per time interval
 XDECLARE_CONFIGURATION(executor_session_time_interval, std::uint32_t, 60);               // seconds
@@ -408,6 +413,10 @@ XDECLARE_CONFIGURATION(log_path, const char *, "/chain/log/clog"); // config log
 XDECLARE_CONFIGURATION(db_path, const char *, "/chain/db_v2/cdb"); // config log path
 XDECLARE_CONFIGURATION(ip, const char *, "0.0.0.0");
 XDECLARE_CONFIGURATION(auto_prune_data, const char *, "off");
+XDECLARE_CONFIGURATION(db_default_cf_profile, const char *, "default"); // default/hot/archive
+XDECLARE_CONFIGURATION(db_block_cf_profile, const char *, "default"); // default/hot/archive
+XDECLARE_CONFIGURATION(db_write_pipeline, const char *, "off"); // on/off, group-commit block writes in background
+XDECLARE_CONFIGURATION(db_wal_sync, const char *, "none"); // none/batch, fsync WAL after each group commit
 
 /* end of development parameters */
 
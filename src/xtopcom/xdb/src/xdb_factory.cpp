@@ -10,15 +10,62 @@
 #include "xdb/xdb_mem.h"
 #include "xdb/xdb_face.h"
 #include "xdb/xdb_factory.h"
+#include "xdb/xdb_write_pipeline.h"
 
 
 namespace top { namespace db {
 
-std::shared_ptr<xdb_face_t> xdb_factory_t::create(xdb_kind_t kind, const std::string& db_root_dir,std::vector<xdb_path_t> db_data_paths) {
+xdb_cf_profile_t xdb_cf_profile_t::default_profile() {
+    xdb_cf_profile_t profile;
+    profile.name = "default";
+    return profile;
+}
+
+xdb_cf_profile_t xdb_cf_profile_t::hot_profile() {
+    xdb_cf_profile_t profile;
+    profile.name = "hot";
+    profile.block_cache_quota = 128 << 20;
+    profile.block_size = 8 * 1024;
+    profile.bloom_bits_per_key = 10;
+    profile.partition_index_filters = false;
+    profile.level_compression = xdb_compression_snappy;
+    profile.bottommost_compression = xdb_compression_snappy;
+    return profile;
+}
+
+xdb_cf_profile_t xdb_cf_profile_t::archive_profile() {
+    xdb_cf_profile_t profile;
+    profile.name = "archive";
+    profile.block_cache_quota = 16 << 20;
+    profile.block_size = 16 * 1024; //bigger block get better compress ratio for cold data
+    profile.bloom_bits_per_key = 10;
+    profile.partition_index_filters = true; //huge dataset,avoid loading whole index/filter into memory
+    profile.level_compression = xdb_compression_snappy; //lz4 is not linked with current RocksDB build
+    profile.bottommost_compression = xdb_compression_zstd;
+    profile.bottommost_dict_bytes = 16 * 1024;
+    profile.enable_blob_files = true;
+    profile.min_blob_size = 4 * 1024;
+    return profile;
+}
+
+xdb_cf_profile_t xdb_cf_profile_t::from_name(const std::string & profile_name) {
+    if (profile_name == "hot")
+        return hot_profile();
+    if (profile_name == "archive")
+        return archive_profile();
+    if (profile_name != "default")
+        xwarn("xdb_cf_profile_t::from_name,unknown profile(%s),use default", profile_name.c_str());
+    return default_profile();
+}
+
+std::shared_ptr<xdb_face_t> xdb_factory_t::create(xdb_kind_t kind, const std::string& db_root_dir,std::vector<xdb_path_t> db_data_paths,const xdb_options_t & db_options) {
     switch (kind) {
         case xdb_kind_kvdb:
         {
-            return std::make_shared<xdb>(db_root_dir,db_data_paths);
+            std::shared_ptr<xdb_face_t> db = std::make_shared<xdb>(db_root_dir,db_data_paths,db_options);
+            if (db_options.write_pipeline.enable)
+                db = std::make_shared<xdb_write_pipeline_t>(db, db_options.write_pipeline);
+            return db;
         }
         case xdb_kind_mem:
         {
@@ -32,10 +79,12 @@ std::shared_ptr<xdb_face_t> xdb_factory_t::create(xdb_kind_t kind, const std::st
     }
 }
 
-std::shared_ptr<xdb_face_t> xdb_factory_t::instance(const std::string& db_root_dir,std::vector<xdb_path_t> db_data_paths) {
+std::shared_ptr<xdb_face_t> xdb_factory_t::instance(const std::string& db_root_dir,std::vector<xdb_path_t> db_data_paths,const xdb_options_t & db_options) {
     static std::shared_ptr<xdb_face_t> db = nullptr;
     if (db == nullptr) {
-        db = std::make_shared<xdb>(db_root_dir,db_data_paths);
+        db = std::make_shared<xdb>(db_root_dir,db_data_paths,db_options);
+        if (db_options.write_pipeline.enable)
+            db = std::make_shared<xdb_write_pipeline_t>(db, db_options.write_pipeline);
     }
     return db;
 }
@@ -7,6 +7,8 @@
 #include <vector>
 
 #include "rocksdb/db.h"
+#include "rocksdb/cache.h"
+#include "rocksdb/version.h"
 #include "rocksdb/slice.h"
 #include "rocksdb/options.h"
 #include "rocksdb/table.h"
@@ -143,6 +145,21 @@ bool xdb_rocksdb_transaction_t::erase(const std::string& key) {
     return true;
 }
 
+//hold rocksdb::PinnableSlice,which pin the block at block-cache(or memtable) without copy
+class xdb_rocksdb_pinned_value_t : public xdb_pinned_value_t {
+public:
+    xdb_rocksdb_pinned_value_t() {}
+    ~xdb_rocksdb_pinned_value_t() { m_slice.Reset(); }
+    const char* data() const override { return m_slice.data(); }
+    size_t      size() const override { return m_slice.size(); }
+    rocksdb::PinnableSlice* get_slice() { return &m_slice; }
+private:
+    xdb_rocksdb_pinned_value_t(const xdb_rocksdb_pinned_value_t &);
+    xdb_rocksdb_pinned_value_t & operator = (const xdb_rocksdb_pinned_value_t &);
+private:
+    rocksdb::PinnableSlice m_slice;
+};
+
 //new style(defined as character,optimized for i/o,db size etc),stored at dedicated CF(column Family)
 enum enum_xvdb_cf_type
 {
@@ -168,7 +185,9 @@ class xdb::xdb_impl final
 public:
     static void  disable_default_compress_options(rocksdb::ColumnFamilyOptions & default_cf_options);
     static void  setup_default_db_options(rocksdb::Options & default_db_options);//setup Default Option of whole DB Level
+    static rocksdb::CompressionType to_rocksdb_compression(xdb_compression_t type);
     void         setup_default_cf_options(xColumnFamily & cf_config,const size_t block_size,std::shared_ptr<rocksdb::Cache> & block_cache);
+    void         setup_profile_cf_options(xColumnFamily & cf_config,const xdb_cf_profile_t & profile);//apply non-default profile
     
     xColumnFamily setup_default_cf();//setup Default ColumnFamily(CF),and for read&write as well
     xColumnFamily setup_universal_style_cf(const std::string & name,uint64_t memtable_memory_budget = 64 * 1024 * 1024,int num_levels = 5);
@@ -176,11 +195,13 @@ public:
     xColumnFamily setup_fifo_style_cf(const std::string & name,uint64_t ttl = 14 * 24 * 60 * 60);//setup ColumnFamily(CF) of log only,delete after 14 day as default setting);
 
  public:
-    explicit xdb_impl(const std::string& db_root_dir,std::vector<xdb_path_t> & db_paths);
+    explicit xdb_impl(const std::string& db_root_dir,std::vector<xdb_path_t> & db_paths,const xdb_options_t & db_options);
     ~xdb_impl();
     bool open();
     bool close();
     bool read(const std::string& key, std::string& value) const;
+    std::shared_ptr<xdb_pinned_value_t> read_pinned(const std::string& key) const;
+    bool multi_read(const std::vector<std::string>& keys, std::vector<std::string>& values, std::vector<bool>& found_flags) const;
     bool exists(const std::string& key) const;
     bool write(const std::string& key, const std::string& value);
     bool write(const std::string& key, const char* data, size_t size);
@@ -188,6 +209,7 @@ public:
     bool erase(const std::string& key);
     bool erase(const std::vector<std::string>& keys);
     bool batch_change(const std::map<std::string, std::string>& objs, const std::vector<std::string>& delete_keys);
+    bool flush_wal(bool sync);
     bool read_range(const std::string& prefix, std::vector<std::string>& values);
 
     bool single_delete(const std::string& key);
@@ -208,6 +230,8 @@ public:
     rocksdb::DB*            m_db{nullptr};
     rocksdb::Options        m_options{};
     rocksdb::WriteBatch     m_batch{};
+    xdb_options_t           m_db_options{};
+    std::shared_ptr<rocksdb::Cache>           m_shared_block_cache{nullptr}; //shared by CFs of non-default profile
     std::vector<xColumnFamily>                m_cf_configs;
     std::vector<rocksdb::ColumnFamilyHandle*> m_cf_handles;
 };
@@ -278,6 +302,82 @@ void xdb::xdb_impl::setup_default_cf_options(xColumnFamily & cf_config,const siz
     return;
 }
 
+rocksdb::CompressionType xdb::xdb_impl::to_rocksdb_compression(xdb_compression_t type)
+{
+    switch(type)
+    {
+        case xdb_compression_snappy:
+            return rocksdb::kSnappyCompression;
+        case xdb_compression_lz4:
+            return rocksdb::kLZ4Compression;
+        case xdb_compression_zstd:
+            return rocksdb::kZSTD;
+        default:
+            return rocksdb::kNoCompression;
+    }
+}
+
+//quota of each CF is added to one shared LRU cache,so hot CF may borrow unused capacity of cold CF
+void xdb::xdb_impl::setup_profile_cf_options(xColumnFamily & cf_config,const xdb_cf_profile_t & profile)
+{
+    rocksdb::BlockBasedTableOptions table_options;
+    table_options.enable_index_compression = false;
+    table_options.block_size = profile.block_size;
+    table_options.block_cache = m_shared_block_cache;
+    table_options.filter_policy.reset(rocksdb::NewBloomFilterPolicy(profile.bloom_bits_per_key, false));//full filter,required by partitioned filter
+    if(profile.partition_index_filters)
+    {
+        table_options.index_type = rocksdb::BlockBasedTableOptions::kTwoLevelIndexSearch;
+        table_options.partition_filters = true;
+        table_options.metadata_block_size = 4 * 1024;
+        table_options.cache_index_and_filter_blocks = true;
+        table_options.cache_index_and_filter_blocks_with_high_priority = true;
+        table_options.pin_top_level_index_and_filter = true;
+        table_options.pin_l0_filter_and_index_blocks_in_cache = true;
+    }
+#ifdef DB_CACHE
+    else
+    {
+        table_options.cache_index_and_filter_blocks = true;
+        table_options.cache_index_and_filter_blocks_with_high_priority = true;
+        table_options.pin_l0_filter_and_index_blocks_in_cache = true;
+    }
+#endif
+    cf_config.cf_option.table_factory.reset(rocksdb::NewBlockBasedTableFactory(table_options));
+    cf_config.cf_option.level_compaction_dynamic_level_bytes = m_options.level_compaction_dynamic_level_bytes;
+    
+    //L0 and L1 are rewritten frequently by compaction,keep them uncompressed to save CPU
+    const rocksdb::CompressionType level_compression = to_rocksdb_compression(profile.level_compression);
+    cf_config.cf_option.compression = level_compression;
+    cf_config.cf_option.compression_opts.enabled = (level_compression != rocksdb::kNoCompression);
+    cf_config.cf_option.compression_per_level.resize(cf_config.cf_option.num_levels > 0 ? cf_config.cf_option.num_levels : 0);
+    for(size_t i = 0; i < cf_config.cf_option.compression_per_level.size(); ++i)
+    {
+        cf_config.cf_option.compression_per_level[i] = (i < 2) ? rocksdb::kNoCompression : level_compression;
+    }
+    
+    const rocksdb::CompressionType bottommost_compression = to_rocksdb_compression(profile.bottommost_compression);
+    cf_config.cf_option.bottommost_compression = bottommost_compression;
+    cf_config.cf_option.bottommost_compression_opts.enabled = (bottommost_compression != rocksdb::kNoCompression);
+    if( (bottommost_compression == rocksdb::kZSTD) && (profile.bottommost_dict_bytes > 0) )
+    {
+        cf_config.cf_option.bottommost_compression_opts.max_dict_bytes = profile.bottommost_dict_bytes;
+        cf_config.cf_option.bottommost_compression_opts.zstd_max_train_bytes = profile.bottommost_dict_bytes * 100; //recommend 100x of dict size
+    }
+    
+    if(profile.enable_blob_files)
+    {
+    #if (ROCKSDB_MAJOR > 6) || ((ROCKSDB_MAJOR == 6) && (ROCKSDB_MINOR >= 18))
+        cf_config.cf_option.enable_blob_files = true;
+        cf_config.cf_option.min_blob_size = profile.min_blob_size;
+        cf_config.cf_option.blob_compression_type = bottommost_compression;
+    #else
+        xwarn("xdb_impl::setup_profile_cf_options,blob files not supported by RocksDB %d.%d,ignored for cf(%s)",ROCKSDB_MAJOR,ROCKSDB_MINOR,cf_config.cf_name.c_str());
+    #endif
+    }
+    xkinfo("xdb_impl::setup_profile_cf_options,cf(%s) use profile(%s)",cf_config.cf_name.c_str(),profile.name.c_str());
+}
+
 //setup ColumnFamily(CF) of read & write,as default CF
 xColumnFamily xdb::xdb_impl::setup_default_cf()
 {
@@ -286,6 +386,12 @@ xColumnFamily xdb::xdb_impl::setup_default_cf()
     cf_config.cf_option.num_levels = m_options.num_levels;
     cf_config.cf_option.compression_per_level = m_options.compression_per_level;
     
+    if(m_db_options.default_cf_profile.name != "default")
+    {
+        setup_profile_cf_options(cf_config,m_db_options.default_cf_profile);
+        return cf_config;
+    }
+    
     const size_t block_size = 0; //use default one(4 * 1024)
     std::shared_ptr<rocksdb::Cache> block_cache = nullptr; //use default one(8M)
     setup_default_cf_options(cf_config,block_size,block_cache);
@@ -329,6 +435,12 @@ xColumnFamily xdb::xdb_impl::setup_level_style_cf(const std::string & name,uint6
     else
         cf_config.cf_option.num_levels = num_levels;
     cf_config.cf_option.OptimizeLevelStyleCompaction(memtable_memory_budget);
+    
+    if(m_db_options.block_cf_profile.name != "default")
+    {
+        setup_profile_cf_options(cf_config,m_db_options.block_cf_profile);
+        return cf_config;
+    }
 
     const size_t block_size = 8 * 1024; //default is 4K -> 8K
     std::shared_ptr<rocksdb::Cache> block_cache = rocksdb::NewLRUCache(32 << 20);//default 8M -> 32M
@@ -445,7 +557,8 @@ bool xdb::xdb_impl::close()
     return true;
 }
 
-xdb::xdb_impl::xdb_impl(const std::string& db_root_dir,std::vector<xdb_path_t> & db_paths)
+xdb::xdb_impl::xdb_impl(const std::string& db_root_dir,std::vector<xdb_path_t> & db_paths,const xdb_options_t & db_options)
+ : m_db_options(db_options)
 {
     m_cf_handles.clear();
     m_cf_handles.resize(256); //static mapping each 'char' -> handles
@@ -473,6 +586,18 @@ xdb::xdb_impl::xdb_impl(const std::string& db_root_dir,std::vector<xdb_path_t> &
         }
     }
     
+    //one shared block cache for all CFs of non-default profile,capacity = sum of quota of those CFs
+    size_t shared_cache_size = 0;
+    if(m_db_options.default_cf_profile.name != "default")
+        shared_cache_size += m_db_options.default_cf_profile.block_cache_quota;
+    if(m_db_options.block_cf_profile.name != "default")
+        shared_cache_size += 4 * m_db_options.block_cf_profile.block_cache_quota; //4 block CFs
+    if(shared_cache_size > 0)
+    {
+        m_shared_block_cache = rocksdb::NewLRUCache(shared_cache_size,-1,false,m_db_options.high_pri_pool_ratio);
+        xkinfo("xdb_impl::init,shared block cache size=%zu",shared_cache_size);
+    }
+    
     std::vector<xColumnFamily> cf_list;
     cf_list.push_back(setup_default_cf()); //default is always first one
     cf_list.push_back(setup_level_style_cf("1")); //block 'cf[1]
@@ -574,6 +699,70 @@ bool xdb::xdb_impl::read(const std::string& key, std::string& value) const {
     return true;
 }
 
+std::shared_ptr<xdb_pinned_value_t> xdb::xdb_impl::read_pinned(const std::string& key) const {
+    rocksdb::ColumnFamilyHandle* target_cf = get_cf_handle(key);
+    
+    rocksdb::ReadOptions target_opt = rocksdb::ReadOptions();
+    target_opt.ignore_range_deletions = true; //ignored deleted_ranges to improve read performance
+    target_opt.verify_checksums = false; //application has own checksum
+    
+    std::shared_ptr<xdb_rocksdb_pinned_value_t> value = std::make_shared<xdb_rocksdb_pinned_value_t>();
+    rocksdb::Status s = m_db->Get(target_opt, target_cf, rocksdb::Slice(key), value->get_slice());
+    if (!s.ok()) {
+        if (s.IsNotFound()) {
+            return nullptr;
+        }
+        handle_error(s);
+        return nullptr;
+    }
+    return value;
+}
+
+bool xdb::xdb_impl::multi_read(const std::vector<std::string>& keys, std::vector<std::string>& values, std::vector<bool>& found_flags) const {
+    values.clear();
+    values.resize(keys.size());
+    found_flags.assign(keys.size(), false);
+    
+    std::vector<size_t>                       key_slots;  //position of each valid key at keys
+    std::vector<rocksdb::ColumnFamilyHandle*> target_cfs;
+    std::vector<rocksdb::Slice>               target_keys;
+    key_slots.reserve(keys.size());
+    target_cfs.reserve(keys.size());
+    target_keys.reserve(keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        if (keys[i].empty())
+            continue;
+        key_slots.push_back(i);
+        target_cfs.push_back(get_cf_handle(keys[i]));
+        target_keys.push_back(rocksdb::Slice(keys[i]));
+    }
+    if (target_keys.empty())
+        return true;
+    
+    rocksdb::ReadOptions target_opt = rocksdb::ReadOptions();
+    target_opt.ignore_range_deletions = true; //ignored deleted_ranges to improve read performance
+    target_opt.verify_checksums = false; //application has own checksum
+#if (ROCKSDB_MAJOR > 7) || ((ROCKSDB_MAJOR == 7) && (ROCKSDB_MINOR >= 5))
+    target_opt.async_io = true; //read blocks of different keys in parallel,only when rocksdb is built with coroutines
+#endif
+    
+    //batched MultiGet:keys of same CF are looked up together at memtable and SST files
+    std::vector<rocksdb::PinnableSlice> found_values(target_keys.size());
+    std::vector<rocksdb::Status> status(target_keys.size());
+    m_db->MultiGet(target_opt, target_keys.size(), target_cfs.data(), target_keys.data(), found_values.data(), status.data());
+    bool ret = true;
+    for (size_t i = 0; i < status.size(); ++i) {
+        if (status[i].ok()) {
+            values[key_slots[i]].assign(found_values[i].data(), found_values[i].size());
+            found_flags[key_slots[i]] = true;
+        } else if (!status[i].IsNotFound()) {
+            handle_error(status[i]);
+            ret = false;
+        }
+    }
+    return ret;
+}
+
 bool xdb::xdb_impl::exists(const std::string& key) const {
     std::string value;
     return read(key, value);
@@ -647,6 +836,13 @@ bool xdb::xdb_impl::batch_change(const std::map<std::string, std::string>& objs,
     return s.ok();
 }
 
+bool xdb::xdb_impl::flush_wal(bool sync)
+{
+    rocksdb::Status s = m_db->FlushWAL(sync);
+    handle_error(s);
+    return s.ok();
+}
+
 bool xdb::xdb_impl::single_delete(const std::string& key)
 {
     rocksdb::ColumnFamilyHandle* target_cf = get_cf_handle(key);
@@ -772,8 +968,8 @@ bool xdb::xdb_impl::compact_range(const std::string & begin_key,const std::strin
 }
 
 
-xdb::xdb(const std::string& db_root_dir,std::vector<xdb_path_t> & db_paths)
-: m_db_impl(new xdb_impl(db_root_dir,db_paths)) {
+xdb::xdb(const std::string& db_root_dir,std::vector<xdb_path_t> & db_paths,const xdb_options_t & db_options)
+: m_db_impl(new xdb_impl(db_root_dir,db_paths,db_options)) {
 }
 
 xdb::~xdb() noexcept = default;
@@ -793,6 +989,24 @@ bool xdb::read(const std::string& key, std::string& value) const {
     return ret;
 }
 
+std::shared_ptr<xdb_pinned_value_t> xdb::read_pinned(const std::string& key) const {
+    XMETRICS_TIMER(metrics::db_read_tick);
+    auto value = m_db_impl->read_pinned(key);
+    XMETRICS_GAUGE(metrics::db_read_size, value != nullptr ? value->size() : 0);
+    XMETRICS_GAUGE(metrics::db_read, value != nullptr ? 1 : 0);
+    return value;
+}
+
+bool xdb::multi_read(const std::vector<std::string>& keys, std::vector<std::string>& values, std::vector<bool>& found_flags) const {
+    XMETRICS_TIMER(metrics::db_read_tick);
+    auto ret = m_db_impl->multi_read(keys, values, found_flags);
+    for (size_t i = 0; i < values.size(); ++i) {
+        XMETRICS_GAUGE(metrics::db_read_size, values[i].size());
+        XMETRICS_GAUGE(metrics::db_read, found_flags[i] ? 1 : 0);
+    }
+    return ret;
+}
+
 bool xdb::exists(const std::string& key) const {
     return m_db_impl->exists(key);
 }
@@ -838,6 +1052,10 @@ bool xdb::batch_change(const std::map<std::string, std::string>& objs, const std
     return m_db_impl->batch_change(objs, delete_keys);
 }
 
+bool xdb::flush_wal(bool sync) {
+    return m_db_impl->flush_wal(sync);
+}
+
 void xdb::destroy(const std::string& m_db_name) {
     rocksdb::DestroyDB(m_db_name, rocksdb::Options());
 }
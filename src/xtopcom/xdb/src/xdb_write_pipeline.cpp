@@ -0,0 +1,349 @@
+// Copyright (c) 2017-2018 Telos Foundation & contributors
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <set>
+#include <chrono>
+
+#include "xbase/xlog.h"
+#include "xdb/xdb_write_pipeline.h"
+#include "xmetrics/xmetrics.h"
+
+namespace top { namespace db {
+
+xdb_write_pipeline_t::xdb_write_pipeline_t(const std::shared_ptr<xdb_face_t> & db, const xdb_write_pipeline_options_t & options)
+  : m_db(db), m_options(options) {
+    xkinfo("xdb_write_pipeline_t::init,max_batch_bytes=%zu,max_queue_bytes=%zu,max_delay_ms=%u,wal_sync=%d",
+           m_options.max_batch_bytes, m_options.max_queue_bytes, m_options.max_delay_ms, (int)m_options.wal_sync);
+    start();
+}
+
+xdb_write_pipeline_t::~xdb_write_pipeline_t() {
+    stop();
+}
+
+void xdb_write_pipeline_t::start() {
+    std::lock_guard<std::mutex> locker(m_lock);
+    if (!m_stopped)
+        return;
+    m_stopped = false;
+    m_worker = std::thread(&xdb_write_pipeline_t::run, this);
+}
+
+void xdb_write_pipeline_t::stop() {
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        if (m_stopped)
+            return;
+        m_stopped = true;
+    }
+    m_queue_cond.notify_all();
+    if (m_worker.joinable())
+        m_worker.join();  // worker drains queue before exit
+}
+
+bool xdb_write_pipeline_t::open() {
+    const bool ret = m_db->open();
+    start();
+    return ret;
+}
+
+bool xdb_write_pipeline_t::close() {
+    stop();
+    return m_db->close();
+}
+
+void xdb_write_pipeline_t::flush() {
+    std::unique_lock<std::mutex> locker(m_lock);
+    m_flushed_cond.wait(locker, [this] { return m_queue.empty() && !m_committing; });
+}
+
+size_t xdb_write_pipeline_t::get_queue_depth() const {
+    std::lock_guard<std::mutex> locker(m_lock);
+    return m_queue.size();
+}
+
+std::future<bool> xdb_write_pipeline_t::submit(xwrite_request_ptr_t request) {
+    for (auto const & entry : request->puts)
+        request->bytes += entry.first.size() + entry.second.size();
+    for (auto const & key : request->deletes)
+        request->bytes += key.size();
+
+    std::future<bool> result = request->promise.get_future();
+    {
+        std::unique_lock<std::mutex> locker(m_lock);
+        // backpressure:keep memory bounded when disk can not catch up
+        m_space_cond.wait(locker, [this] { return m_stopped || m_queue_bytes < m_options.max_queue_bytes; });
+        if (m_stopped) {
+            // pipeline closed(maybe while waiting for space),worker may be gone,write directly after queued ones to keep order
+            m_flushed_cond.wait(locker, [this] { return m_queue.empty() && !m_committing; });
+            locker.unlock();
+            const bool ret = m_db->batch_change(request->puts, request->deletes);
+            if (request->callback)
+                request->callback(ret);
+            request->promise.set_value(ret);
+            return result;
+        }
+
+        request->seq = ++m_last_seq;
+        for (auto const & key : request->deletes) {
+            xpending_value_t & pending = m_pending[key];
+            pending.seq = request->seq;
+            pending.deleted = true;
+            pending.value.clear();
+        }
+        for (auto const & entry : request->puts) {
+            xpending_value_t & pending = m_pending[entry.first];
+            pending.seq = request->seq;
+            pending.deleted = false;
+            pending.value = entry.second;
+        }
+        m_queue_bytes += request->bytes;
+        if (request->blocking)
+            ++m_queue_blocking;
+        m_queue.push_back(request);
+        XMETRICS_GAUGE_SET_VALUE(metrics::db_write_pipeline_queue_depth, (int64_t)m_queue.size());
+    }
+    m_queue_cond.notify_one();
+    return result;
+}
+
+bool xdb_write_pipeline_t::submit_and_wait(xwrite_request_ptr_t request) {
+    request->blocking = true;
+    return submit(request).get();
+}
+
+int xdb_write_pipeline_t::read_pending(const std::string& key, std::string& value) const {
+    std::lock_guard<std::mutex> locker(m_lock);
+    auto it = m_pending.find(key);
+    if (it == m_pending.end())
+        return -1;
+    if (it->second.deleted)
+        return 0;
+    value = it->second.value;
+    return 1;
+}
+
+void xdb_write_pipeline_t::run() {
+    for (;;) {
+        std::vector<xwrite_request_ptr_t> requests;
+        {
+            std::unique_lock<std::mutex> locker(m_lock);
+            m_queue_cond.wait(locker, [this] { return m_stopped || !m_queue.empty(); });
+            if (m_queue.empty())  // stopped and drained
+                break;
+
+            // group commit window:give other async writers a chance to join this batch.
+            // a blocked writer is committed at once,writers arrived meantime still join next batch
+            if (!m_stopped && m_options.max_delay_ms > 0 && m_queue_blocking == 0 && m_queue_bytes < m_options.max_batch_bytes) {
+                m_queue_cond.wait_for(locker, std::chrono::milliseconds(m_options.max_delay_ms), [this] {
+                    return m_stopped || m_queue_blocking > 0 || m_queue_bytes >= m_options.max_batch_bytes;
+                });
+            }
+
+            size_t batch_bytes = 0;
+            while (!m_queue.empty() && (requests.empty() || batch_bytes + m_queue.front()->bytes <= m_options.max_batch_bytes)) {
+                batch_bytes += m_queue.front()->bytes;
+                if (m_queue.front()->blocking)
+                    --m_queue_blocking;
+                requests.push_back(m_queue.front());
+                m_queue.pop_front();
+            }
+            m_queue_bytes -= batch_bytes;
+            m_committing = true;
+            XMETRICS_GAUGE_SET_VALUE(metrics::db_write_pipeline_queue_depth, (int64_t)m_queue.size());
+        }
+        m_space_cond.notify_all();
+
+        commit(requests);
+
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            const uint64_t committed_seq = requests.back()->seq;
+            for (auto const & request : requests) {
+                for (auto const & entry : request->puts) {
+                    auto it = m_pending.find(entry.first);
+                    if (it != m_pending.end() && it->second.seq <= committed_seq)
+                        m_pending.erase(it);
+                }
+                for (auto const & key : request->deletes) {
+                    auto it = m_pending.find(key);
+                    if (it != m_pending.end() && it->second.seq <= committed_seq)
+                        m_pending.erase(it);
+                }
+            }
+            m_committing = false;
+        }
+        m_flushed_cond.notify_all();
+    }
+    m_space_cond.notify_all();
+    m_flushed_cond.notify_all();
+}
+
+void xdb_write_pipeline_t::commit(std::vector<xwrite_request_ptr_t> & requests) {
+    XMETRICS_TIMER(metrics::db_write_pipeline_commit_tick);
+    // coalesce requests in order:later op of same key overwrite earlier one
+    std::map<std::string, std::string> puts;
+    std::set<std::string>              deletes;
+    size_t                             batch_bytes = 0;
+    for (auto const & request : requests) {
+        for (auto const & key : request->deletes) {
+            puts.erase(key);
+            deletes.insert(key);
+        }
+        for (auto const & entry : request->puts) {
+            deletes.erase(entry.first);
+            puts[entry.first] = entry.second;
+        }
+        batch_bytes += request->bytes;
+    }
+
+    bool ret = m_db->batch_change(puts, std::vector<std::string>(deletes.begin(), deletes.end()));
+    if (ret && m_options.wal_sync == xdb_wal_sync_every_batch)
+        ret = m_db->flush_wal(true);
+    if (!ret)
+        xerror("xdb_write_pipeline_t::commit,fail to commit batch of %zu requests,%zu puts,%zu deletes", requests.size(), puts.size(), deletes.size());
+    else
+        xdbg("xdb_write_pipeline_t::commit,committed batch of %zu requests,%zu bytes", requests.size(), batch_bytes);
+
+    XMETRICS_GAUGE(metrics::db_write_pipeline_batch_size, (int64_t)requests.size());
+    XMETRICS_GAUGE(metrics::db_write_pipeline_batch_bytes, (int64_t)batch_bytes);
+
+    for (auto const & request : requests) {
+        if (request->callback)
+            request->callback(ret);
+        request->promise.set_value(ret);
+    }
+}
+
+bool xdb_write_pipeline_t::read(const std::string& key, std::string& value) const {
+    const int pending = read_pending(key, value);
+    if (pending >= 0)
+        return (pending == 1);
+    return m_db->read(key, value);
+}
+
+std::shared_ptr<xdb_pinned_value_t> xdb_write_pipeline_t::read_pinned(const std::string& key) const {
+    std::string value;
+    const int pending = read_pending(key, value);
+    if (pending == 1)
+        return std::make_shared<xdb_string_value_t>(std::move(value));
+    if (pending == 0)
+        return nullptr;
+    return m_db->read_pinned(key);
+}
+
+bool xdb_write_pipeline_t::multi_read(const std::vector<std::string>& keys, std::vector<std::string>& values, std::vector<bool>& found_flags) const {
+    std::vector<std::string> db_keys(keys);
+    values.clear();
+    values.resize(keys.size());
+    found_flags.assign(keys.size(), false);
+    bool has_db_key = false;
+    for (size_t i = 0; i < keys.size(); ++i) {
+        if (keys[i].empty())
+            continue;
+        const int pending = read_pending(keys[i], values[i]);
+        if (pending >= 0) {
+            db_keys[i].clear();  // served by pending write
+            found_flags[i] = (pending == 1);
+        } else {
+            has_db_key = true;
+        }
+    }
+    if (!has_db_key)
+        return true;
+
+    std::vector<std::string> db_values;
+    std::vector<bool> db_found_flags;
+    const bool ret = m_db->multi_read(db_keys, db_values, db_found_flags);
+    for (size_t i = 0; i < db_keys.size() && i < db_values.size() && i < db_found_flags.size(); ++i) {
+        if (!db_keys[i].empty()) {
+            values[i] = std::move(db_values[i]);
+            found_flags[i] = db_found_flags[i];
+        }
+    }
+    return ret;
+}
+
+bool xdb_write_pipeline_t::exists(const std::string& key) const {
+    std::string value;
+    return read(key, value);
+}
+
+bool xdb_write_pipeline_t::write(const std::string& key, const std::string& value) {
+    auto request = std::make_shared<xwrite_request_t>();
+    request->puts[key] = value;
+    return submit_and_wait(request);
+}
+
+bool xdb_write_pipeline_t::write(const std::string& key, const char* data, size_t size) {
+    auto request = std::make_shared<xwrite_request_t>();
+    request->puts[key] = std::string(data, size);
+    return submit_and_wait(request);
+}
+
+bool xdb_write_pipeline_t::write(const std::map<std::string, std::string>& batches) {
+    auto request = std::make_shared<xwrite_request_t>();
+    request->puts = batches;
+    return submit_and_wait(request);
+}
+
+bool xdb_write_pipeline_t::erase(const std::string& key) {
+    auto request = std::make_shared<xwrite_request_t>();
+    request->deletes.push_back(key);
+    return submit_and_wait(request);
+}
+
+bool xdb_write_pipeline_t::erase(const std::vector<std::string>& keys) {
+    auto request = std::make_shared<xwrite_request_t>();
+    request->deletes = keys;
+    return submit_and_wait(request);
+}
+
+bool xdb_write_pipeline_t::batch_change(const std::map<std::string, std::string>& objs, const std::vector<std::string>& delete_keys) {
+    auto request = std::make_shared<xwrite_request_t>();
+    request->puts = objs;
+    request->deletes = delete_keys;
+    return submit_and_wait(request);
+}
+
+std::future<bool> xdb_write_pipeline_t::batch_change_async(const std::map<std::string, std::string>& objs, const std::vector<std::string>& delete_keys, xdb_write_callback callback) {
+    auto request = std::make_shared<xwrite_request_t>();
+    request->puts = objs;
+    request->deletes = delete_keys;
+    request->callback = callback;
+    return submit(request);
+}
+
+bool xdb_write_pipeline_t::flush_wal(bool sync) {
+    flush();
+    return m_db->flush_wal(sync);
+}
+
+bool xdb_write_pipeline_t::read_range(const std::string& prefix, std::vector<std::string>& values) {
+    flush();
+    return m_db->read_range(prefix, values);
+}
+
+bool xdb_write_pipeline_t::delete_range(const std::string& begin_key,const std::string& end_key) {
+    flush();
+    return m_db->delete_range(begin_key, end_key);
+}
+
+bool xdb_write_pipeline_t::single_delete(const std::string& key) {
+    flush();
+    return m_db->single_delete(key);
+}
+
+bool xdb_write_pipeline_t::read_range(const std::string& prefix,xdb_iterator_callback callback_fuc,void * cookie) {
+    flush();
+    return m_db->read_range(prefix, callback_fuc, cookie);
+}
+
+bool xdb_write_pipeline_t::compact_range(const std::string & begin_key,const std::string & end_key) {
+    flush();
+    return m_db->compact_range(begin_key, end_key);
+}
+
+}  // namespace db
+}  // namespace top
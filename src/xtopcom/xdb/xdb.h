@@ -20,11 +20,13 @@ class xdb_error : public std::runtime_error {
 
 class xdb : public xdb_face_t {
  public:
-    explicit xdb(const std::string& db_root_dir,std::vector<xdb_path_t> & db_paths);
+    explicit xdb(const std::string& db_root_dir,std::vector<xdb_path_t> & db_paths,const xdb_options_t & db_options = xdb_options_t());
     ~xdb() noexcept;
     bool open() override;
     bool close() override;
     bool read(const std::string& key, std::string& value) const override;
+    std::shared_ptr<xdb_pinned_value_t> read_pinned(const std::string& key) const override;
+    bool multi_read(const std::vector<std::string>& keys, std::vector<std::string>& values, std::vector<bool>& found_flags) const override;
     bool exists(const std::string& key) const override;
     bool write(const std::string& key, const std::string& value) override;
     bool write(const std::string& key, const char* data, size_t size) override;
@@ -35,6 +37,7 @@ class xdb : public xdb_face_t {
     
     //batch mode for multiple keys with multiple ops
     bool batch_change(const std::map<std::string, std::string>& objs, const std::vector<std::string>& delete_keys) override;
+    bool flush_wal(bool sync) override;
     
     //prefix must start from first char of key
     bool read_range(const std::string& prefix, std::vector<std::string>& values) override;
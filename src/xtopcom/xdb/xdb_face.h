@@ -9,6 +9,8 @@
 #include <vector>
 #include <memory>
 #include <map>
+#include <functional>
+#include <future>
 
 namespace top { namespace db {
 
@@ -30,6 +32,57 @@ struct xdb_path_t {
     xdb_path_t(const std::string& p, uint64_t t) : path(p), target_size(t) {}
 };
 
+enum xdb_compression_t {
+    xdb_compression_none,
+    xdb_compression_snappy,
+    xdb_compression_lz4,
+    xdb_compression_zstd,
+};
+
+//tuning profile of one ColumnFamily(CF),selected per key family(default CF for meta/index,block CFs for block object/input/output)
+struct xdb_cf_profile_t {
+    std::string         name;
+    size_t              block_cache_quota{32 << 20};   //bytes this CF contributes to the shared block cache
+    size_t              block_size{8 * 1024};
+    int                 bloom_bits_per_key{10};
+    bool                partition_index_filters{false};//two-level index and partitioned filters,cached at high priority
+    xdb_compression_t   level_compression{xdb_compression_none};      //L2 ... Ln-1 (L0/L1 always uncompressed)
+    xdb_compression_t   bottommost_compression{xdb_compression_none}; //Ln
+    uint32_t            bottommost_dict_bytes{0};      //dictionary size for bottommost compression,0 means disable
+    bool                enable_blob_files{false};      //seperate large values into blob files(need RocksDB 6.18+)
+    uint64_t            min_blob_size{4 * 1024};
+
+    //"default": as original setting,no compression with 32M cache
+    static xdb_cf_profile_t default_profile();
+    //"hot": bigger cache for frequently read keys,light compression
+    static xdb_cf_profile_t hot_profile();
+    //"archive": cold block input/output dominated,compress heavily with dictionary at bottommost level
+    static xdb_cf_profile_t archive_profile();
+    //return default_profile for unknown name
+    static xdb_cf_profile_t from_name(const std::string & profile_name);
+};
+
+enum xdb_wal_sync_t {
+    xdb_wal_sync_none,        //leave WAL at OS buffer,same as sync write before
+    xdb_wal_sync_every_batch, //fsync WAL after each group-commit batch
+};
+
+//write pipeline coalesce writes from many threads into large batches(group commit) at a dedicated thread
+struct xdb_write_pipeline_options_t {
+    bool                enable{false};
+    size_t              max_batch_bytes{4 << 20};   //max bytes of one coalesced batch
+    size_t              max_queue_bytes{64 << 20};  //writers block when pending bytes exceed it
+    uint32_t            max_delay_ms{2};            //wait up to this for more writes before commit a small batch
+    xdb_wal_sync_t      wal_sync{xdb_wal_sync_none};
+};
+
+struct xdb_options_t {
+    xdb_cf_profile_t    default_cf_profile{xdb_cf_profile_t::default_profile()}; //meta,index,tx and other keys
+    xdb_cf_profile_t    block_cf_profile{xdb_cf_profile_t::default_profile()};   //keys of 'r/...' and 's/...' at cf[1]...cf[4]
+    double              high_pri_pool_ratio{0.1};  //ratio of shared block cache reserved for index & filter blocks
+    xdb_write_pipeline_options_t write_pipeline{};
+};
+
 class xdb_transaction_t {
 public:
     virtual bool rollback() { return true; }
@@ -41,6 +94,26 @@ public:
     virtual bool erase(const std::string& key) = 0;
 };
 
+//readonly view of value pinned by DB(e.g. inside block cache),memory is valid until the view is released
+class xdb_pinned_value_t {
+public:
+    virtual ~xdb_pinned_value_t() {}
+    virtual const char* data() const = 0;
+    virtual size_t      size() const = 0;
+};
+
+//fallback view that owns a copy of value,for DB not support pinning
+class xdb_string_value_t : public xdb_pinned_value_t {
+public:
+    explicit xdb_string_value_t(std::string && value) : m_value(std::move(value)) {}
+    const char* data() const override { return m_value.data(); }
+    size_t      size() const override { return m_value.size(); }
+private:
+    std::string m_value;
+};
+
+typedef std::function<void(bool)> xdb_write_callback; //called with result once data is committed
+
 typedef bool (*xdb_iterator_callback)(const std::string& key, const std::string& value,void*cookie);
 
 class xdb_face_t {
@@ -48,6 +121,24 @@ class xdb_face_t {
     virtual bool open() = 0;
     virtual bool close() = 0;
     virtual bool read(const std::string& key, std::string& value) const = 0;
+    //zero-copy read,return nullptr if not found
+    virtual std::shared_ptr<xdb_pinned_value_t> read_pinned(const std::string& key) const {
+        std::string value;
+        if (!read(key, value))
+            return nullptr;
+        return std::make_shared<xdb_string_value_t>(std::move(value));
+    }
+    //batch read,found_flags[i] is false if keys[i] is empty or not found(values[i] is empty then);return false only when DB error
+    virtual bool multi_read(const std::vector<std::string>& keys, std::vector<std::string>& values, std::vector<bool>& found_flags) const {
+        values.clear();
+        values.resize(keys.size());
+        found_flags.assign(keys.size(), false);
+        for (size_t i = 0; i < keys.size(); ++i) {
+            if (!keys[i].empty())
+                found_flags[i] = read(keys[i], values[i]);
+        }
+        return true;
+    }
     virtual bool exists(const std::string& key) const = 0;
     virtual bool write(const std::string& key, const std::string& value) = 0;
     virtual bool write(const std::string& key, const char* data, size_t size) = 0;
@@ -58,6 +149,17 @@ class xdb_face_t {
     
     //batch mode for multiple keys with multiple ops
     virtual bool batch_change(const std::map<std::string, std::string>& objs, const std::vector<std::string>& delete_keys) = 0;
+    //async version of batch_change,callback(optional) and future are fired after committed;default implementation is sync
+    virtual std::future<bool> batch_change_async(const std::map<std::string, std::string>& objs, const std::vector<std::string>& delete_keys, xdb_write_callback callback) {
+        const bool ret = batch_change(objs, delete_keys);
+        if (callback)
+            callback(ret);
+        std::promise<bool> promise;
+        promise.set_value(ret);
+        return promise.get_future();
+    }
+    //persist WAL to disk(fsync if sync is true)
+    virtual bool flush_wal(bool sync) { return true; }
     
     //prefix must start from first char of key
     virtual bool read_range(const std::string& prefix, std::vector<std::string>& values) = 0;
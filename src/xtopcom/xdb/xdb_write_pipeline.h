@@ -0,0 +1,106 @@
+// Copyright (c) 2017-2018 Telos Foundation & contributors
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#pragma once
+
+#include <string>
+#include <memory>
+#include <vector>
+#include <map>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <unordered_map>
+
+#include "xdb/xdb_face.h"
+
+namespace top { namespace db {
+
+//group-commit wrapper of xdb_face_t:writes from many threads are queued and committed by a dedicated thread
+//as large coalesced batches,so concurrent writers share one rocksdb write(and one WAL sync) instead of one each.
+//sync writes wait for the batch they joined and return its result,batch_change_async returns at once.
+//the worker waits max_delay_ms for more writers only while no sync writer is queued,a blocked writer never pays the delay.
+//pending writes are visible to readers(read-your-writes),and range/compact ops flush the queue first to keep order.
+class xdb_write_pipeline_t : public xdb_face_t {
+ public:
+    xdb_write_pipeline_t(const std::shared_ptr<xdb_face_t> & db, const xdb_write_pipeline_options_t & options);
+    ~xdb_write_pipeline_t();
+    xdb_write_pipeline_t(const xdb_write_pipeline_t &) = delete;
+    xdb_write_pipeline_t & operator = (const xdb_write_pipeline_t &) = delete;
+
+ public:
+    bool open() override;
+    bool close() override;
+    bool read(const std::string& key, std::string& value) const override;
+    std::shared_ptr<xdb_pinned_value_t> read_pinned(const std::string& key) const override;
+    bool multi_read(const std::vector<std::string>& keys, std::vector<std::string>& values, std::vector<bool>& found_flags) const override;
+    bool exists(const std::string& key) const override;
+    bool write(const std::string& key, const std::string& value) override;
+    bool write(const std::string& key, const char* data, size_t size) override;
+    bool write(const std::map<std::string, std::string>& batches) override;
+    bool erase(const std::string& key) override;
+    bool erase(const std::vector<std::string>& keys) override;
+    xdb_meta_t get_meta() override { return m_db->get_meta(); }
+
+    bool batch_change(const std::map<std::string, std::string>& objs, const std::vector<std::string>& delete_keys) override;
+    std::future<bool> batch_change_async(const std::map<std::string, std::string>& objs, const std::vector<std::string>& delete_keys, xdb_write_callback callback) override;
+    bool flush_wal(bool sync) override;
+
+    bool read_range(const std::string& prefix, std::vector<std::string>& values) override;
+    bool delete_range(const std::string& begin_key,const std::string& end_key) override;
+    bool single_delete(const std::string& key) override;
+    bool read_range(const std::string& prefix,xdb_iterator_callback callback_fuc,void * cookie) override;
+    bool compact_range(const std::string & begin_key,const std::string & end_key) override;
+
+ public:
+    //block until every queued write is committed
+    void flush();
+    size_t get_queue_depth() const;
+
+ private:
+    struct xwrite_request_t {
+        std::map<std::string, std::string> puts;
+        std::vector<std::string>           deletes;
+        xdb_write_callback                 callback;
+        std::promise<bool>                 promise;
+        size_t                             bytes{0};
+        uint64_t                           seq{0};
+        bool                               blocking{false};  //caller waits for the commit
+    };
+    struct xpending_value_t {
+        uint64_t    seq{0};
+        bool        deleted{false};
+        std::string value;
+    };
+    using xwrite_request_ptr_t = std::shared_ptr<xwrite_request_t>;
+
+    std::future<bool> submit(xwrite_request_ptr_t request);
+    bool submit_and_wait(xwrite_request_ptr_t request);
+    //return 1 if found pending value,0 if pending delete,-1 if not pending
+    int  read_pending(const std::string& key, std::string& value) const;
+    void run();
+    void commit(std::vector<xwrite_request_ptr_t> & requests);
+    void start();
+    void stop();
+
+ private:
+    std::shared_ptr<xdb_face_t>             m_db;
+    const xdb_write_pipeline_options_t      m_options;
+    mutable std::mutex                      m_lock;
+    std::condition_variable                 m_queue_cond;    //notify worker for new request
+    std::condition_variable                 m_space_cond;    //notify writers that blocked by full queue
+    std::condition_variable                 m_flushed_cond;  //notify flush() once queue drained
+    std::deque<xwrite_request_ptr_t>        m_queue;
+    std::unordered_map<std::string, xpending_value_t> m_pending;
+    size_t                                  m_queue_bytes{0};
+    size_t                                  m_queue_blocking{0};  //queued requests with blocked caller
+    uint64_t                                m_last_seq{0};
+    bool                                    m_committing{false};
+    bool                                    m_stopped{true};
+    std::thread                             m_worker;
+};
+
+}  // namespace db
+}  // namespace top
@@ -46,9 +46,9 @@ public:
      */
     void Init();
 
-    void send_to(base::KadmliaKeyPtr const & send_kad_key, base::KadmliaKeyPtr const & recv_kad_key, xbyte_buffer_t const & bytes_message, std::error_code const & ec) const;
+    void send_to(base::KadmliaKeyPtr const & send_kad_key, base::KadmliaKeyPtr const & recv_kad_key, xbyte_buffer_t const & bytes_message, uint16_t priority, std::error_code const & ec) const;
 
-    void spread_rumor(base::KadmliaKeyPtr const & send_kad_key, base::KadmliaKeyPtr const & recv_kad_key, xbyte_buffer_t const & bytes_message, std::error_code const & ec) const;
+    void spread_rumor(base::KadmliaKeyPtr const & send_kad_key, base::KadmliaKeyPtr const & recv_kad_key, xbyte_buffer_t const & bytes_message, uint16_t priority, std::error_code const & ec) const;
 
     void broadcast(base::KadmliaKeyPtr const & send_kad_key, base::KadmliaKeyPtr const & recv_kad_key, xbyte_buffer_t const & bytes_message, std::error_code const & ec) const;
 
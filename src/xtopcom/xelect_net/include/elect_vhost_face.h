@@ -26,9 +26,10 @@ public:
     xtop_network_driver_face & operator=(xtop_network_driver_face &&) = default;
     ~xtop_network_driver_face() override = default;
 
-    virtual void send_to(common::xip2_t const & src, common::xip2_t const & dst, xbyte_buffer_t const & byte_message, std::error_code & ec) const = 0;
-    virtual void send_to_through_root(common::xip2_t const & src, common::xnode_id_t const & dst_node_id, xbyte_buffer_t const & byte_message, std::error_code & ec) const = 0;
-    virtual void spread_rumor(common::xip2_t const & src, common::xip2_t const & dst, xbyte_buffer_t const & byte_message, std::error_code & ec) const = 0;
+    // priority is one of enum_xpacket_priority_type_t,receiver handles critical packets(e.g. consensus) ahead of routine ones
+    virtual void send_to(common::xip2_t const & src, common::xip2_t const & dst, xbyte_buffer_t const & byte_message, uint16_t priority, std::error_code & ec) const = 0;
+    virtual void send_to_through_root(common::xip2_t const & src, common::xnode_id_t const & dst_node_id, xbyte_buffer_t const & byte_message, uint16_t priority, std::error_code & ec) const = 0;
+    virtual void spread_rumor(common::xip2_t const & src, common::xip2_t const & dst, xbyte_buffer_t const & byte_message, uint16_t priority, std::error_code & ec) const = 0;
     virtual void broadcast(common::xip2_t const & src, xbyte_buffer_t const & byte_message, std::error_code & ec) const = 0;
 
     /**
@@ -107,6 +107,7 @@ std::vector<network::xnetwork_message_ready_callback_t> EcNetcard::getall_rumor_
 void EcNetcard::send_to(base::KadmliaKeyPtr const & send_kad_key,
                         base::KadmliaKeyPtr const & recv_kad_key,
                         xbyte_buffer_t const & bytes_message,
+                        uint16_t priority,
                         std::error_code const & ec) const {
     assert(send_kad_key);
     assert(recv_kad_key);
@@ -125,7 +126,7 @@ void EcNetcard::send_to(base::KadmliaKeyPtr const & send_kad_key,
 
     transport::protobuf::RoutingMessage pbft_message;
     pbft_message.set_broadcast(false);
-    pbft_message.set_priority(enum_xpacket_priority_type_routine);
+    pbft_message.set_priority(priority);
     if (recv_kad_key->xnetwork_id() == kRoot) {
         pbft_message.set_is_root(true);
     } else {
@@ -155,6 +156,7 @@ void EcNetcard::send_to(base::KadmliaKeyPtr const & send_kad_key,
 void EcNetcard::spread_rumor(base::KadmliaKeyPtr const & send_kad_key,
                              base::KadmliaKeyPtr const & recv_kad_key,
                              xbyte_buffer_t const & bytes_message,
+                             uint16_t priority,
                              std::error_code const & ec) const {
     assert(send_kad_key);
     assert(recv_kad_key);
@@ -173,7 +175,7 @@ void EcNetcard::spread_rumor(base::KadmliaKeyPtr const & send_kad_key,
 
     transport::protobuf::RoutingMessage pbft_message;
     pbft_message.set_broadcast(true);
-    pbft_message.set_priority(enum_xpacket_priority_type_routine);
+    pbft_message.set_priority(priority);
     assert(recv_kad_key->xnetwork_id()!=kRoot);
     pbft_message.set_is_root(false);
 
@@ -100,7 +100,7 @@ bool EcVHost::SyncMessageWhenStart(const vnetwork::xvnode_address_t & send_addre
     return false;
 }
 #endif
-void EcVHost::send_to(common::xip2_t const & src, common::xip2_t const & dst, xbyte_buffer_t const & byte_message, std::error_code & ec) const {
+void EcVHost::send_to(common::xip2_t const & src, common::xip2_t const & dst, xbyte_buffer_t const & byte_message, uint16_t priority, std::error_code & ec) const {
     assert((dst.network_id() & common::xbroadcast_id_t::network) != common::xbroadcast_id_t::network);
     assert((dst.zone_id() & common::xbroadcast_id_t::zone) != common::xbroadcast_id_t::zone);
     assert((dst.cluster_id() & common::xbroadcast_id_t::cluster) != common::xbroadcast_id_t::cluster);
@@ -115,10 +115,10 @@ void EcVHost::send_to(common::xip2_t const & src, common::xip2_t const & dst, xb
           dst.to_string().c_str(),
           send_kad_key->Get().c_str(),
           recv_kad_key->Get().c_str());
-    ec_netcard_->send_to(send_kad_key, recv_kad_key, byte_message, ec);
+    ec_netcard_->send_to(send_kad_key, recv_kad_key, byte_message, priority, ec);
 }
 
-void EcVHost::send_to_through_root(common::xip2_t const & src, common::xnode_id_t const & dst_node_id, xbyte_buffer_t const & byte_message, std::error_code & ec) const {
+void EcVHost::send_to_through_root(common::xip2_t const & src, common::xnode_id_t const & dst_node_id, xbyte_buffer_t const & byte_message, uint16_t priority, std::error_code & ec) const {
     assert(src.zone_id() == common::xfrozen_zone_id);
 
     auto kroot_rt = wrouter::MultiRouting::Instance()->GetRootRoutingTable();
@@ -134,10 +134,10 @@ void EcVHost::send_to_through_root(common::xip2_t const & src, common::xnode_id_
         auto recv_node = kroot_rt->GetRandomNode();
         recv_kad_key = base::GetKadmliaKey(recv_node->node_id);
     }
-    ec_netcard_->send_to(send_kad_key, recv_kad_key, byte_message, ec);
+    ec_netcard_->send_to(send_kad_key, recv_kad_key, byte_message, priority, ec);
 }
 
-void EcVHost::spread_rumor(common::xip2_t const & src, common::xip2_t const & dst, xbyte_buffer_t const & byte_message, std::error_code & ec) const {
+void EcVHost::spread_rumor(common::xip2_t const & src, common::xip2_t const & dst, xbyte_buffer_t const & byte_message, uint16_t priority, std::error_code & ec) const {
     assert((dst.network_id() & common::xbroadcast_id_t::network) != common::xbroadcast_id_t::network);
     assert((dst.zone_id() & common::xbroadcast_id_t::zone) != common::xbroadcast_id_t::zone);
     assert((dst.cluster_id() & common::xbroadcast_id_t::cluster) != common::xbroadcast_id_t::cluster);
@@ -152,7 +152,7 @@ void EcVHost::spread_rumor(common::xip2_t const & src, common::xip2_t const & ds
           dst.to_string().c_str(),
           send_kad_key->Get().c_str(),
           recv_kad_key->Get().c_str());
-    ec_netcard_->spread_rumor(send_kad_key, recv_kad_key, byte_message, ec);
+    ec_netcard_->spread_rumor(send_kad_key, recv_kad_key, byte_message, priority, ec);
 }
 
 void EcVHost::broadcast(common::xip2_t const & src, xbyte_buffer_t const & byte_message, std::error_code & ec) const {
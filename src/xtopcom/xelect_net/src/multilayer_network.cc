@@ -122,7 +122,10 @@ bool MultilayerNetwork::Init(const base::Config & config) {
         xerror("multi_message_handler empty");
         return false;
     }
-    multi_message_handler_->Init();
+    // optional,0 means default workers count of transport
+    uint32_t transport_worker_threads = 0;
+    config.Get("node", "transport_worker_threads", transport_worker_threads);
+    multi_message_handler_->Init(transport_worker_threads);
     RegisterCallbackForMultiThreadHandler(multi_message_handler_);
     // attention: InitWrouter must put befor core_transport->Start
     InitWrouter(core_transport_, multi_message_handler_);
@@ -471,6 +471,19 @@ bool xtop_cluster_element::exist_with_lock_hold_outside(common::xgroup_id_t cons
     return find_with_lock_hold_outside(group_id) != std::end(m_group_elements);
 }
 
+std::vector<std::shared_ptr<xgroup_element_t>> xtop_cluster_element::group_elements() const {
+    std::vector<std::shared_ptr<xgroup_element_t>> ret;
+
+    XLOCK(m_group_elements_mutex);
+    for (auto const & group_element_store : m_group_elements) {
+        auto const & group_info_store = top::get<xgroup_info_container_t>(group_element_store);
+        for (auto const & group_info : group_info_store) {
+            ret.push_back(top::get<std::shared_ptr<xgroup_element_t>>(group_info));
+        }
+    }
+    return ret;
+}
+
 bool xtop_cluster_element::exist_with_lock_hold_outside(common::xgroup_id_t const & group_id, common::xlogic_time_t const logic_time) const {
     auto const iterator = find_with_lock_hold_outside(group_id);
     if (iterator == std::end(m_group_elements)) {
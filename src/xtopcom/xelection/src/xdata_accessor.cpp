@@ -5,13 +5,16 @@
 #include "xelection/xcache/xdata_accessor.h"
 
 #include "xbase/xlog.h"
+#include "xbasic/xthreading/xutility.h"
 #include "xbasic/xutility.h"
 #include "xelection/xcache/xcluster_element.h"
 #include "xelection/xcache/xgroup_element.h"
 #include "xelection/xcache/xnode_element.h"
+#include "xelection/xcache/xzone_element.h"
 #include "xelection/xdata_accessor_error.h"
 
 #include <array>
+#include <atomic>
 #include <cassert>
 #include <cinttypes>
 #include <cstdint>
@@ -22,7 +25,7 @@
 NS_BEG3(top, election, cache)
 
 xtop_data_accessor::xtop_data_accessor(common::xnetwork_id_t const & network_id, observer_ptr<time::xchain_time_face_t> const & logic_timer)
-  : m_network_element{std::make_shared<xnetwork_element_t>(network_id)}, m_logic_timer{logic_timer} {
+  : m_network_element{std::make_shared<xnetwork_element_t>(network_id)}, m_logic_timer{logic_timer}, m_snapshot{std::make_shared<xelection_snapshot_t const>(0)} {
     assert(m_logic_timer != nullptr);
 }
 
@@ -70,24 +73,31 @@ std::unordered_map<common::xgroup_address_t, xgroup_update_result_t> xtop_data_a
         return {};
     }
 
+    std::unordered_map<common::xgroup_address_t, xgroup_update_result_t> ret;
     switch (zone_type) {
     case common::xnode_type_t::committee:
-        return update_committee_zone(zone_element, election_result_store, associated_blk_height, ec);
+        ret = update_committee_zone(zone_element, election_result_store, associated_blk_height, ec);
+        break;
 
     case common::xnode_type_t::consensus:
-        return update_consensus_zone(zone_element, election_result_store, associated_blk_height, ec);
+        ret = update_consensus_zone(zone_element, election_result_store, associated_blk_height, ec);
+        break;
 
     case common::xnode_type_t::edge:
-        return update_edge_zone(zone_element, election_result_store, associated_blk_height, ec);
+        ret = update_edge_zone(zone_element, election_result_store, associated_blk_height, ec);
+        break;
 
     case common::xnode_type_t::storage:
-        return update_storage_zone(zone_element, election_result_store, associated_blk_height, ec);
+        ret = update_storage_zone(zone_element, election_result_store, associated_blk_height, ec);
+        break;
 
     case common::xnode_type_t::zec:
-        return update_zec_zone(zone_element, election_result_store, associated_blk_height, ec);
+        ret = update_zec_zone(zone_element, election_result_store, associated_blk_height, ec);
+        break;
 
     case common::xnode_type_t::frozen:
-        return update_frozen_zone(zone_element, election_result_store, associated_blk_height, ec);
+        ret = update_frozen_zone(zone_element, election_result_store, associated_blk_height, ec);
+        break;
 
     default:
         ec = xdata_accessor_errc_t::invalid_node_type;
@@ -99,6 +109,11 @@ std::unordered_map<common::xgroup_address_t, xgroup_update_result_t> xtop_data_a
 
         return {};
     }
+
+    if (!ret.empty()) {
+        publish_snapshot();
+    }
+    return ret;
 }
 
 std::map<common::xslot_id_t, data::xnode_info_t> xtop_data_accessor::sharding_nodes(common::xgroup_address_t const & address,
@@ -117,6 +132,14 @@ std::map<common::xslot_id_t, data::xnode_info_t> xtop_data_accessor::sharding_no
         return {};
     }
 
+    if (!election_round.empty()) {
+        auto const snapshot = this->snapshot();
+        auto const * group_entry = snapshot->group(address, election_round);
+        if (group_entry != nullptr) {
+            return group_entry->nodes;
+        }
+    }
+
     auto group_element = this->group_element(address.network_id(), address.zone_id(), address.cluster_id(), address.group_id(), election_round, ec);
 
     if (ec) {
@@ -167,6 +190,14 @@ std::map<common::xslot_id_t, data::xnode_info_t> xtop_data_accessor::group_nodes
         return {};
     }
 
+    if (!group_logic_epoch.empty()) {
+        auto const snapshot = this->snapshot();
+        auto const * group_entry = snapshot->group(group_address, group_logic_epoch);
+        if (group_entry != nullptr) {
+            return group_entry->nodes;
+        }
+    }
+
     auto group_element = this->group_element(group_address.network_id(), group_address.zone_id(), group_address.cluster_id(), group_address.group_id(), group_logic_epoch, ec);
 
     if (ec) {
@@ -257,6 +288,17 @@ std::shared_ptr<xnode_element_t> xtop_data_accessor::node_element(common::xgroup
                                                      common::xslot_id_t const & slot_id,
                                                      std::error_code & ec) const {
     assert(!ec);
+    if (!logic_epoch.empty()) {
+        auto const snapshot = this->snapshot();
+        auto const * group_entry = snapshot->group(address, logic_epoch);
+        if (group_entry != nullptr) {
+            auto node_element = xelection_snapshot_t::node_element(*group_entry, slot_id);
+            if (node_element != nullptr) {
+                return node_element;
+            }
+        }
+    }
+
     auto const group_element = this->group_element(address.network_id(), address.zone_id(), address.cluster_id(), address.group_id(), logic_epoch, ec);
     if (ec) {
         xwarn("%s %s", ec.category().name(), ec.message().c_str());
@@ -269,6 +311,17 @@ std::shared_ptr<xnode_element_t> xtop_data_accessor::node_element(common::xgroup
 
 common::xaccount_address_t xtop_data_accessor::account_address_from(common::xip2_t const & xip2, std::error_code & ec) const {
     assert(!ec);
+    {
+        auto const snapshot = this->snapshot();
+        auto const * group_entry = snapshot->group(xip2);
+        if (group_entry != nullptr) {
+            auto const & node_element = xelection_snapshot_t::node_element(*group_entry, xip2.slot_id());
+            if (node_element != nullptr) {
+                return node_element->node_id();
+            }
+        }
+    }
+
     auto group_element = this->group_element_by_height(xip2.network_id(), xip2.zone_id(), xip2.cluster_id(), xip2.group_id(), xip2.height(), ec);
     if (ec) {
         xwarn("%s %s", ec.category().name(), ec.message().c_str());
@@ -401,6 +454,14 @@ std::shared_ptr<xgroup_element_t> xtop_data_accessor::parent_group_element(commo
 
 common::xelection_round_t xtop_data_accessor::election_epoch_from(common::xip2_t const & xip2, std::error_code & ec) const {
     assert(!ec);
+    {
+        auto const snapshot = this->snapshot();
+        auto const * group_entry = snapshot->group(xip2);
+        if (group_entry != nullptr) {
+            return group_entry->election_round;
+        }
+    }
+
     auto group_element = this->group_element_by_height(xip2.network_id(), xip2.zone_id(), xip2.cluster_id(), xip2.group_id(), xip2.height(), ec);
     if (ec) {
         xwarn("%s %s", ec.category().name(), ec.message().c_str());
@@ -411,6 +472,39 @@ common::xelection_round_t xtop_data_accessor::election_epoch_from(common::xip2_t
     return group_element->election_round();
 }
 
+std::shared_ptr<xelection_snapshot_t const> xtop_data_accessor::snapshot() const {
+    return std::atomic_load(&m_snapshot);
+}
+
+void xtop_data_accessor::publish_snapshot() {
+    assert(m_network_element != nullptr);
+
+    XLOCK(m_snapshot_update_mutex);
+    auto snapshot = std::make_shared<xelection_snapshot_t>(std::atomic_load(&m_snapshot)->version() + 1);
+
+    std::error_code ec;
+    auto const & zone_elements = m_network_element->children(ec);
+    for (auto const & zone_element_info : zone_elements) {
+        auto const & zone_element = top::get<std::shared_ptr<xzone_element_t>>(zone_element_info);
+
+        std::error_code ec1;
+        auto const & cluster_elements = zone_element->children(ec1);
+        for (auto const & cluster_element_info : cluster_elements) {
+            auto const & cluster_element = top::get<std::shared_ptr<xcluster_element_t>>(cluster_element_info);
+            for (auto const & group_element : cluster_element->group_elements()) {
+                common::xgroup_address_t group_address{group_element->network_id(), group_element->zone_id(), group_element->cluster_id(), group_element->group_id()};
+                snapshot->add_group(group_address, group_element);
+            }
+        }
+    }
+
+    xdbg("network %" PRIu32 " publishes election snapshot version %" PRIu64 " with %zu groups",
+         static_cast<std::uint32_t>(m_network_element->network_id().value()),
+         snapshot->version(),
+         snapshot->group_count());
+    std::atomic_store(&m_snapshot, std::shared_ptr<xelection_snapshot_t const>{std::move(snapshot)});
+}
+
 std::unordered_map<common::xgroup_address_t, xgroup_update_result_t> xtop_data_accessor::update_zone(std::shared_ptr<xzone_element_t> const & zone_element,
                                                                                                         data::election::xelection_result_store_t const & election_result_store,
                                                                                                         std::uint64_t const associated_blk_height,
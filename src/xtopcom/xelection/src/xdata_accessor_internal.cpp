@@ -30,6 +30,14 @@ xtop_data_accessor::group_element(common::xnetwork_id_t const & network_id,
     assert(!ec);
     assert(m_logic_timer != nullptr);
 
+    if (!election_round.empty()) {
+        auto const snapshot = this->snapshot();
+        auto const * group_entry = snapshot->group(common::xgroup_address_t{network_id, zone_id, cluster_id, group_id}, election_round);
+        if (group_entry != nullptr) {
+            return group_entry->group_element;
+        }
+    }
+
     auto cluster_element = this->cluster_element(network_id, zone_id, cluster_id, ec);
     if (ec) {
         xwarn("%s %s", ec.category().name(), ec.message().c_str());
@@ -52,6 +60,14 @@ std::shared_ptr<xgroup_element_t> xtop_data_accessor::group_element(common::xnet
     assert(!ec);
     assert(m_logic_timer != nullptr);
 
+    if (!logic_epoch.empty()) {
+        auto const snapshot = this->snapshot();
+        auto const * group_entry = snapshot->group(common::xgroup_address_t{network_id, zone_id, cluster_id, group_id}, logic_epoch);
+        if (group_entry != nullptr) {
+            return group_entry->group_element;
+        }
+    }
+
     auto cluster_element = this->cluster_element(network_id, zone_id, cluster_id, ec);
     if (ec) {
         xwarn("%s %s", ec.category().name(), ec.message().c_str());
@@ -75,6 +91,12 @@ xtop_data_accessor::group_element_by_height(common::xnetwork_id_t const & networ
     assert(!ec);
     assert(m_logic_timer != nullptr);
 
+    auto const snapshot = this->snapshot();
+    auto const * group_entry = snapshot->group_by_height(common::xgroup_address_t{network_id, zone_id, cluster_id, group_id}, election_blk_height);
+    if (group_entry != nullptr) {
+        return group_entry->group_element;
+    }
+
     auto cluster_element = this->cluster_element(network_id, zone_id, cluster_id, ec);
     if (ec) {
         xwarn("%s %s", ec.category().name(), ec.message().c_str());
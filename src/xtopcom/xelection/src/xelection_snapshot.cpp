@@ -0,0 +1,117 @@
+// Copyright (c) 2017-2018 Telos Foundation & contributors
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "xelection/xcache/xelection_snapshot.h"
+
+#include "xelection/xcache/xgroup_element.h"
+#include "xelection/xcache/xnode_element.h"
+
+#include <cassert>
+
+NS_BEG3(top, election, cache)
+
+xtop_election_snapshot::xtop_election_snapshot(std::uint64_t const version) : m_version{version} {
+}
+
+std::uint64_t xtop_election_snapshot::version() const noexcept {
+    return m_version;
+}
+
+std::size_t xtop_election_snapshot::group_count() const noexcept {
+    std::size_t count{0};
+    for (auto const & groups : m_groups) {
+        count += top::get<std::vector<xgroup_entry_t>>(groups).size();
+    }
+    return count;
+}
+
+void xtop_election_snapshot::add_group(common::xgroup_address_t const & group_address, std::shared_ptr<xgroup_element_t> const & group_element) {
+    assert(group_element != nullptr);
+
+    std::error_code ec;
+    auto const & node_elements = group_element->children(ec);
+    if (ec) {
+        return;
+    }
+
+    xgroup_entry_t group_entry;
+    group_entry.group_element = group_element;
+    group_entry.logic_epoch = group_element->logic_epoch();
+    group_entry.election_round = group_element->election_round();
+    group_entry.associated_blk_height = group_element->associated_blk_height();
+    for (auto const & node_element_info : node_elements) {
+        auto const & slot_id = top::get<common::xslot_id_t const>(node_element_info);
+        auto const & node_element = top::get<std::shared_ptr<xnode_element_t>>(node_element_info);
+
+        data::xnode_info_t node_info;
+        node_info.election_info = node_element->election_info();
+        node_info.address = node_element->address();
+        group_entry.nodes.insert({slot_id, std::move(node_info)});
+
+        if (group_entry.slot_nodes.size() <= slot_id.value()) {
+            group_entry.slot_nodes.resize(slot_id.value() + 1);
+        }
+        group_entry.slot_nodes[slot_id.value()] = node_element;
+    }
+
+    m_groups[group_address].push_back(std::move(group_entry));
+}
+
+xtop_election_snapshot::xgroup_entry_t const * xtop_election_snapshot::group(common::xgroup_address_t const & group_address,
+                                                                            common::xlogic_epoch_t const & logic_epoch) const noexcept {
+    auto const it = m_groups.find(group_address);
+    if (it == std::end(m_groups)) {
+        return nullptr;
+    }
+
+    for (auto const & group_entry : top::get<std::vector<xgroup_entry_t>>(*it)) {
+        if (group_entry.logic_epoch == logic_epoch) {
+            return &group_entry;
+        }
+    }
+    return nullptr;
+}
+
+xtop_election_snapshot::xgroup_entry_t const * xtop_election_snapshot::group(common::xgroup_address_t const & group_address,
+                                                                            common::xelection_round_t const & election_round) const noexcept {
+    auto const it = m_groups.find(group_address);
+    if (it == std::end(m_groups)) {
+        return nullptr;
+    }
+
+    for (auto const & group_entry : top::get<std::vector<xgroup_entry_t>>(*it)) {
+        if (group_entry.election_round == election_round) {
+            return &group_entry;
+        }
+    }
+    return nullptr;
+}
+
+xtop_election_snapshot::xgroup_entry_t const * xtop_election_snapshot::group_by_height(common::xgroup_address_t const & group_address,
+                                                                                      std::uint64_t const election_blk_height) const noexcept {
+    auto const it = m_groups.find(group_address);
+    if (it == std::end(m_groups)) {
+        return nullptr;
+    }
+
+    for (auto const & group_entry : top::get<std::vector<xgroup_entry_t>>(*it)) {
+        if (group_entry.associated_blk_height == election_blk_height) {
+            return &group_entry;
+        }
+    }
+    return nullptr;
+}
+
+xtop_election_snapshot::xgroup_entry_t const * xtop_election_snapshot::group(common::xip2_t const & xip2) const noexcept {
+    return group_by_height(common::xgroup_address_t{xip2.network_id(), xip2.zone_id(), xip2.cluster_id(), xip2.group_id()}, xip2.height());
+}
+
+std::shared_ptr<xnode_element_t> xtop_election_snapshot::node_element(xgroup_entry_t const & group_entry, common::xslot_id_t const & slot_id) noexcept {
+    if (common::broadcast(slot_id) || group_entry.slot_nodes.size() <= slot_id.value()) {
+        return nullptr;
+    }
+    return group_entry.slot_nodes[slot_id.value()];
+}
+
+NS_END3
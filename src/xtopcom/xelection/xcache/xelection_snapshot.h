@@ -0,0 +1,68 @@
+// Copyright (c) 2017-2018 Telos Foundation & contributors
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#pragma once
+
+#include "xcommon/xaddress.h"
+#include "xcommon/xip.h"
+#include "xdata/xnode_info.h"
+#include "xelection/xcache/xelement_fwd.h"
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+NS_BEG3(top, election, cache)
+
+/**
+ * @brief immutable view of all groups kept by the election cache.
+ *        the data accessor builds a new one on every election update and publishes it as a whole,
+ *        so readers holding a snapshot look up groups and slots without taking any element lock.
+ */
+class xtop_election_snapshot {
+public:
+    using xgroup_nodes_t = std::map<common::xslot_id_t, data::xnode_info_t>;
+
+    class xtop_group_entry {
+    public:
+        std::shared_ptr<xgroup_element_t> group_element{};
+        common::xlogic_epoch_t logic_epoch{};
+        common::xelection_round_t election_round{};
+        std::uint64_t associated_blk_height{};
+        xgroup_nodes_t nodes{};
+        std::vector<std::shared_ptr<xnode_element_t>> slot_nodes{};  // indexed by slot id
+    };
+    using xgroup_entry_t = xtop_group_entry;
+
+private:
+    std::uint64_t m_version{0};
+    std::unordered_map<common::xgroup_address_t, std::vector<xgroup_entry_t>> m_groups{};
+
+public:
+    xtop_election_snapshot(xtop_election_snapshot const &) = delete;
+    xtop_election_snapshot & operator=(xtop_election_snapshot const &) = delete;
+    xtop_election_snapshot(xtop_election_snapshot &&) = default;
+    xtop_election_snapshot & operator=(xtop_election_snapshot &&) = default;
+    ~xtop_election_snapshot() = default;
+
+    explicit xtop_election_snapshot(std::uint64_t const version);
+
+    std::uint64_t version() const noexcept;
+    std::size_t group_count() const noexcept;
+
+    /// @brief only used while building, before the snapshot is published.
+    void add_group(common::xgroup_address_t const & group_address, std::shared_ptr<xgroup_element_t> const & group_element);
+
+    xgroup_entry_t const * group(common::xgroup_address_t const & group_address, common::xlogic_epoch_t const & logic_epoch) const noexcept;
+    xgroup_entry_t const * group(common::xgroup_address_t const & group_address, common::xelection_round_t const & election_round) const noexcept;
+    xgroup_entry_t const * group_by_height(common::xgroup_address_t const & group_address, std::uint64_t const election_blk_height) const noexcept;
+    xgroup_entry_t const * group(common::xip2_t const & xip2) const noexcept;
+
+    static std::shared_ptr<xnode_element_t> node_element(xgroup_entry_t const & group_entry, common::xslot_id_t const & slot_id) noexcept;
+};
+using xelection_snapshot_t = xtop_election_snapshot;
+
+NS_END3
@@ -0,0 +1,64 @@
+// Copyright (c) 2017-2019 Telos Foundation & contributors
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#pragma once
+
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+
+namespace top {
+
+namespace gossip {
+
+// lock free duplicate filter of 32 bits message hash with fixed memory.
+// open addressing table of atomic slots, each slot keeps the hash and the period it is added in.
+// a hash is duplicate while it is added in current or last period, Rotate() starts next period
+// and older slots become free without clearing memory.
+class DuplicateFilter {
+public:
+    // capacity is rounded up to power of 2
+    explicit DuplicateFilter(uint32_t capacity);
+    DuplicateFilter(const DuplicateFilter &) = delete;
+    DuplicateFilter & operator=(const DuplicateFilter &) = delete;
+
+    // true if key is added in current or last period, otherwise add it and return false
+    bool CheckAndAdd(uint32_t key);
+    void Rotate();
+
+    uint32_t Capacity() const {
+        return mask_ + 1;
+    }
+    // keys of current and last period, scans the whole table
+    uint32_t CountLive() const;
+    // keys not added since all probed slots are live
+    uint64_t OverflowCount() const {
+        return overflow_count_.load(std::memory_order_relaxed);
+    }
+    // keys found duplicate by CheckAndAdd
+    uint64_t DuplicateCount() const {
+        return duplicate_count_.load(std::memory_order_relaxed);
+    }
+
+private:
+    static const uint32_t kMaxProbe = 32;
+
+    uint32_t Index(uint32_t key) const;
+    static bool IsLive(uint64_t slot, uint32_t period) {
+        return (slot >> 32) + 1 >= period;
+    }
+
+    uint32_t bits_{0};
+    uint32_t mask_{0};
+    std::unique_ptr<std::atomic<uint64_t>[]> slots_;
+    // starts from 2, so zero slots(period 0) are never live
+    std::atomic<uint32_t> period_{2};
+    std::atomic<uint64_t> overflow_count_{0};
+    std::atomic<uint64_t> duplicate_count_{0};
+};
+
+}  // namespace gossip
+
+}  // namespace top
@@ -4,10 +4,11 @@
 
 #pragma once
 
-#include <unordered_map>
-#include <vector>
+#include <map>
 #include <memory>
+#include <mutex>
 
+#include "xgossip/include/duplicate_filter.h"
 #include "xtransport/proto/transport.pb.h"
 
 namespace top {
@@ -18,20 +19,18 @@ class TimerRepeated;
 
 namespace gossip {
 
-static const uint32_t kRepeatedValue = 1;
-static const uint64_t kClearRstPeriod = 30ll * 1000ll * 1000ll; // 5 seconds
-typedef std::shared_ptr<std::unordered_map<uint32_t, uint32_t>> HashMapPtr;
+static const uint64_t kClearRstPeriod = 30ll * 1000ll * 1000ll; // 30 seconds
+static const uint32_t kFilterExpectedMessagesPerSecond = 4096;
 
 class GossipFilter {
 public:
     static GossipFilter* Instance();
 
-    bool Init();
+    // filter keeps messages of two periods, table is sized for twice that many messages
+    bool Init(uint32_t expected_messages_per_second = kFilterExpectedMessagesPerSecond);
     bool FilterMessage(transport::protobuf::RoutingMessage& message);
 
 protected:
-    bool AddData(uint32_t);
-    bool FindData(uint32_t);
     void do_clear_and_reset();
     void AddRepeatMsg(uint32_t key);
     void PrintRepeatMap();
@@ -42,9 +41,7 @@ private:
 
 private:
     bool inited_{false};
-    std::vector<HashMapPtr> time_filter_;
-    std::mutex current_index_mutex_;
-    uint32_t current_index_;
+    std::unique_ptr<DuplicateFilter> filter_;
     std::shared_ptr<base::TimerRepeated> timer_{nullptr};
     std::mutex repeat_map_mutex_;
     std::map<uint32_t, uint32_t> repeat_map_;
@@ -0,0 +1,80 @@
+// Copyright (c) 2017-2019 Telos Foundation & contributors
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "xgossip/include/duplicate_filter.h"
+
+namespace top {
+
+namespace gossip {
+
+DuplicateFilter::DuplicateFilter(uint32_t capacity) {
+    bits_ = 10;
+    while (bits_ < 31 && (1u << bits_) < capacity) {
+        ++bits_;
+    }
+    mask_ = (1u << bits_) - 1;
+    slots_.reset(new std::atomic<uint64_t>[mask_ + 1]);
+    for (uint32_t i = 0; i <= mask_; ++i) {
+        slots_[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+uint32_t DuplicateFilter::Index(uint32_t key) const {
+    // fibonacci hashing, spread keys differing in high bits only
+    return static_cast<uint32_t>((static_cast<uint64_t>(key) * 0x9E3779B97F4A7C15ull) >> (64 - bits_));
+}
+
+bool DuplicateFilter::CheckAndAdd(uint32_t key) {
+    const uint32_t period = period_.load(std::memory_order_acquire);
+    const uint64_t value = (static_cast<uint64_t>(period) << 32) | key;
+    for (;;) {
+        bool has_free = false;
+        uint32_t free_index = 0;
+        uint64_t free_slot = 0;
+        uint32_t index = Index(key);
+        for (uint32_t i = 0; i < kMaxProbe; ++i, index = (index + 1) & mask_) {
+            uint64_t slot = slots_[index].load(std::memory_order_acquire);
+            if (!IsLive(slot, period)) {
+                if (!has_free) {
+                    has_free = true;
+                    free_index = index;
+                    free_slot = slot;
+                }
+                continue;
+            }
+            if (static_cast<uint32_t>(slot) == key) {
+                duplicate_count_.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+
+        if (!has_free) {
+            overflow_count_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        if (slots_[free_index].compare_exchange_strong(free_slot, value, std::memory_order_acq_rel)) {
+            return false;
+        }
+        // slot taken by other thread, maybe for the same key, probe again
+    }
+}
+
+void DuplicateFilter::Rotate() {
+    period_.fetch_add(1, std::memory_order_acq_rel);
+}
+
+uint32_t DuplicateFilter::CountLive() const {
+    const uint32_t period = period_.load(std::memory_order_acquire);
+    uint32_t count = 0;
+    for (uint32_t i = 0; i <= mask_; ++i) {
+        if (IsLive(slots_[i].load(std::memory_order_relaxed), period)) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+}  // namespace gossip
+
+}  // namespace top
@@ -4,11 +4,13 @@
 
 #include "xgossip/include/gossip_filter.h"
 
+#include <algorithm>
 #include <cassert>
 
 #include "xpbase/base/top_log.h"
 #include "xpbase/base/top_timer.h"
 #include "xpbase/base/kad_key/kadmlia_key.h"
+#include "xmetrics/xmetrics.h"
 
 namespace top {
 
@@ -21,12 +23,11 @@ GossipFilter* GossipFilter::Instance() {
     return &ins;
 }
 
-bool GossipFilter::Init() {
+bool GossipFilter::Init(uint32_t expected_messages_per_second) {
     assert(!inited_);
-    for (uint32_t i = 0; i < 3; ++i) {
-        auto hash_ptr = std::make_shared<std::unordered_map<uint32_t, uint32_t>>();
-        time_filter_.push_back(hash_ptr);
-    }
+    uint64_t capacity = 2 * 2 * expected_messages_per_second * (kClearRstPeriod / (1000ll * 1000ll));
+    filter_.reset(new DuplicateFilter(static_cast<uint32_t>(std::min<uint64_t>(capacity, 1u << 31))));
+    TOP_INFO("gossipfilter capacity:%u memory:%u bytes", filter_->Capacity(), filter_->Capacity() * (uint32_t)sizeof(uint64_t));
     timer_ = std::make_shared<base::TimerRepeated>(base::TimerManager::Instance(), "GossipFilter");
     timer_->Start(
             500ll * 1000ll,
@@ -107,68 +108,25 @@ bool GossipFilter::FilterMessage(transport::protobuf::RoutingMessage& message) {
     AddRepeatMsg(message.msg_hash());
 #endif
 
-    if (FindData(message.msg_hash())) {
-        //TOP_DEBUG("GossipFilter FindData, filter msg");
-        return true;
-    }
-    if (!AddData(message.msg_hash())) {
-        TOP_WARN("GossipFilter already exist, filter msg");
-        return true;
-    }
-    return false;
-}
-
-bool GossipFilter::FindData(uint32_t key) {
-    assert(current_index_ < 3 && current_index_ >= 0);
-    std::unique_lock<std::mutex> lock(current_index_mutex_);
-    auto it_find = time_filter_[current_index_]->find(key);
-    if (it_find != time_filter_[current_index_]->end()) {
-        return it_find->second >= kRepeatedValue;
-    }
-    // last available index
-    uint32_t last_index = (current_index_ + 2) % 3;
-    auto last_it_find = time_filter_[last_index]->find(key);
-    if (last_it_find != time_filter_[last_index]->end()) {
-        return last_it_find->second >= kRepeatedValue;
-    }
-    return false;
-}
-
-bool GossipFilter::AddData(uint32_t key) {
-    assert(current_index_ < 3 && current_index_ >= 0);
-    std::unique_lock<std::mutex> lock(current_index_mutex_);
-    auto it_find = time_filter_[current_index_]->find(key);
-    if (it_find != time_filter_[current_index_]->end()) {
-        if (it_find->second >= kRepeatedValue) {
-            return false;
-        }
-        ++it_find->second;
-        return true;
-    }
-
-    // last available index
-    uint32_t last_index = (current_index_ + 2) % 3;
-    auto last_it_find = time_filter_[last_index]->find(key);
-    if (last_it_find != time_filter_[last_index]->end()) {
-        if (last_it_find->second >= kRepeatedValue) {
-            return false;
-        }
-        ++last_it_find->second;
-        return true;
-    }
-
-    time_filter_[current_index_]->insert(std::make_pair(key, 1));
-    return true;
+    return filter_->CheckAndAdd(message.msg_hash());
 }
 
 void GossipFilter::do_clear_and_reset() {
-    {
-        assert(current_index_ < 3 && current_index_ >= 0);
-        std::unique_lock<std::mutex> lock(current_index_mutex_);
-        uint32_t not_used_index = (current_index_ + 1) % 3;
-        time_filter_[not_used_index]->clear();
-        current_index_ = not_used_index;
-    }
+    filter_->Rotate();
+
+    // messages never sent twice pass unless their 32 bits hash equals a live one,
+    // so false positive rate of a new message is live / 2^32
+    uint32_t live = filter_->CountLive();
+    uint64_t load_permille = (uint64_t)live * 1000 / filter_->Capacity();
+    uint64_t false_positive_ppb = ((uint64_t)live * 1000000000ull) >> 32;
+    XMETRICS_COUNTER_SET("gossip_filter_entries", live);
+    XMETRICS_COUNTER_SET("gossip_filter_load_permille", load_permille);
+    XMETRICS_COUNTER_SET("gossip_filter_false_positive_ppb", false_positive_ppb);
+    XMETRICS_COUNTER_SET("gossip_filter_overflow", filter_->OverflowCount());
+    XMETRICS_COUNTER_SET("gossip_filter_duplicate", filter_->DuplicateCount());
+    TOP_DEBUG("gossipfilter rotate live:%u load:%u permille overflow:%llu duplicate:%llu",
+            live, (uint32_t)load_permille, (unsigned long long)filter_->OverflowCount(),
+            (unsigned long long)filter_->DuplicateCount());
 }
 
 } // end namespace gossip
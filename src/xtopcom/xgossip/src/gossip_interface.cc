@@ -48,13 +48,13 @@ void GossipInterface::Send(transport::protobuf::RoutingMessage & message, const
         TOP_WARN2("wrouter message SerializeToString failed");
         return;
     }
-    auto each_call = [this, &data](kadmlia::NodeInfoPtr node_info_ptr) {
+    auto each_call = [this, &data, &message](kadmlia::NodeInfoPtr node_info_ptr) {
         if (!node_info_ptr) {
             TOP_WARN2("kadmlia::NodeInfoPtr null");
             return false;
         }
 
-        if (kadmlia::kKadSuccess != transport_ptr_->SendDataWithProp(data, node_info_ptr->public_ip, node_info_ptr->public_port, node_info_ptr->udp_property)) {
+        if (kadmlia::kKadSuccess != transport_ptr_->SendDataWithProp(data, node_info_ptr->public_ip, node_info_ptr->public_port, node_info_ptr->udp_property, message.priority())) {
             TOP_WARN2("SendData to  endpoint(%s:%d) failed", node_info_ptr->public_ip.c_str(), node_info_ptr->public_port);
             return false;
         }
@@ -66,21 +66,29 @@ void GossipInterface::Send(transport::protobuf::RoutingMessage & message, const
 }
 
 // usually for root-broadcast
+// des_node_id is the only field differing per node, so serialize the message once without it
+// and append des_node_id for each node rather than serializing the (often block) payload again.
 void GossipInterface::MutableSend(transport::protobuf::RoutingMessage & message, const std::vector<kadmlia::NodeInfoPtr> & nodes) {
-    auto each_call = [this, &message](kadmlia::NodeInfoPtr node_info_ptr) {
+    std::string last_des_node_id = message.des_node_id();
+    message.clear_des_node_id();
+    std::string body;
+    if (!message.SerializeToString(&body)) {
+        TOP_WARN2("wrouter message SerializeToString failed");
+        message.set_des_node_id(last_des_node_id);
+        return;
+    }
+
+    std::string data;
+    auto each_call = [this, &message, &body, &data, &last_des_node_id](kadmlia::NodeInfoPtr node_info_ptr) {
         if (!node_info_ptr) {
             TOP_WARN2("kadmlia::NodeInfoPtr null");
             return false;
         }
 
-        message.set_des_node_id(node_info_ptr->node_id);
-        std::string data;
-        if (!message.SerializeToString(&data)) {
-            TOP_WARN2("wrouter message SerializeToString failed");
-            return false;
-        }
-
-        if (kadmlia::kKadSuccess != transport_ptr_->SendDataWithProp(data, node_info_ptr->public_ip, node_info_ptr->public_port, node_info_ptr->udp_property)) {
+        data.assign(body);
+        transport::AppendLengthDelimitedField(data, transport::protobuf::RoutingMessage::kDesNodeIdFieldNumber, node_info_ptr->node_id);
+        last_des_node_id = node_info_ptr->node_id;
+        if (kadmlia::kKadSuccess != transport_ptr_->SendDataWithProp(data, node_info_ptr->public_ip, node_info_ptr->public_port, node_info_ptr->udp_property, message.priority())) {
             TOP_WARN2("SendData to  endpoint(%s:%d) failed", node_info_ptr->public_ip.c_str(), node_info_ptr->public_port);
             return false;
         }
@@ -89,6 +97,7 @@ void GossipInterface::MutableSend(transport::protobuf::RoutingMessage & message,
     };
 
     std::for_each(nodes.begin(), nodes.end(), each_call);
+    message.set_des_node_id(last_des_node_id);
 }
 
 // usually for root-broadcast hash
@@ -100,13 +109,13 @@ void GossipInterface::MutableSendHash(transport::protobuf::RoutingMessage & mess
         return;
     }
 
-    auto each_call = [this, &data](kadmlia::NodeInfoPtr node_info_ptr) {
+    auto each_call = [this, &data, &message](kadmlia::NodeInfoPtr node_info_ptr) {
         if (!node_info_ptr) {
             TOP_WARN2("kadmlia::NodeInfoPtr null");
             return false;
         }
 
-        if (kadmlia::kKadSuccess != transport_ptr_->SendDataWithProp(data, node_info_ptr->public_ip, node_info_ptr->public_port, node_info_ptr->udp_property)) {
+        if (kadmlia::kKadSuccess != transport_ptr_->SendDataWithProp(data, node_info_ptr->public_ip, node_info_ptr->public_port, node_info_ptr->udp_property, message.priority())) {
             TOP_WARN2("SendData to  endpoint(%s:%d) failed", node_info_ptr->public_ip.c_str(), node_info_ptr->public_port);
             return false;
         }
@@ -133,7 +142,22 @@ std::vector<kadmlia::NodeInfoPtr> GossipInterface::GetRandomNodes(std::vector<ka
     return std::vector<kadmlia::NodeInfoPtr>{neighbors.begin(), neighbors.begin() + number_to_get};
 }
 
+// only sit1/sit2 of gossip params differ per node, so serialize the message once without gossip params
+// and append the small gossip params for each node.
 void GossipInterface::SendDispatch(transport::protobuf::RoutingMessage & message, const std::vector<gossip::DispatchInfos> & dispatch_nodes) {
+    transport::protobuf::GossipParams gossip_params;
+    gossip_params.Swap(message.mutable_gossip());
+    message.clear_gossip();
+    std::string body;
+    bool serialized = message.SerializeToString(&body);
+    message.mutable_gossip()->Swap(&gossip_params);
+    if (!serialized) {
+        xwarn("wrouter message SerializeToString failed");
+        return;
+    }
+
+    std::string data;
+    std::string gossip_data;
     for (uint32_t i = 0; i < dispatch_nodes.size(); ++i) {
         auto nodes = dispatch_nodes[i].nodes;
         auto gossip = message.mutable_gossip();
@@ -142,13 +166,14 @@ void GossipInterface::SendDispatch(transport::protobuf::RoutingMessage & message
         gossip->set_sit2(dispatch_nodes[i].sit2);
         xdbg("[debug] send to %s:%d % " PRIu64 " % " PRIu64, nodes->public_ip.c_str(), nodes->public_port, dispatch_nodes[i].sit1, dispatch_nodes[i].sit2);
 
-        std::string data;
-        if (!message.SerializeToString(&data)) {
+        if (!gossip->SerializeToString(&gossip_data)) {
             xwarn("wrouter message SerializeToString failed");
             return;
         }
+        data.assign(body);
+        transport::AppendLengthDelimitedField(data, transport::protobuf::RoutingMessage::kGossipFieldNumber, gossip_data);
 
-        if (kadmlia::kKadSuccess != transport_ptr_->SendDataWithProp(data, nodes->public_ip, nodes->public_port, nodes->udp_property)) {
+        if (kadmlia::kKadSuccess != transport_ptr_->SendDataWithProp(data, nodes->public_ip, nodes->public_port, nodes->udp_property, message.priority())) {
             xinfo("SendDispatch send to (%s:%d) failed % " PRIu64 " % " PRIu64, nodes->public_ip.c_str(), nodes->public_port, dispatch_nodes[i].sit1, dispatch_nodes[i].sit2);
             continue;
         }
@@ -73,6 +73,10 @@ char const * matrics_name(xmetrics_tag_t const tag) noexcept {
         RETURN_METRICS_NAME(db_read_tick);
         RETURN_METRICS_NAME(db_write_tick);
         RETURN_METRICS_NAME(db_delete_tick);
+        RETURN_METRICS_NAME(db_write_pipeline_queue_depth);
+        RETURN_METRICS_NAME(db_write_pipeline_batch_size);
+        RETURN_METRICS_NAME(db_write_pipeline_batch_bytes);
+        RETURN_METRICS_NAME(db_write_pipeline_commit_tick);
 
         // consensus
         RETURN_METRICS_NAME(cons_drand_leader_finish_succ);
@@ -123,6 +127,7 @@ char const * matrics_name(xmetrics_tag_t const tag) noexcept {
         RETURN_METRICS_NAME(cons_tablemaker_make_proposal_tick);
         RETURN_METRICS_NAME(cons_tablemaker_check_state_tick);
         RETURN_METRICS_NAME(cons_tablemaker_refresh_cache);
+        RETURN_METRICS_NAME(cons_tablemaker_parallel_make_unit_tick);
 
         RETURN_METRICS_NAME(cons_table_leader_get_txpool_tx_count);
         RETURN_METRICS_NAME(cons_table_leader_get_txpool_sendtx_count);
@@ -237,6 +242,7 @@ char const * matrics_name(xmetrics_tag_t const tag) noexcept {
 
         RETURN_METRICS_NAME(message_transport_recv);
         RETURN_METRICS_NAME(message_transport_send);
+        RETURN_METRICS_NAME(message_transport_worker_drop);
 
         // sync 
         RETURN_METRICS_NAME(xsync_recv_new_block);
@@ -488,6 +494,8 @@ char const * matrics_name(xmetrics_tag_t const tag) noexcept {
         RETURN_METRICS_NAME(statestore_get_table_state_succ);
         RETURN_METRICS_NAME(statestore_get_table_state_from_cache);
         RETURN_METRICS_NAME(statestore_get_table_state_with_table_count);
+        RETURN_METRICS_NAME(statestore_unit_replay_depth);
+        RETURN_METRICS_NAME(statestore_unit_checkpoint_write);
 
         RETURN_METRICS_NAME(state_load_blk_state_suc);
         RETURN_METRICS_NAME(state_load_blk_state_cache_suc);
@@ -576,6 +584,7 @@ char const * matrics_name(xmetrics_tag_t const tag) noexcept {
         RETURN_METRICS_NAME(cpu_ca_verify_multi_sign_tc);
         RETURN_METRICS_NAME(cpu_ca_verify_multi_sign_blockstore);
         RETURN_METRICS_NAME(cpu_merkle_hash_calc);
+        RETURN_METRICS_NAME(cpu_merkle_input_index_hit);
         RETURN_METRICS_NAME(cpu_hash_256_xecprikey_calc);
         RETURN_METRICS_NAME(cpu_hash_256_XudpSocket_calc);
         RETURN_METRICS_NAME(cpu_hash_256_GetRootKadmliaKey_calc);
@@ -87,6 +87,10 @@ enum E_SIMPLE_METRICS_TAG : size_t {
     db_read_tick,
     db_write_tick,
     db_delete_tick,
+    db_write_pipeline_queue_depth,
+    db_write_pipeline_batch_size,
+    db_write_pipeline_batch_bytes,
+    db_write_pipeline_commit_tick,
 
     // consensus
     cons_drand_leader_finish_succ,// TODO(jimmy) delete future
@@ -139,6 +143,7 @@ enum E_SIMPLE_METRICS_TAG : size_t {
     cons_tablemaker_make_proposal_tick,
     cons_tablemaker_check_state_tick,
     cons_tablemaker_refresh_cache,
+    cons_tablemaker_parallel_make_unit_tick,
 
     cons_table_leader_get_txpool_tx_count,
     cons_table_leader_get_txpool_sendtx_count,
@@ -263,6 +268,7 @@ enum E_SIMPLE_METRICS_TAG : size_t {
 
     message_transport_recv,
     message_transport_send,
+    message_transport_worker_drop,
 
     // sync 
     xsync_recv_new_block,
@@ -534,6 +540,8 @@ enum E_SIMPLE_METRICS_TAG : size_t {
     statestore_get_table_state_succ,
     statestore_get_table_state_from_cache,
     statestore_get_table_state_with_table_count,
+    statestore_unit_replay_depth,
+    statestore_unit_checkpoint_write,
 
     state_load_blk_state_suc,
     state_load_blk_state_cache_suc,
@@ -628,6 +636,7 @@ enum E_SIMPLE_METRICS_TAG : size_t {
     cpu_ca_verify_multi_sign_tc,
     cpu_ca_verify_multi_sign_blockstore,
     cpu_merkle_hash_calc,
+    cpu_merkle_input_index_hit,
     cpu_hash_256_xecprikey_calc,
     cpu_hash_256_XudpSocket_calc,
     cpu_hash_256_GetRootKadmliaKey_calc,
@@ -0,0 +1,31 @@
+#include "../test_common.h"
+
+NS_BEG2(top, xmutisig)
+
+TEST_F(test_schnorr_mutisig, adjust_aggregated_pubkey) {
+    const size_t signer_count = 64;
+    std::vector<xpubkey *> old_signers(m_pubkeys.begin(), m_pubkeys.begin() + signer_count);
+    std::shared_ptr<xpubkey> old_agg_pub = xmutisig::aggregate_pubkeys(old_signers, m_schnorr);
+    ASSERT_NE(old_agg_pub, nullptr);
+
+    // drop signer 3 & 10, add signer 64 & 65
+    std::vector<xpubkey *> new_signers;
+    for (size_t i = 0; i < signer_count + 2; i++) {
+        if (i != 3 && i != 10) {
+            new_signers.push_back(m_pubkeys[i]);
+        }
+    }
+    std::shared_ptr<xpubkey> expect_agg_pub = xmutisig::aggregate_pubkeys(new_signers, m_schnorr);
+
+    std::vector<const xpubkey *> adds{m_pubkeys[signer_count], m_pubkeys[signer_count + 1]};
+    std::vector<const xpubkey *> subs{m_pubkeys[3], m_pubkeys[10]};
+    std::shared_ptr<xpubkey> adjusted_agg_pub = xmutisig::adjust_aggregated_pubkey(*old_agg_pub, adds, subs, m_schnorr);
+    ASSERT_NE(adjusted_agg_pub, nullptr);
+    EXPECT_EQ(adjusted_agg_pub->get_serialize_str(), expect_agg_pub->get_serialize_str());
+
+    // nothing changed
+    std::shared_ptr<xpubkey> same_agg_pub = xmutisig::adjust_aggregated_pubkey(*old_agg_pub, {}, {}, m_schnorr);
+    EXPECT_EQ(same_agg_pub->get_serialize_str(), old_agg_pub->get_serialize_str());
+}
+
+NS_END2
@@ -0,0 +1,38 @@
+#include "../test_common.h"
+
+NS_BEG2(top, xmutisig)
+
+TEST_F(test_schnorr_mutisig, verify_sign_batch) {
+    const int batch_count = 16;
+    std::vector<std::string> msgs;
+    std::vector<const xpubkey *> pubkeys;
+    std::vector<std::string> sign_strs;
+    std::vector<std::string> point_strs;
+    for (int i = 0; i < batch_count; i++) {
+        std::string ctx = "verify_sign_batch_msg_" + std::to_string(i);
+        std::string sign_str;
+        xmutisig::xmutisig::sign(ctx, *m_privkeys[i], sign_str, *m_secrets[i], *m_points[i], m_schnorr);
+
+        msgs.push_back(ctx);
+        pubkeys.push_back(m_pubkeys[i]);
+        sign_strs.push_back(sign_str);
+        point_strs.push_back(m_points[i]->get_serialize_str());
+    }
+    EXPECT_TRUE(xmutisig::xmutisig::verify_sign_batch(msgs, pubkeys, sign_strs, point_strs, m_schnorr));
+
+    // signature of other message must break whole batch
+    std::vector<std::string> bad_sign_strs = sign_strs;
+    std::swap(bad_sign_strs[3], bad_sign_strs[7]);
+    EXPECT_FALSE(xmutisig::xmutisig::verify_sign_batch(msgs, pubkeys, bad_sign_strs, point_strs, m_schnorr));
+
+    // wrong signer
+    std::vector<const xpubkey *> bad_pubkeys = pubkeys;
+    bad_pubkeys[batch_count - 1] = m_pubkeys[batch_count];
+    EXPECT_FALSE(xmutisig::xmutisig::verify_sign_batch(msgs, bad_pubkeys, sign_strs, point_strs, m_schnorr));
+
+    // unmatched size
+    msgs.pop_back();
+    EXPECT_FALSE(xmutisig::xmutisig::verify_sign_batch(msgs, pubkeys, sign_strs, point_strs, m_schnorr));
+}
+
+NS_END2
@@ -46,6 +46,18 @@ public:
                             const std::string &point,
                             xschnorr * _schnorr);
 
+    /*
+    * verify many sign pair<sign, point> together, true only if all are good
+    * msgs/pubkeys/signs/points: be parallel to each other
+    * note: false does not tell which one is bad, verify_sign them one by one for that
+    */
+
+    static bool verify_sign_batch(const std::vector<std::string> &msgs,
+                                  const std::vector<const xpubkey *> &pubkeys,
+                                  const std::vector<std::string> &signs,
+                                  const std::vector<std::string> &points,
+                                  xschnorr * _schnorr);
+
 public:
 
     /*
@@ -90,6 +102,14 @@ public:
 
     static std::shared_ptr<xpubkey> aggregate_pubkeys(const std::vector<xpubkey *> &pubkeys,xschnorr * _schnorr);
     static std::shared_ptr<xpubkey> aggregate_pubkeys_2(const std::vector<xpubkey> &pubkeys,xschnorr * _schnorr);
+    /*
+    * derive a new aggregated pubkey from an old one: agg_pub + sum(adds) - sum(subs)
+    * cheaper than aggregate all again when only a few signers are different
+    */
+    static std::shared_ptr<xpubkey> adjust_aggregated_pubkey(const xpubkey &agg_pub,
+                                                             const std::vector<const xpubkey *> &adds,
+                                                             const std::vector<const xpubkey *> &subs,
+                                                             xschnorr * _schnorr);
 
     static std::shared_ptr<xsignature> aggregate_signs(const std::vector<xsignature *> &signs,xschnorr * _schnorr);
 
@@ -74,6 +74,51 @@ bool xmutisig::verify_sign(const std::string &msg,
 
 }
 
+bool xmutisig::verify_sign_batch(const std::vector<std::string> &msgs,
+                                 const std::vector<const xpubkey *> &pubkeys,
+                                 const std::vector<std::string> &sign_strs,
+                                 const std::vector<std::string> &point_strs,
+                                 xschnorr * _schnorr) {
+    const size_t count = msgs.size();
+    if (0 == count || pubkeys.size() != count || sign_strs.size() != count || point_strs.size() != count || nullptr == _schnorr) {
+        return false;
+    }
+    if (1 == count) {
+        return verify_sign(msgs[0], *pubkeys[0], sign_strs[0], point_strs[0], _schnorr);
+    }
+
+    std::vector<xsignature> signs;
+    std::vector<xrand_point> points;
+    signs.reserve(count);
+    points.reserve(count);
+    std::vector<const xsignature *> sign_ptrs;
+    std::vector<const xrand_point *> point_ptrs;
+    std::vector<BIGNUM *> objects;
+    bool result = true;
+    for (size_t i = 0; i < count; i++) {
+        signs.emplace_back(sign_strs[i]);
+        points.emplace_back(point_strs[i]);
+        BIGNUM * bn = generate_object_bn(msgs[i], _schnorr);
+        if (nullptr == bn) {
+            result = false;
+            break;
+        }
+        objects.push_back(bn);
+    }
+    if (result) {
+        for (size_t i = 0; i < count; i++) {
+            sign_ptrs.push_back(&signs[i]);
+            point_ptrs.push_back(&points[i]);
+        }
+        result = _schnorr->verify_mutisign_batch(sign_ptrs, pubkeys, objects, point_ptrs);
+    }
+
+    for (auto bn : objects) {
+        BN_free(bn);
+    }
+    return result;
+}
+
 uint32_t xmutisig::sign_base(const xsecret_rand &rand,
 							 BIGNUM* object,
 							 const xprikey &prikey,
@@ -300,6 +345,39 @@ std::shared_ptr<xpubkey> xmutisig::aggregate_pubkeys(const std::vector<xpubkey *
 
 }
 
+std::shared_ptr<xpubkey> xmutisig::adjust_aggregated_pubkey(const xpubkey &agg_pub,
+                                                            const std::vector<const xpubkey *> &adds,
+                                                            const std::vector<const xpubkey *> &subs,
+                                                            xschnorr * _schnorr) {
+    xassert(nullptr != _schnorr);
+    if (nullptr == _schnorr || nullptr == _schnorr->curve()) {
+        return nullptr;
+    }
+    const EC_GROUP * ec_group = _schnorr->curve()->ec_group();
+    std::shared_ptr<xpubkey> new_agg_pub = std::make_shared<xpubkey>(agg_pub);
+    for (auto pub : adds) {
+        if (EC_POINT_add(ec_group, new_agg_pub->ec_point(), new_agg_pub->ec_point(), pub->ec_point(), NULL) != 1) {
+            return nullptr;
+        }
+    }
+    if (subs.empty()) {
+        return new_agg_pub;
+    }
+
+    std::unique_ptr<EC_POINT, void(*)(EC_POINT*)> neg_point(EC_POINT_new(ec_group), EC_POINT_free);
+    if (nullptr == neg_point) {
+        return nullptr;
+    }
+    for (auto pub : subs) {
+        if (EC_POINT_copy(neg_point.get(), pub->ec_point()) != 1 ||
+            EC_POINT_invert(ec_group, neg_point.get(), NULL) != 1 ||
+            EC_POINT_add(ec_group, new_agg_pub->ec_point(), new_agg_pub->ec_point(), neg_point.get(), NULL) != 1) {
+            return nullptr;
+        }
+    }
+    return new_agg_pub;
+}
+
 std::shared_ptr<xpubkey> xmutisig::aggregate_pubkeys_2(const std::vector<xpubkey> &pubkeys,xschnorr * _schnorr) {
     xassert(0 != pubkeys.size());
     xassert(nullptr != _schnorr);
@@ -114,6 +114,86 @@ bool xschnorr::verify_mutisign(const xsignature &mutisign,
     return result;
 }
 
+bool xschnorr::verify_mutisign_batch(const std::vector<const xsignature *> &signs,
+                                     const std::vector<const xpubkey *> &pubkeys,
+                                     const std::vector<BIGNUM *> &objects,
+                                     const std::vector<const xrand_point *> &points) {
+    const size_t count = signs.size();
+    if (count == 0 || pubkeys.size() != count || objects.size() != count || points.size() != count || m_curve == nullptr) {
+        return false;
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (nullptr == signs[i] || nullptr == pubkeys[i] || nullptr == objects[i] || nullptr == points[i] || !signature_bignum_legal(*signs[i])) {
+            return false;
+        }
+        // point of bad pubkey or bad point string is null,EC_POINTs_mul can not take it
+        if (nullptr == pubkeys[i]->ec_point() || nullptr == points[i]->ec_point()) {
+            return false;
+        }
+    }
+
+    std::unique_ptr<BN_CTX, void(*)(BN_CTX*)> bn_ctx(generate_bn_ctx(), BN_CTX_free);
+    std::unique_ptr<BIGNUM, void(*)(BIGNUM*)> sum_sign(BN_new(), BN_free);
+    std::unique_ptr<BIGNUM, void(*)(BIGNUM*)> coef(BN_new(), BN_free);
+    std::unique_ptr<EC_POINT, void(*)(EC_POINT*)> result_point(generate_ec_point(), EC_POINT_free);
+    if (nullptr == bn_ctx || nullptr == sum_sign || nullptr == coef || nullptr == result_point) {
+        return false;
+    }
+    BN_zero(sum_sign.get());
+
+    // 2 terms per signature: (a_i * e_i) * P_i and (-a_i) * R_i
+    std::vector<const EC_POINT *> ec_points;
+    std::vector<BIGNUM *> scalars;
+    ec_points.reserve(count * 2);
+    scalars.reserve(count * 2);
+    auto free_scalars = [&scalars]() {
+        for (auto bn : scalars) {
+            BN_free(bn);
+        }
+    };
+
+    bool ok = true;
+    for (size_t i = 0; ok && i < count; i++) {
+        // first coefficient could be 1 without losing safety,saves a little work
+        if (i == 0) {
+            ok = (BN_one(coef.get()) == 1);
+        } else {
+            do {
+                ok = (BN_rand(coef.get(), 128, -1, 0) == 1);
+            } while (ok && BN_is_zero(coef.get()));
+        }
+
+        BIGNUM * pub_scalar = BN_new();
+        BIGNUM * point_scalar = BN_new();
+        if (nullptr != pub_scalar)
+            scalars.push_back(pub_scalar);
+        if (nullptr != point_scalar)
+            scalars.push_back(point_scalar);
+        ok = ok && (nullptr != pub_scalar) && (nullptr != point_scalar) &&
+             (BN_mod_mul(pub_scalar, coef.get(), objects[i], m_curve->bn_order(), bn_ctx.get()) == 1) &&
+             (BN_mod_sub(point_scalar, m_curve->bn_order(), coef.get(), m_curve->bn_order(), bn_ctx.get()) == 1);
+        if (!ok)
+            break;
+        ec_points.push_back(pubkeys[i]->ec_point());
+        ec_points.push_back(points[i]->ec_point());
+
+        // sum_sign += a_i * s_i
+        std::unique_ptr<BIGNUM, void(*)(BIGNUM*)> weighted_sign(BN_new(), BN_free);
+        ok = (nullptr != weighted_sign) &&
+             (BN_mod_mul(weighted_sign.get(), coef.get(), signs[i]->bn_value(), m_curve->bn_order(), bn_ctx.get()) == 1) &&
+             (BN_mod_add(sum_sign.get(), sum_sign.get(), weighted_sign.get(), m_curve->bn_order(), bn_ctx.get()) == 1);
+    }
+
+    bool result = false;
+    if (ok) {
+        int ret = EC_POINTs_mul(m_curve->ec_group(), result_point.get(), sum_sign.get(), ec_points.size(), ec_points.data(), (const BIGNUM **)scalars.data(), bn_ctx.get());
+        xassert(0 != ret);
+        result = (ret == 1) && (EC_POINT_is_at_infinity(m_curve->ec_group(), result_point.get()) == 1);
+    }
+    free_scalars();
+    return result;
+}
+
 BIGNUM* xschnorr::generate_nonzero_bn() {
 
     BIGNUM* new_bn = BN_new();
@@ -37,6 +37,18 @@ public:
                          BIGNUM* object,
                          const xrand_point &agg_point);
 
+    /*
+    * verify many signatures together by random linear combination:
+    * sum(a_i * s_i) * G + sum(a_i * e_i * P_i) - sum(a_i * R_i) == infinity
+    * a_i is random 128bit number, so forged signatures can not cancel each other.
+    * one multi-scalar multiplication instead of one EC_POINT_mul per signature,
+    * return false if any one is bad, caller should fall back to verify_mutisign one by one to find it
+    */
+    bool verify_mutisign_batch(const std::vector<const xsignature *> &signs,
+                               const std::vector<const xpubkey *> &pubkeys,
+                               const std::vector<BIGNUM *> &objects,
+                               const std::vector<const xrand_point *> &points);
+
     uint32_t sign(const std::string &object, const xprikey &prikey, xsignature &signature);
 
 public:
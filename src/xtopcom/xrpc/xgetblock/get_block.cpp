@@ -17,6 +17,7 @@
 #include "xdata/xtable_bstate.h"
 #include "xdata/xfull_tableblock.h"
 #include "xrouter/xrouter.h"
+#include "xrpc/xgetblock/xblock_json_cache.h"
 #include "xrpc/xuint_format.h"
 #include "xstake/xstake_algorithm.h"
 #include "xstore/xaccount_context.h"
@@ -1331,11 +1332,11 @@ static std::unordered_map<common::xnode_type_t, std::string> node_type_map{
     { common::xnode_type_t::storage_full_node, "full_node" }
 };
 
-void get_block_handle::set_addition_info(xJson::Value & body, xblock_t * bp) {
+bool get_block_handle::set_addition_info(xJson::Value & body, xblock_t * bp) {
     auto _bstate = base::xvchain_t::instance().get_xstatestore()->get_blkstate_store()->get_block_state(bp, metrics::statestore_access_from_rpc_set_addition);
     if (nullptr == _bstate) {
         xwarn("get_block_handle::set_addition_info get target state fail.block=%s", bp->dump().c_str());
-        return;
+        return false;
     }
     data::xunit_bstate_t state(_bstate.get());
     std::string elect_data;
@@ -1415,11 +1416,15 @@ void get_block_handle::set_addition_info(xJson::Value & body, xblock_t * bp) {
         }
         body["elect_transaction"] = jv;
     }
+    return true;
 }
 
-void get_block_handle::set_fullunit_state(xJson::Value & j_fu, data::xblock_t * bp) {
+bool get_block_handle::set_fullunit_state(xJson::Value & j_fu, data::xblock_t * bp) {
     base::xauto_ptr<base::xvbstate_t> bstate = base::xvchain_t::instance().get_xstatestore()->get_blkstate_store()->get_block_state(bp, metrics::statestore_access_from_rpc_set_fullunit);
-    xassert(bstate != nullptr);
+    if (nullptr == bstate) {
+        xwarn("get_block_handle::set_fullunit_state get target state fail.block=%s", bp->dump().c_str());
+        return false;
+    }
     data::xunit_bstate_t unitstate(bstate.get());
 
     j_fu["latest_send_trans_number"] = static_cast<unsigned int>(unitstate.account_send_trans_number());
@@ -1428,21 +1433,24 @@ void get_block_handle::set_fullunit_state(xJson::Value & j_fu, data::xblock_t *
     j_fu["account_balance"] = static_cast<unsigned int>(unitstate.balance());
     j_fu["burned_amount_change"] = static_cast<unsigned int>(unitstate.burn_balance());
     j_fu["account_create_time"] = static_cast<unsigned int>(unitstate.get_account_create_time());
+    return true;
 }
 
-void get_block_handle::set_body_info(xJson::Value & body, xblock_t * bp, const std::string & rpc_version) {
+bool get_block_handle::set_body_info(xJson::Value & body, xblock_t * bp, const std::string & rpc_version) {
     auto block_level = bp->get_block_level();
 
     base::xvaccount_t _vaccount(bp->get_account());
     base::xvchain_t::instance().get_xblockstore()->load_block_input(_vaccount, bp, metrics::blockstore_access_from_rpc_get_block_set_table);
     bp->parse_to_json(body, rpc_version);
+    bool complete = true;
     if (block_level == base::enum_xvblock_level_unit) {
-        set_addition_info(body, bp);
+        complete = set_addition_info(body, bp);
         auto block_class = bp->get_block_class();
         if (block_class == base::enum_xvblock_class_full) {
-            set_fullunit_state(body["fullunit"], bp);
+            complete = set_fullunit_state(body["fullunit"], bp) && complete;
         }
     }
+    return complete;
 }
 
 xJson::Value get_block_handle::get_block_json(xblock_t * bp, const std::string & rpc_version) {
@@ -1456,6 +1464,12 @@ xJson::Value get_block_handle::get_block_json(xblock_t * bp, const std::string &
         return root;
     }
 
+    // committed block never changes,so its json is built once and served from cache
+    bool const cacheable = bp->check_block_flag(base::enum_xvblock_flag_committed);
+    if (cacheable && xblock_json_cache_t::instance().get(bp->get_account(), bp->get_height(), rpc_version, bp->get_block_hash(), root)) {
+        return root;
+    }
+
     // load input for raw tx get
     if (false == base::xvchain_t::instance().get_xblockstore()->load_block_input(base::xvaccount_t(bp->get_account()) ,bp, metrics::blockstore_access_from_rpc_get_block_json)) {
         xassert(false);  // db block should always load input success
@@ -1469,10 +1483,14 @@ xJson::Value get_block_handle::get_block_json(xblock_t * bp, const std::string &
     root["header"] = header;
 
     xJson::Value body;
-    set_body_info(body, bp, rpc_version);
+    bool const complete = set_body_info(body, bp, rpc_version);
 
     root["body"] = body;
 
+    // partial json is still returned,but not cached so next query rebuilds it
+    if (cacheable && complete) {
+        xblock_json_cache_t::instance().put(bp->get_account(), bp->get_height(), rpc_version, bp->get_block_hash(), root);
+    }
     return root;
 }
 
@@ -130,9 +130,10 @@ private:
     void set_header_info(xJson::Value & header, data::xblock_t * bp);
 
     void set_property_info(xJson::Value & jph, const std::map<std::string, std::string> & ph);
-    void set_addition_info(xJson::Value & body, data::xblock_t * bp);
-    void set_fullunit_state(xJson::Value & body, data::xblock_t * bp);
-    void set_body_info(xJson::Value & body, data::xblock_t * bp, const std::string & rpc_version);
+    bool set_addition_info(xJson::Value & body, data::xblock_t * bp);
+    bool set_fullunit_state(xJson::Value & body, data::xblock_t * bp);
+    // return false when part of body is missing,e.g. block state is not ready
+    bool set_body_info(xJson::Value & body, data::xblock_t * bp, const std::string & rpc_version);
 
     void getGeneralInfos();
     void getRootblockInfo();
@@ -0,0 +1,105 @@
+// Copyright (c) 2017-2018 Telos Foundation & contributors
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "xrpc/xgetblock/xblock_json_cache.h"
+
+#include "xbase/xlog.h"
+#include "xmetrics/xmetrics.h"
+
+#include <cinttypes>
+#include <iterator>
+
+namespace top {
+
+namespace chain_info {
+
+constexpr std::size_t block_json_cache_max_bytes{64 * 1024 * 1024};
+
+xblock_json_cache_t::xblock_json_cache_t(std::size_t const max_bytes) : m_max_bytes{max_bytes} {
+}
+
+xblock_json_cache_t & xblock_json_cache_t::instance() {
+    static xblock_json_cache_t cache{block_json_cache_max_bytes};
+    return cache;
+}
+
+std::string xblock_json_cache_t::make_key(std::string const & account, uint64_t const height, std::string const & rpc_version) {
+    return account + ":" + std::to_string(height) + ":" + rpc_version;
+}
+
+bool xblock_json_cache_t::get(std::string const & account, uint64_t const height, std::string const & rpc_version, std::string const & block_hash, xJson::Value & value) {
+    std::shared_ptr<xJson::Value const> cached;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_index.find(make_key(account, height, rpc_version));
+        if (it == m_index.end()) {
+            XMETRICS_COUNTER_INCREMENT("rpc_block_json_cache_miss", 1);
+            return false;
+        }
+
+        if (it->second->block_hash != block_hash) {
+            // the cached block is replaced(e.g. fork revocation)
+            xinfo("xblock_json_cache_t::get block changed,drop cached json. account=%s,height=%" PRIu64, account.c_str(), height);
+            erase_entry(it->second);
+            XMETRICS_COUNTER_INCREMENT("rpc_block_json_cache_miss", 1);
+            return false;
+        }
+
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+        cached = it->second->value;
+    }
+
+    // copy out of lock,big table block json may take a while
+    value = *cached;
+    XMETRICS_COUNTER_INCREMENT("rpc_block_json_cache_hit", 1);
+    return true;
+}
+
+void xblock_json_cache_t::put(std::string const & account, uint64_t const height, std::string const & rpc_version, std::string const & block_hash, xJson::Value const & value) {
+    // one time serialization to know the real size of the response
+    std::size_t const bytes = xJson::FastWriter().write(value).size() + block_hash.size();
+    if (bytes > m_max_bytes / 16) {
+        xdbg("xblock_json_cache_t::put json too big to cache. account=%s,height=%" PRIu64 ",bytes=%zu", account.c_str(), height, bytes);
+        return;
+    }
+
+    xentry_t entry;
+    entry.key = make_key(account, height, rpc_version);
+    entry.block_hash = block_hash;
+    entry.value = std::make_shared<xJson::Value const>(value);
+    entry.bytes = bytes;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_index.find(entry.key);
+    if (it != m_index.end()) {
+        erase_entry(it->second);
+    }
+
+    m_entries.push_front(std::move(entry));
+    m_index[m_entries.front().key] = m_entries.begin();
+    m_bytes += bytes;
+    while (m_bytes > m_max_bytes && !m_entries.empty()) {
+        erase_entry(std::prev(m_entries.end()));
+    }
+    XMETRICS_COUNTER_SET("rpc_block_json_cache_bytes", m_bytes);
+}
+
+std::size_t xblock_json_cache_t::size() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entries.size();
+}
+
+std::size_t xblock_json_cache_t::bytes() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_bytes;
+}
+
+void xblock_json_cache_t::erase_entry(xentry_list_t::iterator it) {
+    m_bytes -= it->bytes;
+    m_index.erase(it->key);
+    m_entries.erase(it);
+}
+
+}  // namespace chain_info
+}  // namespace top
@@ -0,0 +1,59 @@
+// Copyright (c) 2017-2018 Telos Foundation & contributors
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#pragma once
+
+#include "json/json.h"
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace top {
+
+namespace chain_info {
+
+/**
+ * @brief LRU of block json of committed blocks, bounded by serialized bytes.
+ *        key is (account, height, rpc_version). block hash is kept with the json, so a block replaced by fork
+ *        revocation never hits and its entry is dropped on next lookup.
+ */
+class xblock_json_cache_t {
+public:
+    explicit xblock_json_cache_t(std::size_t const max_bytes);
+    xblock_json_cache_t(xblock_json_cache_t const &) = delete;
+    xblock_json_cache_t & operator=(xblock_json_cache_t const &) = delete;
+
+    static xblock_json_cache_t & instance();
+
+    bool get(std::string const & account, uint64_t const height, std::string const & rpc_version, std::string const & block_hash, xJson::Value & value);
+    void put(std::string const & account, uint64_t const height, std::string const & rpc_version, std::string const & block_hash, xJson::Value const & value);
+
+    std::size_t size() const;
+    std::size_t bytes() const;
+
+private:
+    struct xentry_t {
+        std::string key;
+        std::string block_hash;
+        std::shared_ptr<xJson::Value const> value;
+        std::size_t bytes{0};
+    };
+    using xentry_list_t = std::list<xentry_t>;
+
+    static std::string make_key(std::string const & account, uint64_t const height, std::string const & rpc_version);
+    void erase_entry(xentry_list_t::iterator it);
+
+    mutable std::mutex m_mutex;
+    xentry_list_t m_entries;  // most recently used at front
+    std::unordered_map<std::string, xentry_list_t::iterator> m_index;
+    std::size_t m_bytes{0};
+    std::size_t m_max_bytes;
+};
+
+}  // namespace chain_info
+}  // namespace top
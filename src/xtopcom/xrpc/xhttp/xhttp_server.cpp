@@ -5,10 +5,13 @@
 #include "xrpc/xhttp/xhttp_server.h"
 
 #include "xbasic/xmemory.hpp"
+#include "xconfig/xconfig_register.h"
+#include "xconfig/xpredefined_configurations.h"
 #include "xmetrics/xmetrics.h"
 #include "xrpc/xratelimit/xratelimit_data.h"
 #include "xrpc/xratelimit/xratelimit_data_queue.h"
 
+#include <algorithm>
 #include <iostream>
 #include <regex>
 NS_BEG2(top, xrpc)
@@ -16,6 +19,7 @@ NS_BEG2(top, xrpc)
 HttpServer xhttp_server::m_server;
 unique_ptr<xrpc_service<xedge_http_method>> xhttp_server::m_rpc_service = nullptr;
 bool xhttp_server::m_is_running = false;
+unique_ptr<xhttp_worker_pool> xhttp_server::m_worker_pool = nullptr;
 
 using namespace top::xChainRPC;
 xhttp_server::xhttp_server(shared_ptr<xrpc_edge_vhost> edge_vhost,
@@ -45,7 +49,15 @@ void xhttp_server::start(uint16_t nPort, uint32_t nThreadNum) {
     m_is_running = true;
     m_server.config.port = nPort;
     m_server.config.reuse_address = true;
-    m_server.config.thread_pool_size = nThreadNum;
+    if (nThreadNum == 0) {
+        nThreadNum = XGET_CONFIG(http_io_threads);
+    }
+    m_server.config.thread_pool_size = std::max<uint32_t>(nThreadNum, 1);
+
+    // io threads only accept, parse and write back. handlers(e.g. block queries reading db) run on workers,
+    // a connection reads its next request after response is sent, so keep-alive pipelined requests keep their order.
+    m_worker_pool = top::make_unique<xhttp_worker_pool>(XGET_CONFIG(http_worker_threads), XGET_CONFIG(http_worker_queue_size), XGET_CONFIG(http_method_max_concurrency));
+    m_worker_pool->start();
 
     m_server.resource["/"]["POST"] = std::bind(&xhttp_server::start_service, this, std::placeholders::_1, std::placeholders::_2);
     m_server.resource["/"]["OPTIONS"] = [](shared_ptr<HttpServer::Response> response, shared_ptr<HttpServer::Request>) {
@@ -67,7 +79,7 @@ void xhttp_server::start(uint16_t nPort, uint32_t nThreadNum) {
     });
 
     m_server_thread.detach();
-    xdbg("rpc_service http_server started: %d", nPort);
+    xdbg("rpc_service http_server started: %d, io threads: %u", nPort, nThreadNum);
 
     if (m_enable_ratelimit) {
         m_config.SetRatePerSecond(10 * 1000);
@@ -83,7 +95,8 @@ void xhttp_server::start(uint16_t nPort, uint32_t nThreadNum) {
             asio::ip::address_v4 addr_v4(dynamic_cast<RatelimitDataHttp *>(data)->ip_);
             asio::ip::address addr(addr_v4);
             auto ip_s = addr.to_string();
-            m_rpc_service->execute(dynamic_cast<RatelimitDataHttp *>(data)->response_, dynamic_cast<RatelimitDataHttp *>(data)->content_, ip_s);
+            RatelimitDataHttp * data_http = dynamic_cast<RatelimitDataHttp *>(data);
+            self->dispatch(data_http->response_, std::move(data_http->content_), ip_s);
             delete data;
         });
         m_ratelimit->RegistResponseOut([self = shared_from_this()](RatelimitData * data) {
@@ -132,7 +145,20 @@ void xhttp_server::start_service(std::shared_ptr<SimpleWeb::ServerBase<SimpleWeb
     } else {
         // ipv4 expressed in ipv6 format: ::ffff:192.168.20.9
         auto ip_s = addr.to_string().substr(7);
-        m_rpc_service->execute(response, content, ip_s);
+        dispatch(response, std::move(content), ip_s);
+    }
+}
+
+void xhttp_server::dispatch(shared_ptr<SimpleWeb::ServerBase<SimpleWeb::HTTP>::Response> response, std::string content, std::string ip) {
+    std::string method = RatelimitServerHelper::GetPostParam(content, "method=");
+    std::string sequence_id = RatelimitServerHelper::GetSequenceId(content);
+    bool submitted = m_worker_pool->submit(method, [response, content = std::move(content), ip = std::move(ip)]() mutable {
+        m_rpc_service->execute(response, content, ip);
+    });
+    if (!submitted) {
+        char info[256] = {0};
+        snprintf(info, 256, "{\"errmsg\":\"server busy.\",\"errno\":111,\"sequence_id\":\"%s\"}", sequence_id.c_str());
+        response->write(info);
     }
 }
 
@@ -19,6 +19,7 @@
 #include "simplewebserver/server_http.hpp"
 #include "xrpc/xrpc_service.hpp"
 #include "xrpc/xratelimit/xratelimit_server.h"
+#include "xrpc/xhttp/xhttp_worker_pool.h"
 
 NS_BEG2(top, xrpc)
 using std::thread;
@@ -35,14 +36,19 @@ public:
                  observer_ptr<base::xvtxstore_t> txstore = nullptr,
                  observer_ptr<elect::ElectMain> elect_main = nullptr,
                  observer_ptr<election::cache::xdata_accessor_face_t> const & election_cache_data_accessor = nullptr);
-    void start(uint16_t nPort, uint32_t nThreadNum = 1);
+    // nThreadNum: io threads accepting and parsing requests, 0 for http_io_threads of config
+    void start(uint16_t nPort, uint32_t nThreadNum = 0);
     void start_service(shared_ptr<SimpleWeb::ServerBase<SimpleWeb::HTTP>::Response> response, shared_ptr<SimpleWeb::ServerBase<SimpleWeb::HTTP>::Request> request);
     ~xhttp_server();
     xedge_http_method* get_edge_method() { return m_rpc_service->m_edge_method_mgr_ptr.get(); }
 private:
+    // execute request on worker pool, reply busy error if rejected
+    void dispatch(shared_ptr<SimpleWeb::ServerBase<SimpleWeb::HTTP>::Response> response, std::string content, std::string ip);
+
     static HttpServer                                   m_server;
     static unique_ptr<xrpc_service<xedge_http_method>>  m_rpc_service;
     static bool                                         m_is_running;
+    static unique_ptr<xhttp_worker_pool>                m_worker_pool;
     thread                                          m_server_thread;
     RatelimitConfig                                 m_config;
     unique_ptr<RatelimitServer>                     m_ratelimit{ nullptr };
@@ -0,0 +1,162 @@
+// Copyright (c) 2017-2018 Telos Foundation & contributors
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "xrpc/xhttp/xhttp_worker_pool.h"
+
+#include "xbase/xlog.h"
+#include "xmetrics/xmetrics.h"
+
+#include <algorithm>
+
+NS_BEG2(top, xrpc)
+
+xhttp_worker_pool::xhttp_worker_pool(uint32_t worker_threads, std::size_t max_queue_size, uint32_t method_max_concurrency)
+  : m_worker_threads{std::max<uint32_t>(worker_threads, 1)}
+  , m_max_queue_size{std::max<std::size_t>(max_queue_size, 1)}
+  , m_method_max_concurrency{std::max<uint32_t>(method_max_concurrency, 1)} {
+}
+
+xhttp_worker_pool::~xhttp_worker_pool() {
+    stop();
+}
+
+void xhttp_worker_pool::start() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_running) {
+        return;
+    }
+    m_running = true;
+    for (uint32_t i = 0; i < m_worker_threads; i++) {
+        m_threads.emplace_back(&xhttp_worker_pool::run, this);
+    }
+    xinfo("xhttp_worker_pool::start workers=%u,max_queue_size=%zu,method_max_concurrency=%u", m_worker_threads, m_max_queue_size, m_method_max_concurrency);
+}
+
+void xhttp_worker_pool::stop() {
+    std::vector<std::thread> threads;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_running) {
+            return;
+        }
+        m_running = false;
+        threads.swap(m_threads);
+        m_methods.clear();
+        m_ready_methods.clear();
+        m_queue_size = 0;
+    }
+    m_cv.notify_all();
+    for (auto & thread : threads) {
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+}
+
+void xhttp_worker_pool::set_method_limit(std::string const & method, uint32_t limit) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto & state = method_state(method);
+    state.limit = std::max<uint32_t>(limit, 1);
+    state.custom_limit = true;
+    make_ready(method, state);
+}
+
+bool xhttp_worker_pool::submit(std::string const & method, task_t task) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_running) {
+            return false;
+        }
+        if (m_queue_size >= m_max_queue_size) {
+            XMETRICS_COUNTER_INCREMENT("rpc_http_worker_reject", 1);
+            xwarn("xhttp_worker_pool::submit queue full,reject request. method=%s,queue_size=%zu", method.c_str(), m_queue_size);
+            return false;
+        }
+
+        auto & state = method_state(method);
+        state.tasks.push_back(std::move(task));
+        m_queue_size++;
+        make_ready(method, state);
+    }
+    m_cv.notify_one();
+    return true;
+}
+
+std::size_t xhttp_worker_pool::queue_size() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_queue_size;
+}
+
+uint32_t xhttp_worker_pool::running(std::string const & method) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_methods.find(method);
+    return it == m_methods.end() ? 0 : it->second.running;
+}
+
+void xhttp_worker_pool::run() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for (;;) {
+        m_cv.wait(lock, [this] { return !m_running || !m_ready_methods.empty(); });
+        if (!m_running) {
+            return;
+        }
+
+        std::string method = std::move(m_ready_methods.front());
+        m_ready_methods.pop_front();
+        auto & state = method_state(method);
+        state.ready = false;
+        if (state.tasks.empty() || state.running >= state.limit) {
+            continue;
+        }
+        task_t task = std::move(state.tasks.front());
+        state.tasks.pop_front();
+        state.running++;
+        m_queue_size--;
+        // round robin between methods
+        make_ready(method, state);
+        XMETRICS_COUNTER_SET("rpc_http_worker_queue", m_queue_size);
+
+        lock.unlock();
+        try {
+            task();
+        } catch (std::exception const & e) {
+            xwarn("xhttp_worker_pool::run method %s exception:%s", method.c_str(), e.what());
+        } catch (...) {
+            xwarn("xhttp_worker_pool::run method %s unknown exception", method.c_str());
+        }
+        lock.lock();
+
+        if (!m_running) {
+            return;
+        }
+        auto & done_state = method_state(method);
+        done_state.running--;
+        if (done_state.tasks.empty() && done_state.running == 0 && !done_state.custom_limit) {
+            // method name comes from request,do not keep state of idle methods
+            m_methods.erase(method);
+            continue;
+        }
+        make_ready(method, done_state);
+        if (done_state.ready) {
+            m_cv.notify_one();
+        }
+    }
+}
+
+xhttp_worker_pool::xmethod_state_t & xhttp_worker_pool::method_state(std::string const & method) {
+    auto & state = m_methods[method];
+    if (state.limit == 0) {
+        state.limit = m_method_max_concurrency;
+    }
+    return state;
+}
+
+void xhttp_worker_pool::make_ready(std::string const & method, xmethod_state_t & state) {
+    if (!state.ready && !state.tasks.empty() && state.running < state.limit) {
+        state.ready = true;
+        m_ready_methods.push_back(method);
+    }
+}
+
+NS_END2
@@ -0,0 +1,71 @@
+// Copyright (c) 2017-2018 Telos Foundation & contributors
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#pragma once
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "xrpc/xrpc_define.h"
+
+NS_BEG2(top, xrpc)
+
+/**
+ * @brief bounded pool executing rpc requests off the io threads.
+ *        requests are queued per method and at most method limit requests of one method run at the same time,
+ *        so slow methods(e.g. block queries hitting db) can not occupy all workers. methods with queued requests
+ *        are served round robin. request is rejected when total queued requests reach max queue size.
+ */
+class xhttp_worker_pool {
+public:
+    using task_t = std::function<void()>;
+
+    xhttp_worker_pool(uint32_t worker_threads, std::size_t max_queue_size, uint32_t method_max_concurrency);
+    xhttp_worker_pool(xhttp_worker_pool const &) = delete;
+    xhttp_worker_pool & operator=(xhttp_worker_pool const &) = delete;
+    ~xhttp_worker_pool();
+
+    void start();
+    // queued but not executed requests are dropped
+    void stop();
+    // override default concurrency limit of one method
+    void set_method_limit(std::string const & method, uint32_t limit);
+    // false if queue is full or pool is stopped, task is not executed then
+    bool submit(std::string const & method, task_t task);
+
+    std::size_t queue_size() const;
+    uint32_t running(std::string const & method) const;
+
+private:
+    struct xmethod_state_t {
+        std::deque<task_t> tasks;
+        uint32_t running{0};
+        uint32_t limit{0};
+        bool custom_limit{false};
+        bool ready{false};  // in m_ready_methods
+    };
+
+    void run();
+    xmethod_state_t & method_state(std::string const & method);
+    void make_ready(std::string const & method, xmethod_state_t & state);
+
+    uint32_t m_worker_threads;
+    std::size_t m_max_queue_size;
+    uint32_t m_method_max_concurrency;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::unordered_map<std::string, xmethod_state_t> m_methods;
+    std::deque<std::string> m_ready_methods;  // methods having queued requests and not reaching limit
+    std::size_t m_queue_size{0};
+    bool m_running{false};
+    std::vector<std::thread> m_threads;
+};
+
+NS_END2
@@ -4,6 +4,8 @@
 
 #include <assert.h>
 #include <inttypes.h>
+#include <chrono>
+#include <future>
 #include <mutex>
 #include <utility>
 #include <stack>
@@ -282,6 +284,37 @@ const std::string xstore::get_value(const std::string &key) const {
     return value;
 }
 
+// adapt pinned value of xdb to xvledger without copy
+class xstore_pinned_value_t : public base::xvdbvalue_t {
+ public:
+    explicit xstore_pinned_value_t(const std::shared_ptr<db::xdb_pinned_value_t> & value) : m_value(value) {}
+    const char * data() const override { return m_value->data(); }
+    size_t size() const override { return m_value->size(); }
+
+ private:
+    std::shared_ptr<db::xdb_pinned_value_t> m_value;
+};
+
+std::shared_ptr<base::xvdbvalue_t> xstore::get_value_pinned(const std::string & key) const {
+    auto value = m_db->read_pinned(key);
+    if (value == nullptr || value->size() == 0) {
+        return nullptr;
+    }
+    return std::make_shared<xstore_pinned_value_t>(value);
+}
+
+bool xstore::get_values(const std::vector<std::string> & keys, std::vector<std::string> & values, std::vector<bool> & found_flags) const {
+    return m_db->multi_read(keys, values, found_flags);
+}
+
+bool xstore::set_values_async(const std::map<std::string, std::string> & values, const std::function<void(bool)> & callback) {
+    std::future<bool> result = m_db->batch_change_async(values, std::vector<std::string>(), callback);
+    // db without write queue has committed already,report its result at once
+    if (result.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+        return result.get();
+    return true;
+}
+
 bool  xstore::delete_values(std::vector<std::string> & to_deleted_keys)
 {
     std::map<std::string, std::string> empty_put;
@@ -40,6 +40,9 @@ class xstore final: public xstore_face_t {
     virtual bool                set_value(const std::string & key, const std::string& value) override;
     virtual bool                delete_value(const std::string & key) override;
     virtual const std::string   get_value(const std::string & key) const override;
+    virtual std::shared_ptr<base::xvdbvalue_t> get_value_pinned(const std::string & key) const override;
+    virtual bool                get_values(const std::vector<std::string> & keys, std::vector<std::string> & values, std::vector<bool> & found_flags) const override;
+    virtual bool                set_values_async(const std::map<std::string, std::string> & values, const std::function<void(bool)> & callback) override;
     virtual bool                delete_values(std::vector<std::string> & to_deleted_keys) override;
 
 public:
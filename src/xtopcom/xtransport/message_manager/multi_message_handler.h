@@ -10,7 +10,9 @@
 #include <stdlib.h>
 #include <assert.h>
 
+#include <atomic>
 #include <memory>
+#include <string>
 #include <vector>
 #include <thread>
 #include <mutex>
@@ -50,6 +52,8 @@ private:
     ThreadHandler & operator = (const ThreadHandler &);
 public:
     static bool          fired_packet(base::xpacket_t & packet,int32_t cur_thread_id, uint64_t time_now_ms,on_dispatch_callback_t & callback_ptr);
+private:
+    static bool          dispatch_packet(transport::protobuf::RoutingMessage & pro_message, base::xpacket_t & packet, on_dispatch_callback_t & callback_ptr);
 public:
     base::xiothread_t*   get_raw_thread() {return m_raw_thread;}
  
@@ -60,11 +64,16 @@ public:
     void register_on_dispatch_callback(on_dispatch_callback_t callback);
     void unregister_on_dispatch_callback();
 
+    // packets posted to this worker but not dispatched yet
+    int64_t pending_packets() const { return m_pending_packets.load(std::memory_order_relaxed); }
+    void    add_pending_packet() { m_pending_packets.fetch_add(1, std::memory_order_relaxed); }
+
 private:
     base::xiothread_t *  m_raw_thread;
     uint32_t raw_thread_index_;
     std::mutex callback_mutex_;
     on_dispatch_callback_t callback_;
+    std::atomic<int64_t> m_pending_packets{0};
 };
 
 class MultiThreadHandler : public std::enable_shared_from_this<MultiThreadHandler>
@@ -73,13 +82,23 @@ public:
     MultiThreadHandler();
     ~MultiThreadHandler();
 
-    void Init();
+    // worker_threads_count 0 means default. with more than one worker,worker 0 is reserved for priority(e.g. consensus) packets,
+    // others are sharded by destination service and sender so packets of same shard keep order
+    void Init(uint32_t worker_threads_count = 0);
     void Stop();
     void HandleMessage(base::xpacket_t& packet);
 
+    // non-priority packet is dropped when its worker already hold so many packets,0 means no limit
+    void set_max_pending_packets(int64_t max_pending_packets) { m_max_pending_packets = max_pending_packets; }
+    size_t worker_threads_count() const { return m_worker_threads.size(); }
+
     void register_on_dispatch_callback(on_dispatch_callback_t callback);
     void unregister_on_dispatch_callback();
 
+private:
+    uint32_t select_worker(base::xpacket_t & packet, uint16_t priority_level) const;
+    void     update_worker_metrics(uint32_t index);
+
 private:
     #ifdef __DIRECT_PASS_PACKET_WITHOUT_DATABOX__
     std::mutex             m_mutex;
@@ -89,6 +108,9 @@ private:
     size_t m_woker_threads_count{2};  // 2 threads are enough to handle messages
     #endif
     std::vector<ThreadHandler*> m_worker_threads;
+    std::vector<std::string> m_worker_pending_metrics_names;
+    std::vector<std::string> m_worker_drop_metrics_names;
+    int64_t m_max_pending_packets{65536};
 };
 
 }  // namespace transport
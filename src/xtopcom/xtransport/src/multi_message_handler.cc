@@ -13,6 +13,7 @@
 #include "xmetrics/xmetrics.h"
 #include "xpbase/base/top_utils.h"
 #include "xtransport/udp_transport/transport_util.h"
+#include "xtransport/udp_transport/transport_filter.h"
 
 namespace top {
 
@@ -50,18 +51,59 @@ ThreadHandler::~ThreadHandler()
 //subclass need overwrite this virtual function if they need support signal(xpacket_t) or send(xpacket_t),only allow called internally
 bool  ThreadHandler::on_databox_open(base::xpacket_t & packet,int32_t cur_thread_id, uint64_t time_now_ms)
 {
+    m_pending_packets.fetch_sub(1, std::memory_order_relaxed);
     return ThreadHandler::fired_packet(packet,cur_thread_id,time_now_ms,callback_);
 }
 
+namespace {
+// mark the message of current thread as busy,so nested dispatch(e.g. SendToLocal inside callback) use its own message
+class message_in_use_guard {
+public:
+    explicit message_in_use_guard(bool & in_use) : m_in_use(in_use) {
+        m_in_use = true;
+    }
+    ~message_in_use_guard() {
+        m_in_use = false;
+    }
+private:
+    bool & m_in_use;
+};
+}
+
 bool  ThreadHandler::fired_packet(base::xpacket_t & packet,int32_t cur_thread_id, uint64_t time_now_ms,on_dispatch_callback_t & callback_ptr)
 {
-    auto thread_begin_time = GetCurrentTimeMicSec();  // us
-    transport::protobuf::RoutingMessage pro_message;
+    // the only place to decode inbound packet,socket pass raw bytes through.
+    // message of each thread is reused since ParseFromArray clears fields but keeps their allocated buffers
+    static thread_local transport::protobuf::RoutingMessage thread_message;
+    static thread_local bool thread_message_in_use = false;
+    if (thread_message_in_use) {
+        transport::protobuf::RoutingMessage pro_message;
+        return dispatch_packet(pro_message, packet, callback_ptr);
+    }
+    message_in_use_guard guard(thread_message_in_use);
+    return dispatch_packet(thread_message, packet, callback_ptr);
+}
+
+bool  ThreadHandler::dispatch_packet(transport::protobuf::RoutingMessage & pro_message, base::xpacket_t & packet, on_dispatch_callback_t & callback_ptr)
+{
     if (!pro_message.ParseFromArray((const char*)packet.get_body().data() + enum_xbase_header_len,packet.get_body().size() - enum_xbase_header_len))
     {
         TOP_ERROR("Message ParseFromString from string failed!");
         return true;
     }
+
+#ifdef XENABLE_P2P_BENDWIDTH
+    if (pro_message.has_broadcast() && pro_message.broadcast()) {
+        XMETRICS_FLOW_COUNT("p2p_transport_broadcast_packet_recv", 1);
+        XMETRICS_FLOW_COUNT("p2p_transport_broadcast_bandwidth_recv", packet.get_size());
+    }
+
+    // total
+    XMETRICS_FLOW_COUNT("p2p_transport_packet_recv", 1);
+    XMETRICS_FLOW_COUNT("p2p_transport_bandwidth_recv", packet.get_size());
+    TransportFilter::Instance()->AddTrafficData(false, pro_message.type(), packet.get_size());
+#endif
+
     pro_message.set_hop_num(pro_message.hop_num() + 1);
     /*
     TOP_DBG_INFO("ThreadHandler filter begin. type:%d thread_index:%d hop:%d size:%d id:%s",
@@ -105,13 +147,22 @@ MultiThreadHandler::MultiThreadHandler()
     #endif
 }
 
-void MultiThreadHandler::Init()
+void MultiThreadHandler::Init(uint32_t worker_threads_count)
 {
+#ifndef __DIRECT_PASS_PACKET_WITHOUT_DATABOX__
+    if (worker_threads_count > 0) {
+        m_woker_threads_count = worker_threads_count;
+    }
+#endif
     m_worker_threads.resize(m_woker_threads_count);
+    m_worker_pending_metrics_names.resize(m_woker_threads_count);
+    m_worker_drop_metrics_names.resize(m_woker_threads_count);
     for(size_t i = 0; i < m_woker_threads_count; ++i)
     {
         base::xiothread_t * raw_thread_ptr = base::xiothread_t::create_thread(base::xcontext_t::instance(),base::xiothread_t::enum_xthread_type_private,-1);
         m_worker_threads[i] = new ThreadHandler(raw_thread_ptr, i);
+        m_worker_pending_metrics_names[i] = "xtransport_worker_" + std::to_string(i) + "_pending";
+        m_worker_drop_metrics_names[i] = "xtransport_worker_" + std::to_string(i) + "_drop";
 
         TOP_INFO("starting thread(ThreadHandler)-index:%d and thread_id:%d", (int)i,raw_thread_ptr->get_thread_id());
     }
@@ -180,60 +231,66 @@ void MultiThreadHandler::HandleMessage(base::xpacket_t & packet) {
     return;
 #endif  //
 
-#if defined(DEBUG)
-    uint32_t index = 0;
-#endif
-    if (m_worker_threads.size() == 1u)  // optimize,direct post
-    {
-        m_worker_threads[0]->get_databox()->send_packet(packet);
-#if defined(DEBUG)
-        index = 0;
-#endif
-    } else {
-        if (priority_level >= enum_xpacket_priority_type_flash)  // priority packet
-        {
-            m_worker_threads[0]->get_databox()->send_packet(packet);
-#if defined(DEBUG)
-            index = 0;
-#endif
-        } else if (m_worker_threads.size() == 2u) {
-            m_worker_threads[1]->get_databox()->send_packet(packet);
-#if defined(DEBUG)
-            index = 1;
-#endif
-        } else {
-            uint32_t hash_size = 128 < (packet.get_body().size() - enum_xbase_header_len) ? 128 : (packet.get_body().size() - enum_xbase_header_len);
-            const std::string src_data((const char *)packet.get_body().data() + enum_xbase_header_len, hash_size);
-            uint32_t msg_hash = base::xhash32_t::digest(src_data);
-
-            const uint32_t th_index = (msg_hash % (m_worker_threads.size() - 1)) + 1;  // thread 0 is reserved for priority packets
-            m_worker_threads[th_index]->get_databox()->send_packet(packet);
-#if defined(DEBUG)
-            index = th_index;
-#endif
+    const uint32_t index = select_worker(packet, priority_level);
+    ThreadHandler * worker = m_worker_threads[index];
+    // priority packets are never dropped,bulk traffic(e.g. sync) is dropped rather than delay consensus and other shards
+    if (priority_level < enum_xpacket_priority_type_critical && m_max_pending_packets > 0 && worker->pending_packets() >= m_max_pending_packets) {
+        XMETRICS_GAUGE(metrics::message_transport_worker_drop, 1);
+        XMETRICS_COUNTER_INCREMENT(m_worker_drop_metrics_names[index], 1);
+        TOP_DEBUG("HandleMessage drop packet,too much pending at worker:%u pending:%lld from:%s:%d",
+                  index,
+                  (long long)worker->pending_packets(),
+                  packet.get_from_ip_addr().c_str(),
+                  packet.get_from_ip_port());
+        return;
+    }
+
+    worker->add_pending_packet();
+    worker->get_databox()->send_packet(packet);
+    update_worker_metrics(index);
+}
+
+uint32_t MultiThreadHandler::select_worker(base::xpacket_t & packet, uint16_t priority_level) const {
+    if (m_worker_threads.size() == 1u) {  // optimize,direct post
+        return 0;
+    }
+    if (priority_level >= enum_xpacket_priority_type_critical) {  // priority packet,e.g. consensus
+        return 0;
+    }
+    if (m_worker_threads.size() == 2u) {
+        return 1;
+    }
+
+    // thread 0 is reserved for priority packets. packets of same destination service from same sender go to same worker,
+    // so they are handled in order while different groups run in parallel
+    const uint8_t * data = (const uint8_t *)packet.get_body().data() + enum_xbase_header_len;
+    const int size = packet.get_body().size() - enum_xbase_header_len;
+    uint32_t msg_hash = 0;
+    RoutingMessageHead head;
+    if (PeekRoutingMessageHead(data, size, head)) {
+        std::string shard_key((const char *)&head.des_service_type, sizeof(head.des_service_type));
+        if (head.src_node_id != nullptr) {
+            shard_key.append((const char *)head.src_node_id, head.src_node_id_size);
         }
-    }  // end  if(enum_const_woker_threads_count == 1) //optimize,direct post
+        msg_hash = base::xhash32_t::digest(shard_key);
+    } else {
+        const uint32_t hash_size = 128 < size ? 128 : size;
+        msg_hash = base::xhash32_t::digest(std::string((const char *)data, hash_size));
+    }
+    return (msg_hash % (m_worker_threads.size() - 1)) + 1;
+}
 
-#if defined(DEBUG)
+void MultiThreadHandler::update_worker_metrics(uint32_t index) {
     static std::atomic<uint32_t> packet_count(0);
-    ++packet_count;
-    if (packet_count % 64 == 0) {
-        int64_t in = 0;
-        int64_t out = 0;
-        const int32_t total_holding = m_worker_threads[index]->get_databox()->count_packets(in, out);
-        if (total_holding > 8192)  // too much packets pending in the queues
-        {
-            TOP_WARN("TOO MUCH PENDING,packet_count: thread_index:%d,thread_id:%d, packets(in:%lld out:%lld hold:%d)",
-                     index,
-                     m_worker_threads[index]->get_thread_id(),
-                     in,
-                     out,
-                     total_holding);
-        } else if (packet_count % 1024 == 0) {
-            TOP_INFO("packet_count: thread_index:%d,thread_id:%d, packets(in:%lld out:%lld hold:%d)", index, m_worker_threads[index]->get_thread_id(), in, out, total_holding);
-        }
+    if (++packet_count % 256 != 0) {
+        return;
+    }
+
+    const int64_t pending = m_worker_threads[index]->pending_packets();
+    XMETRICS_COUNTER_SET(m_worker_pending_metrics_names[index], pending);
+    if (pending > 8192) {  // too much packets pending in the queues
+        TOP_WARN("TOO MUCH PENDING,thread_index:%u,thread_id:%d, pending:%lld", index, m_worker_threads[index]->get_thread_id(), (long long)pending);
     }
-#endif
 }
 
 }  // namespace transport
@@ -0,0 +1,88 @@
+// Copyright (c) 2017-2019 Telos Foundation & contributors
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "xtransport/udp_transport/transport_util.h"
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite.h>
+
+namespace top {
+
+namespace transport {
+
+bool PeekRoutingMessageHead(const uint8_t * data, int size, RoutingMessageHead & head) {
+    using google::protobuf::internal::WireFormatLite;
+    head = RoutingMessageHead();
+    google::protobuf::io::CodedInputStream input(data, size);
+    for (;;) {
+        const uint32_t tag = input.ReadTag();
+        if (tag == 0) {
+            return input.CurrentPosition() == size;  // 0 is also returned for broken data
+        }
+
+        const int field_number = WireFormatLite::GetTagFieldNumber(tag);
+        const WireFormatLite::WireType wire_type = WireFormatLite::GetTagWireType(tag);
+        if (wire_type == WireFormatLite::WIRETYPE_VARINT) {
+            uint64_t value = 0;
+            switch (field_number) {
+            case protobuf::RoutingMessage::kTypeFieldNumber:
+                if (!input.ReadVarint64(&value)) {
+                    return false;
+                }
+                head.type = static_cast<int32_t>(value);
+                continue;
+            case protobuf::RoutingMessage::kBroadcastFieldNumber:
+                if (!input.ReadVarint64(&value)) {
+                    return false;
+                }
+                head.broadcast = (value != 0);
+                continue;
+            case protobuf::RoutingMessage::kPriorityFieldNumber:
+                if (!input.ReadVarint64(&value)) {
+                    return false;
+                }
+                head.priority = static_cast<uint32_t>(value);
+                continue;
+            case protobuf::RoutingMessage::kDesServiceTypeFieldNumber:
+                if (!input.ReadVarint64(&value)) {
+                    return false;
+                }
+                head.des_service_type = value;
+                continue;
+            default:
+                break;
+            }
+        } else if (wire_type == WireFormatLite::WIRETYPE_LENGTH_DELIMITED && field_number == protobuf::RoutingMessage::kSrcNodeIdFieldNumber) {
+            uint32_t length = 0;
+            if (!input.ReadVarint32(&length) || length > (uint32_t)(size - input.CurrentPosition())) {
+                return false;
+            }
+            head.src_node_id = data + input.CurrentPosition();
+            head.src_node_id_size = static_cast<int>(length);
+            if (!input.Skip(static_cast<int>(length))) {
+                return false;
+            }
+            continue;
+        }
+
+        if (!WireFormatLite::SkipField(&input, tag)) {
+            return false;
+        }
+    }
+}
+
+void AppendLengthDelimitedField(std::string & data, int field_number, const std::string & value) {
+    using google::protobuf::internal::WireFormatLite;
+    using google::protobuf::io::CodedOutputStream;
+    uint8_t head[10];  // tag and length,varint32 each
+    uint8_t * end = CodedOutputStream::WriteVarint32ToArray(WireFormatLite::MakeTag(field_number, WireFormatLite::WIRETYPE_LENGTH_DELIMITED), head);
+    end = CodedOutputStream::WriteVarint32ToArray(static_cast<uint32_t>(value.size()), end);
+    data.reserve(data.size() + (end - head) + value.size());
+    data.append((const char *)head, end - head);
+    data.append(value);
+}
+
+}  // namespace transport
+
+}  // namespace top
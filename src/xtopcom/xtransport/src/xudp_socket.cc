@@ -15,6 +15,7 @@
 #include "xpbase/base/top_utils.h"
 #include "xpbase/base/top_log.h"
 #include "xtransport/utils/transport_utils.h"
+#include "xtransport/udp_transport/transport_util.h"
 #include "xtransport/message_manager/multi_message_handler.h"
 #include "xmetrics/xmetrics.h"
 #include "xtransport/udp_transport/transport_filter.h"
@@ -173,14 +174,14 @@ int xp2pudp_t::send(xpacket_t& packet)
     int ret_status = xslsocket_t::send(0, 0, 0, 0, packet, 0, 0, NULL);
 
 #ifdef XENABLE_P2P_BENDWIDTH
-    transport::protobuf::RoutingMessage message;
-    if (!message.ParseFromArray((const char*)packet.get_body().data() + enum_xbase_header_len,packet.get_body().size() - enum_xbase_header_len))
+    RoutingMessageHead message_head;
+    if (!PeekRoutingMessageHead(packet.get_body().data() + enum_xbase_header_len, packet.get_body().size() - enum_xbase_header_len, message_head))
     {
         TOP_ERROR("Message ParseFromString from string failed!");
         return enum_xcode_successful;
     }
 
-    if (message.has_broadcast() && message.broadcast()) {
+    if (message_head.broadcast) {
         XMETRICS_FLOW_COUNT("p2p_transport_broadcast_packet_send", 1);
         XMETRICS_FLOW_COUNT("p2p_transport_broadcast_bandwidth_send", packet.get_size());
     }
@@ -188,7 +189,7 @@ int xp2pudp_t::send(xpacket_t& packet)
     // total
     XMETRICS_FLOW_COUNT("p2p_transport_packet_send", 1);
     XMETRICS_FLOW_COUNT("p2p_transport_bandwidth_send", packet.get_size());
-    TransportFilter::Instance()->AddTrafficData(true, message.type(), packet.get_size());
+    TransportFilter::Instance()->AddTrafficData(true, message_head.type, packet.get_size());
 #endif
 
     return ret_status;
@@ -228,25 +229,7 @@ int32_t xp2pudp_t::recv(
         return enum_xcode_successful;
     }
 
-#ifdef XENABLE_P2P_BENDWIDTH
-    transport::protobuf::RoutingMessage message;
-    if (!message.ParseFromArray((const char*)packet.get_body().data() + enum_xbase_header_len,packet.get_body().size() - enum_xbase_header_len))
-    {
-        TOP_ERROR("Message ParseFromString from string failed!");
-        return enum_xcode_successful;
-    }
-
-    if (message.has_broadcast() && message.broadcast()) {
-        XMETRICS_FLOW_COUNT("p2p_transport_broadcast_packet_recv", 1);
-        XMETRICS_FLOW_COUNT("p2p_transport_broadcast_bandwidth_recv", packet.get_size());
-    }
-
-    // total
-    XMETRICS_FLOW_COUNT("p2p_transport_packet_recv", 1);
-    XMETRICS_FLOW_COUNT("p2p_transport_bandwidth_recv", packet.get_size());
-    TransportFilter::Instance()->AddTrafficData(false, message.type(), packet.get_size());
-#endif
-
+    // decode and bandwidth stat are done once at ThreadHandler::fired_packet,keep io thread only move bytes
     listen_server_->multi_thread_message_handler_->HandleMessage(packet);
     //go default handle,where may deliver packet to parent object
     return xsocket_t::recv(
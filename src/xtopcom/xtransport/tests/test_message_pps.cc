@@ -0,0 +1,291 @@
+// Copyright (c) 2017-2019 Telos Foundation & contributors
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+#include <string.h>
+
+#include "gtest/gtest.h"
+#include "xbase/xcontext.h"
+#include "xbase/xpacket.h"
+#include "xtransport/message_manager/multi_message_handler.h"
+#include "xtransport/udp_transport/transport_util.h"
+
+using namespace top;
+using namespace top::transport;
+
+namespace {
+
+void make_packet(base::xpacket_t & packet,
+                 uint32_t id,
+                 size_t data_size,
+                 const std::string & src_node_id = std::string(64, 's'),
+                 uint64_t des_service_type = 0,
+                 uint16_t priority = enum_xpacket_priority_type_routine) {
+    protobuf::RoutingMessage message;
+    message.set_src_node_id(src_node_id);
+    message.set_des_service_type(des_service_type);
+    message.set_priority(priority);
+    message.set_des_node_id(std::string(64, 'd'));
+    message.set_type(1000);
+    message.set_id(id);
+    message.set_hop_num(1);
+    message.set_broadcast(true);
+    message.set_data(std::string(data_size, 'a'));
+    message.mutable_gossip()->set_neighber_count(3);
+    std::string bin;
+    message.SerializeToString(&bin);
+
+    packet.reset();
+    packet.get_body().push_back((uint8_t *)bin.data(), (int)bin.size());
+    _xbase_header header;
+    memset(&header, 0, sizeof(header));
+    header.ver_protocol = kVersionV1ProtocolProtobuf;
+    header.flags |= priority;
+    packet.get_body().push_front((uint8_t *)&header, enum_xbase_header_len);
+}
+
+}  // namespace
+
+TEST(test_message_pps, fired_packet_parse_once) {
+    base::xpacket_t packet(base::xcontext_t::instance());
+    make_packet(packet, 7, 100);
+    base::xpacket_t nested_packet(base::xcontext_t::instance());
+    make_packet(nested_packet, 8, 200);
+
+    uint32_t recv_count = 0;
+    on_dispatch_callback_t nested_callback = [&](protobuf::RoutingMessage & message, base::xpacket_t &) {
+        ASSERT_EQ(message.id(), 8u);
+        ASSERT_EQ(message.data().size(), 200u);
+        recv_count++;
+    };
+    on_dispatch_callback_t callback = [&](protobuf::RoutingMessage & message, base::xpacket_t &) {
+        ASSERT_EQ(message.id(), 7u);
+        ASSERT_EQ(message.hop_num(), 2u);
+        // dispatch again at same thread,e.g. send to local inside callback
+        ThreadHandler::fired_packet(nested_packet, 0, 0, nested_callback);
+        ASSERT_EQ(message.id(), 7u);
+        ASSERT_EQ(message.data().size(), 100u);
+        recv_count++;
+    };
+    ThreadHandler::fired_packet(packet, 0, 0, callback);
+    ASSERT_EQ(recv_count, 2u);
+
+    // message reused by next packet should not keep any field of last one
+    make_packet(packet, 9, 10);
+    on_dispatch_callback_t check_callback = [&](protobuf::RoutingMessage & message, base::xpacket_t &) {
+        ASSERT_EQ(message.id(), 9u);
+        ASSERT_EQ(message.data().size(), 10u);
+        recv_count++;
+    };
+    ThreadHandler::fired_packet(packet, 0, 0, check_callback);
+    ASSERT_EQ(recv_count, 3u);
+}
+
+TEST(test_message_pps, handle_message_shard_and_priority) {
+    auto handler = std::make_shared<MultiThreadHandler>();
+    handler->Init(4);
+    ASSERT_EQ(handler->worker_threads_count(), 4u);
+
+    std::mutex mutex;
+    std::map<std::string, std::vector<uint32_t>> sender_ids;
+    std::map<std::string, std::set<std::thread::id>> sender_threads;
+    std::set<std::thread::id> priority_threads;
+    std::set<std::thread::id> routine_threads;
+    std::atomic<uint32_t> recv_count{0};
+    handler->register_on_dispatch_callback([&](protobuf::RoutingMessage & message, base::xpacket_t &) {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (message.priority() >= enum_xpacket_priority_type_critical) {
+            priority_threads.insert(std::this_thread::get_id());
+        } else {
+            routine_threads.insert(std::this_thread::get_id());
+            sender_ids[message.src_node_id()].push_back(message.id());
+            sender_threads[message.src_node_id()].insert(std::this_thread::get_id());
+        }
+        recv_count++;
+    });
+
+    const uint32_t senders = 16;
+    const uint32_t count = 200;
+    base::xpacket_t packet(base::xcontext_t::instance());
+    for (uint32_t i = 0; i < count; i++) {
+        for (uint32_t s = 0; s < senders; s++) {
+            make_packet(packet, i, 32, std::string(64, (char)('a' + s)), 100);
+            handler->HandleMessage(packet);
+        }
+        make_packet(packet, i, 32, std::string(64, 'c'), 100, enum_xpacket_priority_type_critical);
+        handler->HandleMessage(packet);
+    }
+    for (int i = 0; i < 1000 && recv_count.load() < count * (senders + 1); i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    handler->unregister_on_dispatch_callback();
+    handler->Stop();
+
+    ASSERT_EQ(recv_count.load(), count * (senders + 1));
+    // priority packets have their own worker
+    ASSERT_EQ(priority_threads.size(), 1u);
+    ASSERT_EQ(routine_threads.count(*priority_threads.begin()), 0u);
+    ASSERT_GT(routine_threads.size(), 1u);
+    // packets of same sender are handled by one worker in order
+    ASSERT_EQ(sender_ids.size(), senders);
+    for (auto const & item : sender_ids) {
+        ASSERT_EQ(sender_threads[item.first].size(), 1u);
+        ASSERT_EQ(item.second.size(), count);
+        for (uint32_t i = 0; i < count; i++) {
+            ASSERT_EQ(item.second[i], i);
+        }
+    }
+}
+
+TEST(test_message_pps, handle_message_drop_routine_only) {
+    auto handler = std::make_shared<MultiThreadHandler>();
+    handler->Init(2);
+    handler->set_max_pending_packets(10);
+
+    std::atomic<bool> routine_blocked{false};
+    std::atomic<bool> release{false};
+    std::atomic<uint32_t> routine_count{0};
+    std::atomic<uint32_t> priority_count{0};
+    handler->register_on_dispatch_callback([&](protobuf::RoutingMessage & message, base::xpacket_t &) {
+        if (message.priority() >= enum_xpacket_priority_type_critical) {
+            priority_count++;
+            return;
+        }
+        routine_count++;
+        routine_blocked = true;
+        while (!release) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    });
+
+    base::xpacket_t packet(base::xcontext_t::instance());
+    make_packet(packet, 0, 32);
+    handler->HandleMessage(packet);
+    for (int i = 0; i < 1000 && !routine_blocked; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_TRUE(routine_blocked);
+
+    // routine worker is busy,so only max pending packets are queued and others dropped
+    for (uint32_t i = 1; i <= 100; i++) {
+        make_packet(packet, i, 32);
+        handler->HandleMessage(packet);
+    }
+    // consensus is not blocked by the busy routine worker and never dropped
+    for (uint32_t i = 0; i < 100; i++) {
+        make_packet(packet, i, 32, std::string(64, 'c'), 0, enum_xpacket_priority_type_critical);
+        handler->HandleMessage(packet);
+    }
+    for (int i = 0; i < 1000 && priority_count.load() < 100; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_EQ(priority_count.load(), 100u);
+    ASSERT_EQ(routine_count.load(), 1u);
+
+    release = true;
+    for (int i = 0; i < 1000 && routine_count.load() < 11; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ASSERT_EQ(routine_count.load(), 11u);
+
+    handler->unregister_on_dispatch_callback();
+    handler->Stop();
+}
+
+TEST(test_message_pps, append_per_destination_field) {
+    protobuf::RoutingMessage message;
+    message.set_src_node_id(std::string(64, 's'));
+    message.set_type(1000);
+    message.set_id(1);
+    message.set_data(std::string(1024, 'a'));
+    message.mutable_gossip()->set_neighber_count(3);
+    message.mutable_gossip()->set_sit1(1);
+    std::string body;
+    ASSERT_TRUE(message.SerializeToString(&body));
+
+    // singular field appended overrides,message field appended merges
+    protobuf::GossipParams gossip;
+    gossip.set_sit1(100);
+    gossip.set_sit2(200);
+    std::string data = body;
+    AppendLengthDelimitedField(data, protobuf::RoutingMessage::kDesNodeIdFieldNumber, std::string(64, 'd'));
+    AppendLengthDelimitedField(data, protobuf::RoutingMessage::kGossipFieldNumber, gossip.SerializeAsString());
+
+    protobuf::RoutingMessage patched;
+    ASSERT_TRUE(patched.ParseFromString(data));
+    message.set_des_node_id(std::string(64, 'd'));
+    message.mutable_gossip()->set_sit1(100);
+    message.mutable_gossip()->set_sit2(200);
+    ASSERT_EQ(patched.SerializeAsString(), message.SerializeAsString());
+
+    RoutingMessageHead head;
+    ASSERT_TRUE(PeekRoutingMessageHead((const uint8_t *)data.data(), (int)data.size(), head));
+    ASSERT_EQ(head.type, 1000);
+}
+
+TEST(test_message_pps, BENCH_fired_packet) {
+    const uint32_t count = 200000;
+    base::xpacket_t packet(base::xcontext_t::instance());
+    make_packet(packet, 1, 1024);  // about size of one gossip block
+
+    uint64_t total_hop = 0;
+    uint64_t total_type = 0;
+    on_dispatch_callback_t callback = [&](protobuf::RoutingMessage & message, base::xpacket_t &) {
+        total_hop += message.hop_num();
+    };
+
+    // old path: socket decode once for stat,then worker decode again
+    auto begin = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < count; i++) {
+        protobuf::RoutingMessage message;
+        message.ParseFromArray((const char *)packet.get_body().data() + enum_xbase_header_len, packet.get_body().size() - enum_xbase_header_len);
+        total_type += message.type();
+        ThreadHandler::fired_packet(packet, 0, 0, callback);
+    }
+    auto end = std::chrono::steady_clock::now();
+    auto us = std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count();
+    std::cout << "double parse: " << count << " packets " << us << "us, pps=" << (uint64_t)count * 1000000 / (us + 1) << std::endl;
+
+    begin = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < count; i++) {
+        ThreadHandler::fired_packet(packet, 0, 0, callback);
+    }
+    end = std::chrono::steady_clock::now();
+    us = std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count();
+    std::cout << "single parse: " << count << " packets " << us << "us, pps=" << (uint64_t)count * 1000000 / (us + 1) << std::endl;
+    ASSERT_EQ(total_hop, (uint64_t)count * 2 * 2);
+    ASSERT_EQ(total_type, (uint64_t)count * 1000);
+}
+
+TEST(test_message_pps, BENCH_handle_message) {
+    const uint32_t count = 200000;
+    auto handler = std::make_shared<MultiThreadHandler>();
+    handler->Init();
+    std::atomic<uint32_t> recv_count{0};
+    handler->register_on_dispatch_callback([&recv_count](protobuf::RoutingMessage &, base::xpacket_t &) { recv_count++; });
+
+    base::xpacket_t packet(base::xcontext_t::instance());
+    make_packet(packet, 1, 1024);
+    auto begin = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < count; i++) {
+        handler->HandleMessage(packet);
+    }
+    for (int i = 0; i < 3000 && recv_count.load() < count; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    auto end = std::chrono::steady_clock::now();
+    auto us = std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count();
+    std::cout << "HandleMessage: " << recv_count.load() << "/" << count << " packets " << us << "us, pps=" << (uint64_t)recv_count.load() * 1000000 / (us + 1)
+              << std::endl;
+
+    handler->unregister_on_dispatch_callback();
+    handler->Stop();
+}
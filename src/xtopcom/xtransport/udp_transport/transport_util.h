@@ -14,6 +14,23 @@ inline std::string FormatMsgid(const protobuf::RoutingMessage & message) {
     return base::StringUtil::str_fmt("msgid(%u)", message.id());
 }
 
+// head fields of a serialized RoutingMessage,src_node_id points into the serialized data
+struct RoutingMessageHead {
+    int32_t type{0};
+    bool broadcast{false};
+    uint32_t priority{0};
+    uint64_t des_service_type{0};
+    const uint8_t * src_node_id{nullptr};
+    int src_node_id_size{0};
+};
+
+// read head fields only,other fields are skipped without decode. return false for broken data
+bool PeekRoutingMessageHead(const uint8_t * data, int size, RoutingMessageHead & head);
+
+// append a length delimited field(bytes or message) to serialized data. decoder keeps the last value of a singular
+// field and merges a message field,so fields differing per destination can be appended to data serialized once
+void AppendLengthDelimitedField(std::string & data, int field_number, const std::string & value);
+
 }  // namespace transport
 }  // namespace top
 
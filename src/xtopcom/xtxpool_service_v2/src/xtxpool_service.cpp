@@ -378,7 +378,7 @@ void xtxpool_service::on_message_unit_receipt(vnetwork::xvnode_address_t const &
     xinfo("xtxpool_service::on_message_unit_receipt receipt=%s,at_node:%s,msg id:%x,hash:%x", receipt->dump().c_str(), m_vnetwork_str.c_str(), message.id(), message.hash());
 
     xtxpool_v2::xtx_para_t para;
-    std::shared_ptr<xtxpool_v2::xtx_entry> tx_ent = std::make_shared<xtxpool_v2::xtx_entry>(receipt, para);
+    std::shared_ptr<xtxpool_v2::xtx_entry> tx_ent = xtxpool_v2::xtx_entry::create(receipt, para);
     XMETRICS_GAUGE(metrics::txpool_received_other_send_receipt_num, 1);
     ret = m_para->get_txpool()->push_receipt(tx_ent, false, false);
     XMETRICS_GAUGE(metrics::txpool_receipt_tx, (ret == xsuccess) ? 1 : 0);
@@ -492,7 +492,7 @@ int32_t xtxpool_service::request_transaction_consensus(const data::xtransaction_
 
     xcons_transaction_ptr_t cons_tx = make_object_ptr<xcons_transaction_t>(tx.get());
     xtxpool_v2::xtx_para_t para;
-    std::shared_ptr<xtxpool_v2::xtx_entry> tx_ent = std::make_shared<xtxpool_v2::xtx_entry>(cons_tx, para);
+    std::shared_ptr<xtxpool_v2::xtx_entry> tx_ent = xtxpool_v2::xtx_entry::create(cons_tx, para);
     ret = m_para->get_txpool()->push_send_tx(tx_ent);
     push_send_fail_record(ret);
     return ret;
@@ -584,7 +584,7 @@ void xtxpool_service::on_message_push_receipt_received(vnetwork::xvnode_address_
              pushed_receipt.m_tx_to_account.c_str(),
              tx->dump().c_str());
         xtxpool_v2::xtx_para_t para;
-        std::shared_ptr<xtxpool_v2::xtx_entry> tx_ent = std::make_shared<xtxpool_v2::xtx_entry>(tx, para);
+        std::shared_ptr<xtxpool_v2::xtx_entry> tx_ent = xtxpool_v2::xtx_entry::create(tx, para);
         m_para->get_txpool()->push_receipt(tx_ent, false, true);
     }
 }
@@ -24,8 +24,12 @@ using namespace top::data;
 void xsend_tx_queue_internal_t::insert_ready_tx(const std::shared_ptr<xtx_entry> & tx_ent) {
     uint64_t now = xverifier::xtx_utl::get_gmttime_s();
     tx_ent->get_tx()->set_push_pool_timestamp(now);
-    auto it = m_ready_tx_queue.insert(tx_ent);
-    m_ready_tx_map[tx_ent->get_tx()->get_tx_hash()] = it;
+    auto ret = m_ready_tx_map.emplace(tx_ent->get_tx()->get_tx_hash_256(), tx_ent);
+    if (!ret.second) {
+        xtxpool_warn("xsend_tx_queue_internal_t::insert_ready_tx tx already in ready txs,table:%s,tx:%s", m_xtable_info->get_table_addr().c_str(), tx_ent->get_tx()->dump(true).c_str());
+        return;
+    }
+    m_ready_tx_queue.push(tx_ent.get());
     m_xtable_info->send_tx_inc(1);
     xtxpool_info("xsend_tx_queue_internal_t::insert_ready_tx push tx to ready txs,table:%s,tx:%s", m_xtable_info->get_table_addr().c_str(), tx_ent->get_tx()->dump(true).c_str());
 }
@@ -34,23 +38,22 @@ void xsend_tx_queue_internal_t::insert_non_ready_tx(const std::shared_ptr<xtx_en
     uint64_t now = xverifier::xtx_utl::get_gmttime_s();
     tx_ent->get_tx()->set_push_pool_timestamp(now);
     auto it = m_non_ready_tx_queue.insert(tx_ent);
-    m_non_ready_tx_map[tx_ent->get_tx()->get_tx_hash()] = it;
+    m_non_ready_tx_map[tx_ent->get_tx()->get_tx_hash_256()] = it;
     m_xtable_info->send_tx_inc(1);
     xtxpool_info("xsend_tx_queue_internal_t::insert_non_ready_tx push tx to non ready txs,table:%s,tx:%s", m_xtable_info->get_table_addr().c_str(), tx_ent->get_tx()->dump(true).c_str());
 }
 
 void xsend_tx_queue_internal_t::erase_ready_tx(const uint256_t & hash) {
-    std::string hash_str = std::string(reinterpret_cast<char *>(hash.data()), hash.size());
-    auto it_ready = m_ready_tx_map.find(hash_str);
+    auto it_ready = m_ready_tx_map.find(hash);
     if (it_ready != m_ready_tx_map.end()) {
-        auto & tx_ent = *it_ready->second;
+        auto & tx_ent = it_ready->second;
         uint64_t delay = xverifier::xtx_utl::get_gmttime_s() - tx_ent->get_tx()->get_push_pool_timestamp();
         xtxpool_info("xsend_tx_queue_internal_t::erase_ready_tx from ready txs,table:%s,tx:%s,delay:%llu",
                      m_xtable_info->get_table_addr().c_str(),
                      tx_ent->get_tx()->dump(true).c_str(),
                      delay);
         XMETRICS_GAUGE(metrics::txpool_tx_delay_from_push_to_commit_send, delay);
-        m_ready_tx_queue.erase(it_ready->second);
+        m_ready_tx_queue.erase(tx_ent.get());
         m_ready_tx_map.erase(it_ready);
         m_xtable_info->send_tx_dec(1);
         return;
@@ -58,8 +61,7 @@ void xsend_tx_queue_internal_t::erase_ready_tx(const uint256_t & hash) {
 }
 
 void xsend_tx_queue_internal_t::erase_non_ready_tx(const uint256_t & hash) {
-    std::string hash_str = std::string(reinterpret_cast<char *>(hash.data()), hash.size());
-    auto it_non_ready = m_non_ready_tx_map.find(hash_str);
+    auto it_non_ready = m_non_ready_tx_map.find(hash);
     if (it_non_ready != m_non_ready_tx_map.end()) {
         auto & tx_ent = *it_non_ready->second;
         uint64_t delay = xverifier::xtx_utl::get_gmttime_s() - tx_ent->get_tx()->get_push_pool_timestamp();
@@ -76,12 +78,11 @@ void xsend_tx_queue_internal_t::erase_non_ready_tx(const uint256_t & hash) {
 }
 
 const std::shared_ptr<xtx_entry> xsend_tx_queue_internal_t::find(const uint256_t & hash) const {
-    std::string hash_str = std::string(reinterpret_cast<char *>(hash.data()), hash.size());
-    auto it_ready = m_ready_tx_map.find(hash_str);
+    auto it_ready = m_ready_tx_map.find(hash);
     if (it_ready != m_ready_tx_map.end()) {
-        return *it_ready->second;
+        return it_ready->second;
     }
-    auto it_non_ready = m_non_ready_tx_map.find(hash_str);
+    auto it_non_ready = m_non_ready_tx_map.find(hash);
     if (it_non_ready != m_non_ready_tx_map.end()) {
         return *it_non_ready->second;
     }
@@ -358,18 +359,20 @@ int32_t xsend_tx_queue_t::push_tx(const std::shared_ptr<xtx_entry> & tx_ent, uin
 }
 
 const std::vector<std::shared_ptr<xtx_entry>> xsend_tx_queue_t::get_txs(uint32_t max_num) const {
-    std::map<std::string, std::vector<std::shared_ptr<xtx_entry>>> accounts_map;
+    std::unordered_map<std::string, std::vector<std::shared_ptr<xtx_entry>>> accounts_map;
     std::vector<std::shared_ptr<xtx_entry>> ret_txs;
-    auto & ready_txs = m_send_tx_queue_internal.get_ready_queue();
-    for (auto it_ready_tx = ready_txs.begin(); (ret_txs.size() < max_num) && (it_ready_tx != ready_txs.end()); it_ready_tx++) {
+    m_send_tx_queue_internal.visit_ready_txs([&](xtx_entry * ready_tx) {
+        if (ret_txs.size() >= max_num) {
+            return false;
+        }
         // use nonce continuous peculiarity of send txs to deduplicate, if tx's account is found from tx_ents and nonce is bigger, update it in tx_ents.
-        auto & account_addr = it_ready_tx->get()->get_tx()->get_source_addr();
-        uint64_t nonce = it_ready_tx->get()->get_tx()->get_transaction()->get_tx_nonce();
+        auto & account_addr = ready_tx->get_tx()->get_source_addr();
+        uint64_t nonce = ready_tx->get_tx()->get_transaction()->get_tx_nonce();
         auto it_accounts_map = accounts_map.find(account_addr);
         uint32_t old_tx_num = 0;
         if (it_accounts_map != accounts_map.end()) {
             if (nonce <= it_accounts_map->second.back()->get_tx()->get_transaction()->get_tx_nonce()) {
-                continue;
+                return true;
             } else {
                 old_tx_num = it_accounts_map->second.size();
             }
@@ -378,12 +381,13 @@ const std::vector<std::shared_ptr<xtx_entry>> xsend_tx_queue_t::get_txs(uint32_t
         xassert(send_tx_account != m_send_tx_accounts.end());
         auto txs_tmp = send_tx_account->second->get_continuous_txs(nonce, account_send_tx_move_num_max);
         if (txs_tmp.size() <= old_tx_num) {
-            continue;
+            return true;
         }
-        accounts_map[account_addr] = txs_tmp;
         xtxpool_dbg("xsend_tx_queue_t::get_txs nonce:%llu,old_tx_num:%u,txs_tmp size=%u", nonce, old_tx_num, txs_tmp.size());
         ret_txs.insert(ret_txs.end(), txs_tmp.begin() + old_tx_num, txs_tmp.end());
-    }
+        accounts_map[account_addr] = std::move(txs_tmp);
+        return true;
+    });
     return ret_txs;
 }
 
@@ -77,7 +77,7 @@ void xtxpool_t::print_statistic_values() const {
     uint32_t table_height_record_size = 0;
 
     for (uint16_t i = 0; i < enum_vbucket_has_tables_count; i++) {
-        auto table = m_tables[base::enum_chain_zone_consensus_index][i];
+        auto table = get_txpool_table(base::enum_chain_zone_consensus_index, i);
         if (table != nullptr) {
             table->unconfirm_cache_status(table_sender_cache_size, table_receiver_cache_size, table_height_record_size);
             xinfo(
@@ -88,7 +88,7 @@ void xtxpool_t::print_statistic_values() const {
         }
     }
     for (uint16_t i = 0; i < MAIN_CHAIN_REC_TABLE_USED_NUM; i++) {
-        auto table = m_tables[base::enum_chain_zone_beacon_index][i];
+        auto table = get_txpool_table(base::enum_chain_zone_beacon_index, i);
         if (table != nullptr) {
             table->unconfirm_cache_status(table_sender_cache_size, table_receiver_cache_size, table_height_record_size);
             xinfo(
@@ -99,7 +99,7 @@ void xtxpool_t::print_statistic_values() const {
         }
     }
     for (uint16_t i = 0; i < MAIN_CHAIN_ZEC_TABLE_USED_NUM; i++) {
-        auto table = m_tables[base::enum_chain_zone_zec_index][i];
+        auto table = get_txpool_table(base::enum_chain_zone_zec_index, i);
         if (table != nullptr) {
             table->unconfirm_cache_status(table_sender_cache_size, table_receiver_cache_size, table_height_record_size);
             xinfo(
@@ -187,11 +187,12 @@ void xtxpool_t::subscribe_tables(uint8_t zone, uint16_t front_table_id, uint16_t
     uint32_t add_table_num = 0;
     for (uint16_t i = front_table_id; i <= back_table_id; i++) {
         std::string table_addr = data::xblocktool_t::make_address_table_account((base::enum_xchain_zone_index)zone, i);
-        if (m_tables[zone][i] == nullptr) {
-            m_tables[zone][i] = std::make_shared<xtxpool_table_t>(m_para.get(), table_addr, shard.get(), &m_statistic, &m_all_table_sids);
+        auto table = get_txpool_table(zone, i);
+        if (table == nullptr) {
+            std::atomic_store(&m_tables[zone][i], std::make_shared<xtxpool_table_t>(m_para.get(), table_addr, shard.get(), &m_statistic, &m_all_table_sids));
             add_table_num++;
         } else {
-            m_tables[zone][i]->add_shard(shard.get());
+            table->add_shard(shard.get());
         }
     }
     if (add_table_num > 0) {
@@ -222,9 +223,11 @@ void xtxpool_t::unsubscribe_tables(uint8_t zone, uint16_t front_table_id, uint16
             }
             xtxpool_info("xtxpool_t::unsubscribe_tables unsub tables zone:%d,front_table_id:%d,back_table_id:%d", zone, front_table_id, back_table_id);
             for (uint16_t i = front_table_id; i <= back_table_id; i++) {
-                m_tables[zone][i]->remove_shard((*it).get());
-                if (m_tables[zone][i]->no_shard()) {
-                    m_tables[zone][i] = nullptr;
+                auto table = get_txpool_table(zone, i);
+                table->remove_shard((*it).get());
+                if (table->no_shard()) {
+                    // table object is released by the last in-flight caller that still holds it
+                    std::atomic_store(&m_tables[zone][i], std::shared_ptr<xtxpool_table_t>(nullptr));
                     remove_table_num++;
                 }
             }
@@ -320,7 +323,8 @@ std::shared_ptr<xtxpool_table_t> xtxpool_t::get_txpool_table(uint8_t zone, uint1
     if (!table_zone_subaddr_check(zone, subaddr)) {
         return nullptr;
     }
-    return m_tables[zone][subaddr];
+    // lock free for data path, m_mutex[zone] only serializes subscribe/unsubscribe
+    return std::atomic_load(&m_tables[zone][subaddr]);
 }
 
 xobject_ptr_t<xtxpool_face_t> xtxpool_instance::create_xtxpool_inst(const observer_ptr<store::xstore_face_t> & store,
@@ -347,7 +347,7 @@ int32_t xtxpool_table_t::verify_txs(const std::string & account, const std::vect
         }
 
         xtxpool_v2::xtx_para_t para;
-        std::shared_ptr<xtxpool_v2::xtx_entry> tx_ent = std::make_shared<xtxpool_v2::xtx_entry>(tx, para);
+        std::shared_ptr<xtxpool_v2::xtx_entry> tx_ent = xtxpool_v2::xtx_entry::create(tx, para);
         if (tx->is_send_tx() || tx->is_self_tx()) {
             if (!is_reach_limit(tx_ent)) {
                 xtxpool_info("xtxpool_table_t::verify_txs push tx from proposal tx:%s", tx->dump().c_str());
@@ -6,6 +6,8 @@
 
 #include "xvledger/xreceiptid.h"
 
+#include <map>
+#include <mutex>
 #include <string>
 
 NS_BEG2(top, xtxpool_v2)
@@ -19,8 +21,22 @@ public:
     uint64_t get_height(base::xtable_shortid_t table_id) const;
     base::xreceiptid_state_ptr_t get_table_receiptid_state(base::xtable_shortid_t table_id) const;
 private:
-    mutable std::mutex m_mutex;
-    std::map<base::xtable_shortid_t, base::xreceiptid_state_ptr_t> m_receiptid_state_map;
+    // striped by table id, so tables packing in parallel do not contend on one lock for reading peer receipt id state
+    enum { enum_receiptid_state_cache_shards = 16 };
+    class xreceiptid_state_shard_t {
+    public:
+        mutable std::mutex m_mutex;
+        std::map<base::xtable_shortid_t, base::xreceiptid_state_ptr_t> m_receiptid_state_map;
+    };
+    const xreceiptid_state_shard_t & get_shard(base::xtable_shortid_t table_id) const {
+        return m_shards[table_id % enum_receiptid_state_cache_shards];
+    }
+    xreceiptid_state_shard_t & get_shard(base::xtable_shortid_t table_id) {
+        return m_shards[table_id % enum_receiptid_state_cache_shards];
+    }
+    void get_pair(base::xtable_shortid_t table_id, base::xtable_shortid_t peer_table_id, base::xreceiptid_pair_t & pair) const;
+
+    xreceiptid_state_shard_t m_shards[enum_receiptid_state_cache_shards];
 };
 
 NS_END2
@@ -11,9 +11,12 @@
 #include "xtxpool_v2/xtxpool_face.h"
 #include "xtxpool_v2/xtxpool_info.h"
 
+#include <algorithm>
+#include <cstring>
 #include <map>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -22,9 +25,22 @@ namespace xtxpool_v2 {
 
 using data::xcons_transaction_ptr_t;
 
+// tx hash is sha256 digest already, first 8 bytes are good enough as hash value
+class xtx_hash256_hasher {
+public:
+    size_t operator()(const uint256_t & hash) const {
+        size_t value = 0;
+        std::memcpy(&value, hash.data(), sizeof(value));
+        return value;
+    }
+};
+
 class xready_send_tx_queue_comp {
 public:
-    bool operator()(const std::shared_ptr<xtx_entry> left, const std::shared_ptr<xtx_entry> right) const {
+    bool operator()(const std::shared_ptr<xtx_entry> & left, const std::shared_ptr<xtx_entry> & right) const {
+        return operator()(left.get(), right.get());
+    }
+    bool operator()(xtx_entry * left, xtx_entry * right) const {
         if (left->get_tx()->get_source_addr() == right->get_tx()->get_source_addr()) {
             return left->get_tx()->get_transaction()->get_last_nonce() < right->get_tx()->get_transaction()->get_last_nonce();
         }
@@ -59,12 +75,109 @@ public:
     }
 };
 
-using xready_send_tx_queue_t = std::multiset<std::shared_ptr<xtx_entry>, xready_send_tx_queue_comp>;
+// binary heap of raw entries, entry records its own position(intrusive) so that erase by entry is O(log n).
+// entries are owned by caller and must stay alive while in heap. "first" item by comparator is at top.
+template <typename _comp>
+class xtx_entry_heap_t {
+public:
+    void push(xtx_entry * tx_ent) {
+        tx_ent->set_queue_pos((uint32_t)m_items.size());
+        m_items.push_back(tx_ent);
+        sift_up(m_items.size() - 1);
+    }
+    void erase(xtx_entry * tx_ent) {
+        size_t pos = tx_ent->get_queue_pos();
+        xassert(pos < m_items.size() && m_items[pos] == tx_ent);
+        tx_ent->set_queue_pos(xtx_entry_invalid_queue_pos);
+        xtx_entry * last = m_items.back();
+        m_items.pop_back();
+        if (pos == m_items.size()) {
+            return;
+        }
+        m_items[pos] = last;
+        last->set_queue_pos((uint32_t)pos);
+        if (pos > 0 && m_comp(last, m_items[(pos - 1) / 2])) {
+            sift_up(pos);
+        } else {
+            sift_down(pos);
+        }
+    }
+    size_t size() const {
+        return m_items.size();
+    }
+    bool empty() const {
+        return m_items.empty();
+    }
+    // visit entries in order of comparator without changing heap, stop once visitor return false.
+    // cost is O(k*log(k)) for k visited entries, no matter how many entries in heap.
+    template <typename _visitor>
+    void visit_in_order(_visitor && visitor) const {
+        if (m_items.empty()) {
+            return;
+        }
+        auto frontier_comp = [this](size_t left, size_t right) { return m_comp(m_items[right], m_items[left]); };
+        std::vector<size_t> frontier{0};
+        while (!frontier.empty()) {
+            std::pop_heap(frontier.begin(), frontier.end(), frontier_comp);
+            size_t pos = frontier.back();
+            frontier.pop_back();
+            if (!visitor(m_items[pos])) {
+                return;
+            }
+            for (size_t child = pos * 2 + 1; child <= pos * 2 + 2 && child < m_items.size(); child++) {
+                frontier.push_back(child);
+                std::push_heap(frontier.begin(), frontier.end(), frontier_comp);
+            }
+        }
+    }
+
+private:
+    void sift_up(size_t pos) {
+        xtx_entry * tx_ent = m_items[pos];
+        while (pos > 0) {
+            size_t parent = (pos - 1) / 2;
+            if (!m_comp(tx_ent, m_items[parent])) {
+                break;
+            }
+            m_items[pos] = m_items[parent];
+            m_items[pos]->set_queue_pos((uint32_t)pos);
+            pos = parent;
+        }
+        m_items[pos] = tx_ent;
+        tx_ent->set_queue_pos((uint32_t)pos);
+    }
+    void sift_down(size_t pos) {
+        xtx_entry * tx_ent = m_items[pos];
+        const size_t count = m_items.size();
+        for (;;) {
+            size_t child = pos * 2 + 1;
+            if (child >= count) {
+                break;
+            }
+            if (child + 1 < count && m_comp(m_items[child + 1], m_items[child])) {
+                child++;
+            }
+            if (!m_comp(m_items[child], tx_ent)) {
+                break;
+            }
+            m_items[pos] = m_items[child];
+            m_items[pos]->set_queue_pos((uint32_t)pos);
+            pos = child;
+        }
+        m_items[pos] = tx_ent;
+        tx_ent->set_queue_pos((uint32_t)pos);
+    }
+
+    std::vector<xtx_entry *> m_items;
+    _comp m_comp;
+};
+
+using xready_send_tx_queue_t = xtx_entry_heap_t<xready_send_tx_queue_comp>;
 using xready_receipt_queue_t = std::multiset<std::shared_ptr<xtx_entry>, xready_receipt_queue_comp>;
 using xnon_ready_send_tx_queue_t = std::multiset<std::shared_ptr<xtx_entry>, xnon_ready_send_tx_queue_comp>;
-using xready_send_tx_map_t = std::map<std::string, xready_send_tx_queue_t::iterator>;
+using xready_send_tx_map_t = std::unordered_map<uint256_t, std::shared_ptr<xtx_entry>, xtx_hash256_hasher>;  // owns entries of ready queue
 using xready_receipt_map_t = std::map<std::string, xready_receipt_queue_t::iterator>;
-using xnon_ready_send_tx_map_t = std::map<std::string, xnon_ready_send_tx_queue_t::iterator>;
+using xnon_ready_send_tx_map_t = std::unordered_map<uint256_t, xnon_ready_send_tx_queue_t::iterator, xtx_hash256_hasher>;
 
 class xsend_tx_queue_internal_t {
 public:
@@ -77,8 +190,10 @@ public:
     const std::shared_ptr<xtx_entry> find(const uint256_t & hash) const;
     const std::shared_ptr<xtx_entry> pick_to_be_droped_tx() const;
     const std::vector<std::shared_ptr<xtx_entry>> get_expired_txs() const;
-    const xready_send_tx_queue_t & get_ready_queue() const {
-        return m_ready_tx_queue;
+    // visit ready txs from highest priority, stop once visitor return false
+    template <typename _visitor>
+    void visit_ready_txs(_visitor && visitor) const {
+        m_ready_tx_queue.visit_in_order(std::forward<_visitor>(visitor));
     }
     uint32_t size() const {
         return m_ready_tx_queue.size() + m_non_ready_tx_queue.size();
@@ -191,7 +306,7 @@ public:
 
 private:
     xsend_tx_queue_internal_t m_send_tx_queue_internal;
-    std::map<std::string, std::shared_ptr<xsend_tx_account_t>> m_send_tx_accounts;
+    std::unordered_map<std::string, std::shared_ptr<xsend_tx_account_t>> m_send_tx_accounts;
     mutable basic::xlru_cache<std::string, uint64_t> m_account_nonce_lru;
 };
 
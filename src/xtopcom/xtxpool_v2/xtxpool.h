@@ -8,7 +8,10 @@
 #include "xdata/xcons_transaction.h"
 #include "xtxpool_v2/xtxpool_table.h"
 
+#include <atomic>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <unordered_set>
@@ -56,10 +59,11 @@ private:
     std::shared_ptr<xtxpool_table_t> get_txpool_table_by_addr(const std::shared_ptr<xtx_entry> & tx) const;
     std::shared_ptr<xtxpool_table_t> get_txpool_table(uint8_t zone, uint16_t subaddr) const;
 
-    mutable std::vector<std::shared_ptr<xtxpool_table_t>> m_tables[xtxpool_zone_type_max];
+    // table slots are accessed by std::atomic_load/atomic_store, so push/pack/commit of different tables never share a lock
+    std::vector<std::shared_ptr<xtxpool_table_t>> m_tables[xtxpool_zone_type_max];
     std::vector<std::shared_ptr<xtxpool_shard_info_t>> m_shards[xtxpool_zone_type_max];
     std::shared_ptr<xtxpool_resources_face> m_para;
-    mutable std::mutex m_mutex[xtxpool_zone_type_max];
+    mutable std::mutex m_mutex[xtxpool_zone_type_max];  // lock m_shards and writes of m_tables
     xtxpool_statistic_t m_statistic;
     std::set<base::xtable_shortid_t> m_all_table_sids;
     std::map<base::xtable_shortid_t, uint64_t> m_peer_table_height_cache;
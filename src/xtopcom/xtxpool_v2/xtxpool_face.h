@@ -12,6 +12,7 @@
 #include "xdata/xtable_bstate.h"
 #include "xmbus/xmessage_bus.h"
 #include "xstore/xstore_face.h"
+#include "xtxpool_v2/xtxpool_pool_allocator.h"
 #include "xvledger/xvcertauth.h"
 
 #include <string>
@@ -84,20 +85,34 @@ private:
     std::string m_check_unit_hash;
 };
 
+#define xtx_entry_invalid_queue_pos (0xFFFFFFFF)
+
 class xtx_entry {
 public:
     xtx_entry(const xcons_transaction_ptr_t & tx, const xtx_para_t & para) : m_tx(tx), m_para(para) {
     }
+    // entry and its shared_ptr control block are allocated from pool
+    static std::shared_ptr<xtx_entry> create(const xcons_transaction_ptr_t & tx, const xtx_para_t & para) {
+        return std::allocate_shared<xtx_entry>(xpool_allocator_t<xtx_entry>(), tx, para);
+    }
     xtx_para_t & get_para() {
         return m_para;
     }
     const xcons_transaction_ptr_t & get_tx() const {
         return m_tx;
     }
+    // position at intrusive heap of queue, for O(log n) erase
+    uint32_t get_queue_pos() const {
+        return m_queue_pos;
+    }
+    void set_queue_pos(uint32_t pos) {
+        m_queue_pos = pos;
+    }
 
 private:
     xcons_transaction_ptr_t m_tx;
     xtx_para_t m_para;
+    uint32_t m_queue_pos{xtx_entry_invalid_queue_pos};
 };
 
 class xready_account_t {
@@ -0,0 +1,101 @@
+// Copyright (c) 2017-2018 Telos Foundation & contributors
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace top {
+namespace xtxpool_v2 {
+
+// free list of fixed size blocks, released blocks are kept for reuse instead of returning to heap.
+// txpool create and release tx entries at high rate under spam, so malloc/free would be hot path.
+template <size_t _block_size>
+class xfixed_size_pool_t {
+public:
+    static xfixed_size_pool_t & instance() {
+        static xfixed_size_pool_t * _pool = new xfixed_size_pool_t();  // never destroyed, entries may be released at exit
+        return *_pool;
+    }
+
+    void * alloc() {
+        {
+            std::lock_guard<std::mutex> lck(m_mutex);
+            if (!m_free_blocks.empty()) {
+                void * block = m_free_blocks.back();
+                m_free_blocks.pop_back();
+                return block;
+            }
+        }
+        return ::operator new(_block_size);
+    }
+
+    void free(void * block) {
+        {
+            std::lock_guard<std::mutex> lck(m_mutex);
+            if (m_free_blocks.size() < max_free_blocks) {
+                m_free_blocks.push_back(block);
+                return;
+            }
+        }
+        ::operator delete(block);
+    }
+
+private:
+    xfixed_size_pool_t() {
+        m_free_blocks.reserve(max_free_blocks);
+    }
+
+    static constexpr size_t max_free_blocks = 64 * 1024;
+    std::mutex m_mutex;
+    std::vector<void *> m_free_blocks;
+};
+
+// std allocator backed by xfixed_size_pool_t, used by std::allocate_shared so object and control block are one pooled block.
+template <typename T>
+class xpool_allocator_t {
+public:
+    using value_type = T;
+
+    xpool_allocator_t() = default;
+    template <typename U>
+    xpool_allocator_t(const xpool_allocator_t<U> &) {
+    }
+
+    template <typename U>
+    struct rebind {
+        using other = xpool_allocator_t<U>;
+    };
+
+    T * allocate(size_t n) {
+        if (n != 1) {
+            return static_cast<T *>(::operator new(n * sizeof(T)));
+        }
+        return static_cast<T *>(xfixed_size_pool_t<sizeof(T)>::instance().alloc());
+    }
+
+    void deallocate(T * p, size_t n) {
+        if (n != 1) {
+            ::operator delete(p);
+            return;
+        }
+        xfixed_size_pool_t<sizeof(T)>::instance().free(p);
+    }
+};
+
+template <typename T, typename U>
+bool operator==(const xpool_allocator_t<T> &, const xpool_allocator_t<U> &) {
+    return true;
+}
+
+template <typename T, typename U>
+bool operator!=(const xpool_allocator_t<T> &, const xpool_allocator_t<U> &) {
+    return false;
+}
+
+}  // namespace xtxpool_v2
+}  // namespace top
@@ -58,6 +58,38 @@ base::xauto_ptr<base::xvtxindex_t> xtxstoreimpl::load_tx_idx(const std::string &
     return txindex;
 }
 
+std::vector<base::xvtxindex_ptr> xtxstoreimpl::load_tx_idxs(const std::vector<base::xvtxkey_t> & tx_keys) {
+    std::vector<std::string> tx_idx_keys;
+    tx_idx_keys.reserve(tx_keys.size());
+    for (auto const & tx_key : tx_keys) {
+        base::enum_txindex_type txindex_type = base::xvtxkey_t::transaction_subtype_to_txindex_type(tx_key.get_tx_subtype());
+        tx_idx_keys.push_back(base::xvdbkey_t::create_tx_index_key(tx_key.get_tx_hash(), txindex_type));
+    }
+
+    std::vector<base::xvtxindex_ptr> txindexs(tx_keys.size());
+    std::vector<std::string> tx_idx_bins;
+    std::vector<bool> found_flags;
+    if (!base::xvchain_t::instance().get_xdbstore()->get_values(tx_idx_keys, tx_idx_bins, found_flags) || tx_idx_bins.size() != tx_idx_keys.size() || found_flags.size() != tx_idx_keys.size()) {
+        xwarn("xvtxstore_t::load_tx_idxs,fail to batch read %zu indexs", tx_idx_keys.size());
+        return txindexs;
+    }
+
+    for (size_t i = 0; i < tx_keys.size(); ++i) {
+        if (!found_flags[i]) {
+            xdbg("xvtxstore_t::load_tx_idxs,index not find for hahs_tx=%s", base::xstring_utl::to_hex(tx_keys[i].get_tx_hash()).c_str());  // caller decides if it is an error
+            continue;
+        }
+        base::xvtxindex_ptr txindex = make_object_ptr<base::xvtxindex_t>();
+        if (txindex->serialize_from_string(tx_idx_bins[i]) <= 0) {
+            xerror("xvtxstore_t::load_tx_idxs,found bad index for hahs_tx=%s", base::xstring_utl::to_hex(tx_keys[i].get_tx_hash()).c_str());
+            continue;
+        }
+        txindex->set_tx_hash(tx_keys[i].get_tx_hash());
+        txindexs[i] = txindex;
+    }
+    return txindexs;
+}
+
 const std::string xtxstoreimpl::load_tx_bin(const std::string & raw_tx_hash) {
     xassert(raw_tx_hash.empty() == false);
     if (raw_tx_hash.empty())
@@ -533,7 +533,7 @@ void xbatch_packer::make_receipts_and_send(xblock_t * commit_block, xblock_t * c
 
     for (auto & tx : non_shard_cross_receipts) {
         xtxpool_v2::xtx_para_t para;
-        std::shared_ptr<xtxpool_v2::xtx_entry> tx_ent = std::make_shared<xtxpool_v2::xtx_entry>(tx, para);
+        std::shared_ptr<xtxpool_v2::xtx_entry> tx_ent = xtxpool_v2::xtx_entry::create(tx, para);
         m_para->get_resources()->get_txpool()->push_receipt(tx_ent, true, false);
         XMETRICS_GAUGE(metrics::txpool_received_self_send_receipt_num, 1);
     }
@@ -0,0 +1,398 @@
+// Copyright (c) 2017-2018 Telos Foundation & contributors
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+#include "xutility/xsha256_batch.h"
+
+#include <atomic>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+    #define XSHA256_ENABLE_X86
+    #include <cpuid.h>
+    #include <immintrin.h>
+#endif
+
+namespace top
+{
+    namespace utl
+    {
+        namespace
+        {
+            const uint32_t sha256_k[64] = {
+                0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+                0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+                0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+                0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+                0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+                0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+                0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+                0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+            };
+            const uint32_t sha256_init[8] = {
+                0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19,
+            };
+
+            inline uint32_t load_be32(const uint8_t * p)
+            {
+                return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+            }
+
+            inline void store_be32(uint8_t * p, uint32_t v)
+            {
+                p[0] = (uint8_t)(v >> 24);
+                p[1] = (uint8_t)(v >> 16);
+                p[2] = (uint8_t)(v >> 8);
+                p[3] = (uint8_t)v;
+            }
+
+            inline uint32_t rotr32(uint32_t x, int n)
+            {
+                return (x >> n) | (x << (32 - n));
+            }
+
+            //the second block of a 64 bytes message is always the padding block: 0x80,zeros,bit length(512)
+            struct xpadding_block_t
+            {
+                xpadding_block_t()
+                {
+                    memset(data, 0, sizeof(data));
+                    data[0]  = 0x80;
+                    data[62] = 0x02;
+
+                    uint32_t w[64];
+                    for (int i = 0; i < 16; ++i)
+                        w[i] = load_be32(data + 4 * i);
+                    for (int i = 16; i < 64; ++i)
+                    {
+                        const uint32_t s0 = rotr32(w[i - 15], 7) ^ rotr32(w[i - 15], 18) ^ (w[i - 15] >> 3);
+                        const uint32_t s1 = rotr32(w[i - 2], 17) ^ rotr32(w[i - 2], 19) ^ (w[i - 2] >> 10);
+                        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+                    }
+                    for (int i = 0; i < 64; ++i)
+                        kw[i] = sha256_k[i] + w[i];
+                }
+                uint8_t  data[64];
+                uint32_t kw[64];  //k + message schedule,constant for every 64 bytes message
+            };
+            const xpadding_block_t padding_64bytes;
+
+            void compress_scalar(uint32_t state[8], const uint8_t * data, size_t blocks)
+            {
+                uint32_t w[64];
+                while (blocks-- > 0)
+                {
+                    for (int i = 0; i < 16; ++i)
+                        w[i] = load_be32(data + 4 * i);
+                    for (int i = 16; i < 64; ++i)
+                    {
+                        const uint32_t s0 = rotr32(w[i - 15], 7) ^ rotr32(w[i - 15], 18) ^ (w[i - 15] >> 3);
+                        const uint32_t s1 = rotr32(w[i - 2], 17) ^ rotr32(w[i - 2], 19) ^ (w[i - 2] >> 10);
+                        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+                    }
+
+                    uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+                    uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+                    for (int i = 0; i < 64; ++i)
+                    {
+                        const uint32_t t1 = h + (rotr32(e, 6) ^ rotr32(e, 11) ^ rotr32(e, 25)) + ((e & f) ^ (~e & g)) + sha256_k[i] + w[i];
+                        const uint32_t t2 = (rotr32(a, 2) ^ rotr32(a, 13) ^ rotr32(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+                        h = g;
+                        g = f;
+                        f = e;
+                        e = d + t1;
+                        d = c;
+                        c = b;
+                        b = a;
+                        a = t1 + t2;
+                    }
+                    state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+                    state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+                    data += 64;
+                }
+            }
+
+#ifdef XSHA256_ENABLE_X86
+            //sha extensions,one message at a time but 2 rounds per instruction
+            __attribute__((target("sha,sse4.1,ssse3")))
+            void compress_shani(uint32_t state[8], const uint8_t * data, size_t blocks)
+            {
+                const __m128i byte_swap_mask = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+                __m128i tmp    = _mm_loadu_si128((const __m128i *)&state[0]);
+                __m128i state1 = _mm_loadu_si128((const __m128i *)&state[4]);
+                tmp    = _mm_shuffle_epi32(tmp, 0xB1);          //CDAB
+                state1 = _mm_shuffle_epi32(state1, 0x1B);       //EFGH
+                __m128i state0 = _mm_alignr_epi8(tmp, state1, 8);  //ABEF
+                state1 = _mm_blend_epi16(state1, tmp, 0xF0);    //CDGH
+
+                while (blocks-- > 0)
+                {
+                    const __m128i abef_save = state0;
+                    const __m128i cdgh_save = state1;
+
+                    __m128i w[4];
+                    for (int i = 0; i < 4; ++i)
+                        w[i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 16 * i)), byte_swap_mask);
+
+                    //each loop run 4 rounds,and extend message schedule of the later groups
+                    for (int i = 0; i < 16; ++i)
+                    {
+                        __m128i msg = _mm_add_epi32(w[i & 3], _mm_loadu_si128((const __m128i *)&sha256_k[4 * i]));
+                        state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+                        if (i >= 3 && i < 15)
+                        {
+                            tmp = _mm_alignr_epi8(w[i & 3], w[(i - 1) & 3], 4);
+                            w[(i + 1) & 3] = _mm_add_epi32(w[(i + 1) & 3], tmp);
+                            w[(i + 1) & 3] = _mm_sha256msg2_epu32(w[(i + 1) & 3], w[i & 3]);
+                        }
+                        msg = _mm_shuffle_epi32(msg, 0x0E);
+                        state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+                        if (i >= 1 && i < 13)
+                            w[(i - 1) & 3] = _mm_sha256msg1_epu32(w[(i - 1) & 3], w[i & 3]);
+                    }
+
+                    state0 = _mm_add_epi32(state0, abef_save);
+                    state1 = _mm_add_epi32(state1, cdgh_save);
+                    data += 64;
+                }
+
+                tmp    = _mm_shuffle_epi32(state0, 0x1B);       //FEBA
+                state1 = _mm_shuffle_epi32(state1, 0xB1);       //DCHG
+                state0 = _mm_blend_epi16(tmp, state1, 0xF0);    //DCBA
+                state1 = _mm_alignr_epi8(state1, tmp, 8);       //ABEF
+                _mm_storeu_si128((__m128i *)&state[0], state0);
+                _mm_storeu_si128((__m128i *)&state[4], state1);
+            }
+
+            //8 messages of 64 bytes per pass,one message per 32bit lane
+            #define XSHA256_ROTR_X8(x, n) _mm256_or_si256(_mm256_srli_epi32((x), (n)), _mm256_slli_epi32((x), 32 - (n)))
+
+            __attribute__((target("avx2")))
+            inline void rounds_x8(__m256i s[8], const __m256i * kw_vec, const uint32_t * kw_const)
+            {
+                __m256i a = s[0], b = s[1], c = s[2], d = s[3], e = s[4], f = s[5], g = s[6], h = s[7];
+                for (int i = 0; i < 64; ++i)
+                {
+                    const __m256i kw = (kw_vec != nullptr) ? kw_vec[i] : _mm256_set1_epi32((int)kw_const[i]);
+                    const __m256i sum1 = _mm256_xor_si256(_mm256_xor_si256(XSHA256_ROTR_X8(e, 6), XSHA256_ROTR_X8(e, 11)), XSHA256_ROTR_X8(e, 25));
+                    const __m256i ch   = _mm256_xor_si256(_mm256_and_si256(e, f), _mm256_andnot_si256(e, g));
+                    const __m256i t1   = _mm256_add_epi32(_mm256_add_epi32(_mm256_add_epi32(h, sum1), ch), kw);
+                    const __m256i sum0 = _mm256_xor_si256(_mm256_xor_si256(XSHA256_ROTR_X8(a, 2), XSHA256_ROTR_X8(a, 13)), XSHA256_ROTR_X8(a, 22));
+                    const __m256i maj  = _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(c, _mm256_or_si256(a, b)));
+                    const __m256i t2   = _mm256_add_epi32(sum0, maj);
+                    h = g;
+                    g = f;
+                    f = e;
+                    e = _mm256_add_epi32(d, t1);
+                    d = c;
+                    c = b;
+                    b = a;
+                    a = _mm256_add_epi32(t1, t2);
+                }
+                s[0] = _mm256_add_epi32(s[0], a); s[1] = _mm256_add_epi32(s[1], b);
+                s[2] = _mm256_add_epi32(s[2], c); s[3] = _mm256_add_epi32(s[3], d);
+                s[4] = _mm256_add_epi32(s[4], e); s[5] = _mm256_add_epi32(s[5], f);
+                s[6] = _mm256_add_epi32(s[6], g); s[7] = _mm256_add_epi32(s[7], h);
+            }
+
+            __attribute__((target("avx2")))
+            void digest_64bytes_x8_avx2(const uint8_t * in, uint8_t * out)
+            {
+                __m256i w[64];
+                for (int i = 0; i < 16; ++i)
+                {
+                    const uint8_t * p = in + 4 * i;
+                    w[i] = _mm256_setr_epi32((int)load_be32(p), (int)load_be32(p + 64), (int)load_be32(p + 128), (int)load_be32(p + 192),
+                                             (int)load_be32(p + 256), (int)load_be32(p + 320), (int)load_be32(p + 384), (int)load_be32(p + 448));
+                }
+                for (int i = 16; i < 64; ++i)
+                {
+                    const __m256i s0 = _mm256_xor_si256(_mm256_xor_si256(XSHA256_ROTR_X8(w[i - 15], 7), XSHA256_ROTR_X8(w[i - 15], 18)), _mm256_srli_epi32(w[i - 15], 3));
+                    const __m256i s1 = _mm256_xor_si256(_mm256_xor_si256(XSHA256_ROTR_X8(w[i - 2], 17), XSHA256_ROTR_X8(w[i - 2], 19)), _mm256_srli_epi32(w[i - 2], 10));
+                    w[i] = _mm256_add_epi32(_mm256_add_epi32(w[i - 16], s0), _mm256_add_epi32(w[i - 7], s1));
+                }
+                for (int i = 0; i < 64; ++i)
+                    w[i] = _mm256_add_epi32(w[i], _mm256_set1_epi32((int)sha256_k[i]));
+
+                __m256i s[8];
+                for (int i = 0; i < 8; ++i)
+                    s[i] = _mm256_set1_epi32((int)sha256_init[i]);
+                rounds_x8(s, w, nullptr);
+                rounds_x8(s, nullptr, padding_64bytes.kw);
+
+                uint32_t lanes[8][8];  //[word][message]
+                for (int i = 0; i < 8; ++i)
+                    _mm256_storeu_si256((__m256i *)lanes[i], s[i]);
+                for (int m = 0; m < 8; ++m)
+                {
+                    for (int i = 0; i < 8; ++i)
+                        store_be32(out + 32 * m + 4 * i, lanes[i][m]);
+                }
+            }
+            #undef XSHA256_ROTR_X8
+
+            bool cpu_support_shani()
+            {
+                unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+                if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) == 0)
+                    return false;
+                const bool ssse3  = (ecx & (1u << 9)) != 0;
+                const bool sse4_1 = (ecx & (1u << 19)) != 0;
+                if (__get_cpuid_max(0, nullptr) < 7)
+                    return false;
+                __cpuid_count(7, 0, eax, ebx, ecx, edx);
+                return ssse3 && sse4_1 && ((ebx & (1u << 29)) != 0);
+            }
+
+            bool cpu_support_avx2()
+            {
+                unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+                if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) == 0)
+                    return false;
+                const bool osxsave = (ecx & (1u << 27)) != 0;
+                const bool avx     = (ecx & (1u << 28)) != 0;
+                if (!osxsave || !avx)
+                    return false;
+                uint32_t xcr0_lo = 0, xcr0_hi = 0;
+                __asm__ volatile("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+                if ((xcr0_lo & 0x6) != 0x6)  //os must save xmm & ymm registers
+                    return false;
+                if (__get_cpuid_max(0, nullptr) < 7)
+                    return false;
+                __cpuid_count(7, 0, eax, ebx, ecx, edx);
+                return (ebx & (1u << 5)) != 0;
+            }
+#endif //XSHA256_ENABLE_X86
+
+            bool is_impl_supported(xsha256_batch_t::xsha256_impl_t impl)
+            {
+#ifdef XSHA256_ENABLE_X86
+                if (impl == xsha256_batch_t::xsha256_impl_t::shani)
+                    return cpu_support_shani();
+                if (impl == xsha256_batch_t::xsha256_impl_t::avx2)
+                    return cpu_support_avx2();
+#endif
+                return impl == xsha256_batch_t::xsha256_impl_t::scalar;
+            }
+
+            xsha256_batch_t::xsha256_impl_t detect_best_impl()
+            {
+                if (is_impl_supported(xsha256_batch_t::xsha256_impl_t::shani))
+                    return xsha256_batch_t::xsha256_impl_t::shani;
+                if (is_impl_supported(xsha256_batch_t::xsha256_impl_t::avx2))
+                    return xsha256_batch_t::xsha256_impl_t::avx2;
+                return xsha256_batch_t::xsha256_impl_t::scalar;
+            }
+
+            bool cpu_batch_avx2()
+            {
+#ifdef XSHA256_ENABLE_X86
+                static const bool _support = cpu_support_avx2();
+                return _support;
+#else
+                return false;
+#endif
+            }
+
+            std::atomic<int> & current_impl()
+            {
+                static std::atomic<int> _impl((int)detect_best_impl());
+                return _impl;
+            }
+
+            //avx2 only benefit on multiple messages,single message always use sha-ni or scalar
+            inline void compress(const xsha256_batch_t::xsha256_impl_t impl, uint32_t state[8], const uint8_t * data, size_t blocks)
+            {
+#ifdef XSHA256_ENABLE_X86
+                if (impl == xsha256_batch_t::xsha256_impl_t::shani)
+                {
+                    compress_shani(state, data, blocks);
+                    return;
+                }
+#endif
+                compress_scalar(state, data, blocks);
+            }
+
+            inline void store_digest(const uint32_t state[8], uint8_t * out)
+            {
+                for (int i = 0; i < 8; ++i)
+                    store_be32(out + 4 * i, state[i]);
+            }
+        }
+
+        void xsha256_batch_t::digest(const void * data, size_t size, uint8_t * out)
+        {
+            const xsha256_impl_t impl = get_impl();
+            const uint8_t * bytes = (const uint8_t *)data;
+
+            uint32_t state[8];
+            memcpy(state, sha256_init, sizeof(state));
+            const size_t full_blocks = size / 64;
+            if (full_blocks > 0)
+                compress(impl, state, bytes, full_blocks);
+
+            //last 1 or 2 blocks with padding
+            uint8_t tail[128];
+            const size_t rest = size - full_blocks * 64;
+            memset(tail, 0, sizeof(tail));
+            if (rest > 0)
+                memcpy(tail, bytes + full_blocks * 64, rest);
+            tail[rest] = 0x80;
+            const size_t tail_blocks = (rest + 1 + 8 <= 64) ? 1 : 2;
+            const uint64_t bits = (uint64_t)size * 8;
+            store_be32(tail + tail_blocks * 64 - 8, (uint32_t)(bits >> 32));
+            store_be32(tail + tail_blocks * 64 - 4, (uint32_t)bits);
+            compress(impl, state, tail, tail_blocks);
+
+            store_digest(state, out);
+        }
+
+        void xsha256_batch_t::digest_64bytes(const uint8_t * in, uint8_t * out, size_t count)
+        {
+            const xsha256_impl_t impl = get_impl();
+            size_t i = 0;
+#ifdef XSHA256_ENABLE_X86
+            //8 lanes of avx2 run faster than sha-ni one by one at most cpus,so use it for batch whenever allowed
+            if ((impl != xsha256_impl_t::scalar) && cpu_batch_avx2())
+            {
+                for (; i + 8 <= count; i += 8)
+                    digest_64bytes_x8_avx2(in + 64 * i, out + 32 * i);
+            }
+#endif
+            for (; i < count; ++i)
+            {
+                uint32_t state[8];
+                memcpy(state, sha256_init, sizeof(state));
+                compress(impl, state, in + 64 * i, 1);
+                compress(impl, state, padding_64bytes.data, 1);
+                store_digest(state, out + 32 * i);
+            }
+        }
+
+        xsha256_batch_t::xsha256_impl_t xsha256_batch_t::get_impl()
+        {
+            return (xsha256_impl_t)current_impl().load(std::memory_order_relaxed);
+        }
+
+        const char * xsha256_batch_t::get_impl_name()
+        {
+            switch (get_impl())
+            {
+                case xsha256_impl_t::shani:
+                    return "sha-ni";
+                case xsha256_impl_t::avx2:
+                    return "avx2";
+                default:
+                    return "scalar";
+            }
+        }
+
+        bool xsha256_batch_t::set_impl(xsha256_impl_t impl)
+        {
+            if (!is_impl_supported(impl))
+                return false;
+            current_impl().store((int)impl, std::memory_order_relaxed);
+            return true;
+        }
+    }
+} //end of namespace top
@@ -0,0 +1,45 @@
+// Copyright (c) 2017-2018 Telos Foundation & contributors
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#pragma once
+
+#include "xbase/xns_macro.h"
+
+#include <cstddef>
+#include <cstdint>
+
+NS_BEG2(top, utl)
+
+/// sha2-256 for merkle tree, produce exactly same digest as xsha2_256_t
+/** implementation is picked once by cpu features: sha-ni > avx2 > scalar
+ batch of 64 bytes messages run 8 messages per pass by avx2 whenever impl is not scalar,single message use sha-ni if impl is sha-ni
+ Usage:
+ uint8_t nodes[64 * 4];  // 4 pairs of child hashes
+ uint8_t parents[32 * 4];
+ xsha256_batch_t::digest_64bytes(nodes, parents, 4);
+ */
+class xsha256_batch_t
+{
+public:
+    enum class xsha256_impl_t : uint8_t
+    {
+        scalar = 0,
+        avx2   = 1,
+        shani  = 2,
+    };
+    enum { enum_digest_size = 32 };
+
+public:
+    /// digest any data,out must have 32 bytes
+    static void             digest(const void * data, size_t size, uint8_t * out);
+    /// digest count messages of 64 bytes each(e.g. left + right child), message i at in + 64 * i, digest i to out + 32 * i
+    static void             digest_64bytes(const uint8_t * in, uint8_t * out, size_t count);
+
+    static xsha256_impl_t   get_impl();
+    static const char *     get_impl_name();
+    /// for test & benchmark only,return false when cpu not support it
+    static bool             set_impl(xsha256_impl_t impl);
+};
+
+NS_END2
@@ -0,0 +1,168 @@
+// Copyright (c) 2018-2020 Telos Foundation & contributors
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <string.h>
+#include "../xmerkle_flat.h"
+#include "xutility/xsha256_batch.h"
+#include "xmetrics/xmetrics.h"
+
+namespace top
+{
+    namespace base
+    {
+        xmerkle_flat_t::xmerkle_flat_t(const std::vector<std::string> & leafs, bool with_leaf_index)
+        {
+            build(leafs, with_leaf_index);
+        }
+
+        bool  xmerkle_flat_t::build(const std::vector<std::string> & leafs, bool with_leaf_index)
+        {
+            m_leafs_count = 0;
+            m_nodes.clear();
+            m_level_offsets.clear();
+            m_level_sizes.clear();
+            m_root.clear();
+            m_has_leaf_index = false;
+            m_leaf_index.clear();
+            if (leafs.empty())
+                return false;
+
+            //n + n/2 + ... ,the odd node of each level moves up as hash of itself
+            size_t total_nodes = 0;
+            for (size_t count = leafs.size(); ; count = (count + 1) / 2)
+            {
+                m_level_offsets.push_back(total_nodes);
+                m_level_sizes.push_back(count);
+                total_nodes += count;
+                if (count == 1)
+                    break;
+            }
+            m_nodes.resize(total_nodes * enum_node_size);
+
+            uint8_t * leaf_nodes = m_nodes.data();
+            for (size_t i = 0; i < leafs.size(); ++i)
+                utl::xsha256_batch_t::digest(leafs[i].data(), leafs[i].size(), leaf_nodes + i * enum_node_size);
+
+            for (size_t level = 0; level + 1 < m_level_sizes.size(); ++level)
+            {
+                const size_t    count  = m_level_sizes[level];
+                const uint8_t * nodes  = m_nodes.data() + m_level_offsets[level] * enum_node_size;
+                uint8_t *       parent = m_nodes.data() + m_level_offsets[level + 1] * enum_node_size;
+                //left and right child are adjacent,so every pair is one 64 bytes message
+                utl::xsha256_batch_t::digest_64bytes(nodes, parent, count / 2);
+                if (count & 1)
+                    utl::xsha256_batch_t::digest(nodes + (count - 1) * enum_node_size, enum_node_size, parent + (count / 2) * enum_node_size);
+            }
+            XMETRICS_GAUGE(metrics::cpu_merkle_hash_calc, total_nodes);
+
+            m_leafs_count = leafs.size();
+            m_root.assign((const char *)get_node(m_level_sizes.size() - 1, 0), enum_node_size);
+
+            //build index here instead of at first find_leaf,so readers never write
+            if (!with_leaf_index)
+                return true;
+            m_has_leaf_index = true;
+            m_leaf_index.reserve(m_leafs_count);
+            for (size_t i = 0; i < m_leafs_count; ++i)
+                m_leaf_index.emplace(std::string((const char *)get_node(0, i), enum_node_size), i); //keep first one for same leafs
+            return true;
+        }
+
+        int64_t  xmerkle_flat_t::find_leaf(const std::string & leaf) const
+        {
+            if (m_leafs_count == 0)
+                return -1;
+
+            std::string leaf_hash(enum_node_size, 0);
+            utl::xsha256_batch_t::digest(leaf.data(), leaf.size(), (uint8_t *)&leaf_hash[0]);
+            if (!m_has_leaf_index)
+            {
+                for (size_t i = 0; i < m_leafs_count; ++i)
+                {
+                    if (memcmp(get_node(0, i), leaf_hash.data(), enum_node_size) == 0)
+                        return (int64_t)i;
+                }
+                return -1;
+            }
+            auto iter = m_leaf_index.find(leaf_hash);
+            if (iter == m_leaf_index.end())
+                return -1;
+            return (int64_t)iter->second;
+        }
+
+        bool  xmerkle_flat_t::calc_path(const size_t leaf_index, std::vector<xmerkle_path_node_t<uint256_t>> & hash_path) const
+        {
+            if (leaf_index >= m_leafs_count)
+                return false;
+
+            //same level numbering as xmerkle_t: log2(leafs count) + 1 at leafs and minus 1 for each level up
+            uint32_t node_level = 1;
+            for (size_t count = m_leafs_count; count > 1; count >>= 1)
+                node_level++;
+
+            size_t index = leaf_index;
+            for (size_t level = 0; level + 1 < m_level_sizes.size(); ++level, index /= 2, node_level--)
+            {
+                const size_t count = m_level_sizes[level];
+                xmerkle_path_node_t<uint256_t> node;
+                node.level = node_level;
+                if (index & 1)
+                {
+                    node.pos = 1;
+                    node.signature = std::string((const char *)get_node(level, index - 1), enum_node_size);
+                }
+                else if (index == count - 1)
+                {
+                    if (!hash_path.empty()) //only first odd node need added
+                        continue;
+                    node.pos = 0;
+                    node.signature = std::string((const char *)get_node(level, index), enum_node_size);
+                }
+                else
+                {
+                    node.pos = 2;
+                    node.signature = std::string((const char *)get_node(level, index + 1), enum_node_size);
+                }
+                hash_path.push_back(node);
+            }
+            return true;
+        }
+
+        bool  xmerkle_flat_t::calc_path(const std::string & leaf, std::vector<xmerkle_path_node_t<uint256_t>> & hash_path) const
+        {
+            const int64_t leaf_index = find_leaf(leaf);
+            if (leaf_index < 0)
+            {
+                xassert(0);
+                return false;
+            }
+            return calc_path((size_t)leaf_index, hash_path);
+        }
+
+        xinput_merkle_t::xinput_merkle_t(const std::vector<std::string> & leafs, const std::vector<std::string> & leaf_txhashs)
+            :m_tree(leafs)
+        {
+            xassert(leafs.size() == leaf_txhashs.size());
+            m_txhash_leafs.reserve(leaf_txhashs.size());
+            for (size_t i = 0; i < leaf_txhashs.size(); ++i)
+            {
+                if (leaf_txhashs[i].empty())
+                    continue;
+
+                auto result = m_txhash_leafs.emplace(leaf_txhashs[i], (int64_t)i);
+                if (!result.second)
+                    result.first->second = -1; //same tx at more than one leaf,caller should find it by leaf data
+            }
+        }
+
+        int64_t  xinput_merkle_t::find_tx_leaf(const std::string & txhash) const
+        {
+            auto iter = m_txhash_leafs.find(txhash);
+            if (iter == m_txhash_leafs.end())
+                return -1;
+            return iter->second;
+        }
+
+    }//end of namespace of base
+}//end of namespace top
@@ -132,15 +132,20 @@ namespace top
                 xassert(false);
                 return {};
             }
-            // get all leafs firstly for performance
-            std::vector<std::string> all_leafs = xvblockmaker_t::get_input_merkle_leafs(commit_block->get_input());
-
-            xmerkle_t<utl::xsha2_256_t, uint256_t> merkle(all_leafs);
+            // merkle tree and tx leaf index are built once and carried by input
+            xinput_merkle_ptr_t merkle = xvblockmaker_t::get_input_merkle(commit_block->get_input());
+            if (merkle == nullptr) {
+                xassert(false);
+                return {};
+            }
             // #3 calc leaf path and make rceipt
             std::vector<xfull_txreceipt_t> txreceipts;
             for (auto & action : actions) {
                 xmerkle_path_256_t hash_path;
-                if (false == xvblockmaker_t::calc_merkle_path(action, hash_path, merkle)) {
+                int64_t leaf_index = merkle->find_tx_leaf(action.get_org_tx_hash());
+                bool ret = leaf_index >= 0 ? merkle->get_tree().calc_path((size_t)leaf_index, hash_path.get_levels_for_write())
+                                           : xvblockmaker_t::calc_merkle_path(action, hash_path, merkle->get_tree());
+                if (false == ret) {
                     xassert(false);
                     return {};
                 }
@@ -154,7 +159,7 @@ namespace top
                 txreceipts.push_back(full_txreceipt);
             }
             xdbg("xtxreceipt_build_t::create_all_txreceipts,block=%s,receipts=%zu,allleafs=%zu,",
-                commit_block->dump().c_str(), txreceipts.size(), all_leafs.size());
+                commit_block->dump().c_str(), txreceipts.size(), merkle->get_tree().get_leafs_count());
             return txreceipts;
         }
 
@@ -242,8 +247,11 @@ namespace top
                 xassert(false);
                 return nullptr;
             }
-            // get all leafs firstly for performance
-            std::vector<std::string> all_leafs = xvblockmaker_t::get_input_merkle_leafs(commit_block->get_input());
+            xinput_merkle_ptr_t merkle = xvblockmaker_t::get_input_merkle(commit_block->get_input());
+            if (merkle == nullptr) {
+                xassert(false);
+                return nullptr;
+            }
 
             auto primary_entity = commit_block->get_input()->get_primary_entity();
             if (primary_entity == nullptr) {
@@ -259,8 +267,7 @@ namespace top
 
             auto & action = actions[0];
             xmerkle_path_256_t hash_path;
-            xmerkle_t<utl::xsha2_256_t, uint256_t> merkle(all_leafs);
-            if (false == xvblockmaker_t::calc_merkle_path(action, hash_path, merkle)) {
+            if (false == xvblockmaker_t::calc_merkle_path(action, hash_path, merkle->get_tree())) {
                 xassert(false);
                 return nullptr;
             }
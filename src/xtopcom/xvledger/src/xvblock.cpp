@@ -1189,6 +1189,18 @@ namespace top
             }
             return total_count;
         }
+
+        std::shared_ptr<xinput_merkle_t> xvinput_t::get_merkle() const
+        {
+            std::lock_guard<std::mutex> lock(m_merkle_lock);
+            return m_merkle;
+        }
+
+        void xvinput_t::set_merkle(const std::shared_ptr<xinput_merkle_t> & merkle)
+        {
+            std::lock_guard<std::mutex> lock(m_merkle_lock);
+            m_merkle = merkle;
+        }
         
         std::string xvinput_t::dump() const
         {
@@ -2662,10 +2674,15 @@ namespace top
         //create a  xvheader_t from bin data(could be from DB or from network)
         base::xvblock_t*  xvblock_t::create_block_object(const std::string & vblock_serialized_data)
         {
-            if(vblock_serialized_data.empty()) //check first
+            return create_block_object(vblock_serialized_data.data(),vblock_serialized_data.size());
+        }
+    
+        base::xvblock_t*  xvblock_t::create_block_object(const char* vblock_serialized_data,const size_t data_size)
+        {
+            if( (NULL == vblock_serialized_data) || (0 == data_size) ) //check first
                 return NULL;
             
-            xstream_t _stream(xcontext_t::instance(),(uint8_t*)vblock_serialized_data.data(),(uint32_t)vblock_serialized_data.size());
+            xstream_t _stream(xcontext_t::instance(),(uint8_t*)vblock_serialized_data,(uint32_t)data_size);
             xdataunit_t*  _data_obj_ptr = xdataunit_t::read_from(_stream);
             if(NULL == _data_obj_ptr)
             {
@@ -5,6 +5,7 @@
 #include <string>
 #include "xvledger/xvblockbuild.h"
 #include "xvledger/xmerkle.hpp"
+#include "xvledger/xmerkle_flat.h"
 #include "xutility/xhash.h"
 
 namespace top
@@ -345,8 +346,8 @@ namespace top
 
         std::string  xvblockbuild_t::build_mpt_root(const std::vector<std::string> & elements)
         {
-            xmerkle_t<utl::xsha2_256_t, uint256_t> merkle; // TODO(jimmy)
-            std::string root = merkle.calc_root(elements);
+            xmerkle_flat_t merkle(elements, false); //only root is needed
+            const std::string & root = merkle.get_root();
             xassert(!root.empty());
             return root;
         }
@@ -490,15 +491,22 @@ namespace top
         }
 
         std::vector<std::string> xvblockmaker_t::get_input_merkle_leafs(xvinput_t* input) {
-            // input root = merkle(all input actions of all entitys)
             std::vector<std::string> leafs;
+            if (!get_input_merkle_leafs(input, leafs, nullptr)) {
+                return {};
+            }
+            return leafs;
+        }
+
+        bool xvblockmaker_t::get_input_merkle_leafs(xvinput_t* input, std::vector<std::string> & leafs, std::vector<std::string> * leaf_txhashs) {
+            // input root = merkle(all input actions of all entitys)
             auto & all_entitys = input->get_entitys();
             for (auto & entity : all_entitys) {
                 // it must be xinentitys
                 xvinentity_t* _inentity = dynamic_cast<xvinentity_t*>(entity);
                 if (_inentity == nullptr) {
                     xassert(false);
-                    return {};
+                    return false;
                 }
                 auto & all_actions = _inentity->get_actions();
                 for (auto & action : all_actions) {
@@ -506,11 +514,34 @@ namespace top
                     action.serialize_to(action_bin);
                     if (!action_bin.empty()) {
                         leafs.push_back(action_bin);
+                        if (leaf_txhashs != nullptr) {
+                            leaf_txhashs->push_back(action.get_org_tx_hash());
+                        }
                     }
                 }
             }
+            return true;
+        }
 
-            return leafs;
+        xinput_merkle_ptr_t xvblockmaker_t::get_input_merkle(xvinput_t* input) {
+            if (input == nullptr) {
+                return nullptr;
+            }
+            xinput_merkle_ptr_t merkle = input->get_merkle();
+            if (merkle != nullptr) {
+                XMETRICS_GAUGE(metrics::cpu_merkle_input_index_hit, 1);
+                return merkle;
+            }
+
+            std::vector<std::string> leafs;
+            std::vector<std::string> leaf_txhashs;
+            if (!get_input_merkle_leafs(input, leafs, &leaf_txhashs) || leafs.empty()) {
+                return nullptr;
+            }
+            merkle = std::make_shared<xinput_merkle_t>(leafs, leaf_txhashs);
+            input->set_merkle(merkle);  // build again by other thread at same time is harmless,all get same tree
+            XMETRICS_GAUGE(metrics::cpu_merkle_input_index_hit, 0);
+            return merkle;
         }
 
         bool xvblockmaker_t::calc_merkle_path(const std::vector<std::string> & leafs, const std::string & leaf, xmerkle_path_256_t& hash_path) {
@@ -520,9 +551,9 @@ namespace top
                 return false;
             }
 
-            int index = static_cast<int>(std::distance(leafs.begin(), iter));
-            xmerkle_t<utl::xsha2_256_t, uint256_t> merkle;
-            return merkle.calc_path(leafs, index, hash_path.get_levels_for_write());
+            size_t index = static_cast<size_t>(std::distance(leafs.begin(), iter));
+            xmerkle_flat_t merkle(leafs, false); //path by index,no need of leaf index
+            return merkle.calc_path(index, hash_path.get_levels_for_write());
         }
 
         bool xvblockmaker_t::calc_merkle_path(const std::vector<std::string> & leafs, const xvaction_t & leaf, xmerkle_path_256_t& hash_path) {
@@ -531,11 +562,11 @@ namespace top
             return calc_merkle_path(leafs, action_bin, hash_path);
         }
         
-        bool xvblockmaker_t::calc_merkle_path(const std::string & leaf, xmerkle_path_256_t& hash_path, xmerkle_t<utl::xsha2_256_t, uint256_t> &merkle) {
-            return merkle.calc_path_hash(leaf, hash_path.get_levels_for_write());
+        bool xvblockmaker_t::calc_merkle_path(const std::string & leaf, xmerkle_path_256_t& hash_path, const xmerkle_flat_t & merkle) {
+            return merkle.calc_path(leaf, hash_path.get_levels_for_write());
         }
 
-        bool xvblockmaker_t::calc_merkle_path(const xvaction_t & leaf, xmerkle_path_256_t& hash_path, xmerkle_t<utl::xsha2_256_t, uint256_t> &merkle) {
+        bool xvblockmaker_t::calc_merkle_path(const xvaction_t & leaf, xmerkle_path_256_t& hash_path, const xmerkle_flat_t & merkle) {
             std::string action_bin;
             leaf.serialize_to(action_bin);
             return calc_merkle_path(action_bin, hash_path, merkle);
@@ -545,20 +576,20 @@ namespace top
             if(input == nullptr)
                 return false;
 
-            std::vector<std::string> leafs = get_input_merkle_leafs(input);
-            if (leafs.empty()) {
+            xinput_merkle_ptr_t merkle = get_input_merkle(input);
+            if (merkle == nullptr) {
                 xassert(0);
                 return false;
             }
-            return calc_merkle_path(leafs, leaf, hash_path);
+            return calc_merkle_path(leaf, hash_path, merkle->get_tree());
         }
 
         // input root = merkle (all input actions)
         bool xvblockmaker_t::make_input_root(xvinput_t* input_obj) {
             //build action' mpt tree,and assign mpt root as input root hash
-            std::vector<std::string> leafs = get_input_merkle_leafs(input_obj);
-            if (!leafs.empty()) {
-                std::string root_hash = build_mpt_root(leafs);
+            xinput_merkle_ptr_t merkle = get_input_merkle(input_obj);
+            if (merkle != nullptr) {
+                const std::string & root_hash = merkle->get_root();
                 if (!root_hash.empty()) {
                     input_obj->set_root_hash(root_hash);
                     return true;
@@ -920,7 +951,7 @@ namespace top
 #endif
             std::string parent_cert_bin;
             parent->get_cert()->serialize_to_string(parent_cert_bin);
-            xmerkle_t<utl::xsha2_256_t, uint256_t> merkle(out_leafs);
+            xmerkle_flat_t merkle(out_leafs);
             for (auto & _unit : units) {
                 if (!_unit->get_cert()->get_extend_cert().empty()) { // already set extend cert
                     xassert(false);
@@ -17,5 +17,14 @@ namespace top
         xvcertauth_t::~xvcertauth_t()
         {
         }
+        
+        void  xvcertauth_t::verify_sign_batch(const std::vector<xvip2_t> & signers,const std::vector<xvqcert_t*> & certs,const std::string & block_account,std::vector<enum_vcert_auth_result> & results)
+        {
+            results.resize(certs.size());
+            for(size_t i = 0; i < certs.size(); ++i)
+            {
+                results[i] = verify_sign(signers[i],certs[i],block_account);
+            }
+        }
     };//end of namespace of base
 };//end of namespace of top
@@ -184,7 +184,7 @@ namespace top
  
         std::recursive_mutex&   xvaccountobj_t::get_table_lock()
         {
-            return m_ref_table.get_lock();
+            return m_ref_table.get_lock(*this);
         }
         
         //fetch and update together
@@ -760,43 +760,55 @@ namespace top
             if(force_clean)
             {
                 //do close under the protection of table 'mutext lock,since plugin might be still running at this case
-                //step#1: acquired mutext lock of table
+                //step#1: acquired mutext lock of table and then every shard(same order as table account->unit account)
                 std::lock_guard<std::recursive_mutex> locker(m_lock);
+                for(int i = 0; i < enum_vtable_account_shards; ++i)
+                    m_account_shards[i].m_mutex.lock();
                 //at here all plugin has doen their job because step#1 has acquired mutex lock
                 
-                //step#2: acquired spin lock of table and clean accounts
-                std::map<std::string,xvaccountobj_t*> clone_accounts;
+                //step#2: acquired spin lock of each shard and clean accounts
+                std::vector<xvaccountobj_t*> clone_accounts;
+                for(int i = 0; i < enum_vtable_account_shards; ++i)
                 {
-                    xauto_lock<xspinlock_t> locker(get_spin_lock());
-                    clone_accounts = m_accounts;
-                    m_accounts.clear();
-                    for(auto it : clone_accounts)//quickly mark stop for account
+                    xaccount_shard_t & shard = m_account_shards[i];
+                    xauto_lock<xspinlock_t> locker(shard.m_spin_lock);
+                    for(auto it : shard.m_accounts)//quickly mark stop for account
                     {
+                        if(it.second == NULL)
+                            continue;
                         it.second->stop();//force to stop and upload meta into account
                         it.second->save_meta(false);//then save meta
+                        clone_accounts.push_back(it.second);
                     }
+                    shard.m_accounts.clear();
                 }
                 //step#3: final close them
                 {
                     for(auto it : clone_accounts)
                     {
-                        it.second->close(false);//force to close(save raw data as well)
-                        it.second->release_ref();//release reference
+                        it->close(false);//force to close(save raw data as well)
+                        it->release_ref();//release reference
                     }
                 }
-
+                
+                for(int i = enum_vtable_account_shards - 1; i >= 0; --i)
+                    m_account_shards[i].m_mutex.unlock();
             }
             else//just clean closed ones
             {
-                xauto_lock<xspinlock_t> locker(get_spin_lock());
-                for(auto it = m_accounts.begin(); it != m_accounts.end();)
+                for(int i = 0; i < enum_vtable_account_shards; ++i)
                 {
-                    auto old = it; //just copy the old value
-                    ++it;
-                    if(old->second->is_close())
+                    xaccount_shard_t & shard = m_account_shards[i];
+                    xauto_lock<xspinlock_t> locker(shard.m_spin_lock);
+                    for(auto it = shard.m_accounts.begin(); it != shard.m_accounts.end();)
                     {
-                        old->second->release_ref();
-                        m_accounts.erase(old);
+                        auto old = it; //just copy the old value
+                        ++it;
+                        if( (old->second != NULL) && old->second->is_close())
+                        {
+                            old->second->release_ref();
+                            shard.m_accounts.erase(old);
+                        }
                     }
                 }
             }
@@ -836,10 +848,23 @@ namespace top
             }
         }
     
+        xvtable_t::xaccount_shard_t&  xvtable_t::get_shard(const std::string & account_address)
+        {
+            return m_account_shards[std::hash<std::string>()(account_address) & (enum_vtable_account_shards - 1)];
+        }
+    
+        std::recursive_mutex&  xvtable_t::get_lock(const xvaccount_t & account_obj)
+        {
+            if(account_obj.is_table_address())
+                return m_lock;
+            return get_shard(account_obj.get_address()).m_mutex;
+        }
+    
         xvaccountobj_t* xvtable_t::find_account_unsafe(const std::string & account_address)
         {
-            auto it = m_accounts.find(account_address);
-            if(it != m_accounts.end())
+            xaccount_shard_t & shard = get_shard(account_address);
+            auto it = shard.m_accounts.find(account_address);
+            if(it != shard.m_accounts.end())
             {
                 return it->second;
             }
@@ -854,7 +879,7 @@ namespace top
     
         xauto_ptr<xvaccountobj_t>   xvtable_t::get_account(const std::string & account_address)
         {
-            xauto_lock<xspinlock_t> locker(get_spin_lock());
+            xauto_lock<xspinlock_t> locker(get_shard(account_address).m_spin_lock);
             xvaccountobj_t * account_ptr = get_account_unsafe(account_address);
             account_ptr->add_ref(); //add reference to pair xauto_ptr
             
@@ -863,7 +888,7 @@ namespace top
         
         xvaccountobj_t*   xvtable_t::get_account_unsafe(const std::string & account_address)
         {
-            auto & exist_account_ptr = m_accounts[account_address];
+            auto & exist_account_ptr = get_shard(account_address).m_accounts[account_address];
             if(   (exist_account_ptr != NULL)
                && (exist_account_ptr->is_close() == false)
                && (exist_account_ptr->is_closing() == false)
@@ -889,12 +914,13 @@ namespace top
         {
             bool  do_close = false;
             xvaccountobj_t * target_account_ptr = NULL;
+            xaccount_shard_t & shard = get_shard(account_address);
             {
-                xauto_lock<xspinlock_t> locker(get_spin_lock());
+                xauto_lock<xspinlock_t> locker(shard.m_spin_lock);
                 
                 //find target account object ptr
-                auto it = m_accounts.find(account_address);
-                if(it != m_accounts.end())
+                auto it = shard.m_accounts.find(account_address);
+                if(it != shard.m_accounts.end())
                 {
                     target_account_ptr = it->second;
                     if(target_account_ptr != NULL)
@@ -908,7 +934,7 @@ namespace top
                             target_account_ptr->stop();//also push all plugin submit their data
                             
                             //step #2: remove from table ' slot,now ownership be transfered to target_account_ptr
-                            m_accounts.erase(it);
+                            shard.m_accounts.erase(it);
                             
                             //step #3: save all unsaved thing if have.but at most case it just return as no-change
                             target_account_ptr->save_meta(); //note:io related job
@@ -919,7 +945,7 @@ namespace top
                     }
                     else //account object reset to null
                     {
-                        m_accounts.erase(it);
+                        shard.m_accounts.erase(it);
                         xwarn("xvtable_t::try_close_account,find null account(%s)",account_address.c_str());
                         return true;
                     }
@@ -1021,9 +1047,10 @@ namespace top
                         {
                             //try do heave job first
                             {
-                                m_lock.lock();
+                                std::recursive_mutex & account_lock = get_lock(*_test_for_plugin->get_account_obj());
+                                account_lock.lock();
                                 _test_for_plugin->save_data();
-                                m_lock.unlock();
+                                account_lock.unlock();
                             }
                             //close_plugin may try hold lock and check is_live agian ,and if so may close
                             if(_test_for_plugin->get_account_obj()->try_close_plugin(current_time_ms,_test_for_plugin->get_plugin_type()))
@@ -112,10 +112,17 @@ namespace top
             return load_value_obj()->get_value();
         }
     
+        bool  xvproperty_t::is_shared_value() const
+        {
+            xvalueobj_t * exist_value = load_value_obj();
+            //readonly flag is never reset once shared,but the other holders(e.g. state of prev block) may already gone
+            return (exist_value->is_readonly() && (exist_value->get_refcount() > 1));
+        }
+    
         const xvalue_t&  xvproperty_t::get_writable_value()
         {
             xvalueobj_t * exist_value = load_value_obj();
-            if(exist_value->is_readonly() == false) //most path hit
+            if(is_shared_value() == false) //most path hit,include the one that no-longer shared by others
             {
                 return exist_value->get_value();
             }
@@ -124,6 +131,21 @@ namespace top
             set_value_obj(new_value_obj.get());
             return new_value_obj->get_value();
         }
+    
+        const xvalue_t&  xvproperty_t::get_overwritable_value()
+        {
+            xvalueobj_t * exist_value = load_value_obj();
+            if(is_shared_value() == false)
+            {
+                return exist_value->get_value();
+            }
+            
+            //whole value is going to be replaced,so not copy the shared one
+            xauto_ptr<xvalueobj_t> new_value_obj(new xvalueobj_t());
+            new_value_obj->set_name(exist_value->get_name());
+            set_value_obj(new_value_obj.get());
+            return new_value_obj->get_value();
+        }
 
         //update value,not safe for multiple_thrad
         bool   xvproperty_t::copy_from_value(const xvalue_t & new_val)
@@ -135,7 +157,7 @@ namespace top
                 return false;
             }
             
-            xvalue_t & writable_value = (xvalue_t&)get_writable_value();
+            xvalue_t & writable_value = (xvalue_t&)get_overwritable_value();
             writable_value = new_val;
             return true;
         }
@@ -149,7 +171,7 @@ namespace top
                 return false;
             }
             
-            xvalue_t & writable_value = (xvalue_t&)get_writable_value();
+            xvalue_t & writable_value = (xvalue_t&)get_overwritable_value();
             writable_value = std::move(new_val);
             return true;
         }
@@ -190,7 +212,7 @@ namespace top
                 return xvalue_t(enum_xerror_code_invalid_param_count);
             
             //construction a empty/zero value to replace it
-            xvalue_t & writable_value = (xvalue_t&)get_writable_value();
+            xvalue_t & writable_value = (xvalue_t&)get_overwritable_value();
             writable_value = get_empty_value();
 
             return xvalue_t(enum_xcode_successful);
@@ -216,7 +238,7 @@ namespace top
             }
             
             //replace by new value_t
-            xvalue_t & writable_value = (xvalue_t&)get_writable_value();
+            xvalue_t & writable_value = (xvalue_t&)get_overwritable_value();
             writable_value = new_value;
 
             return xvalue_t(enum_xcode_successful);
@@ -156,6 +156,14 @@ namespace top
                         }
                     }
                 }
+
+                // persist checkpoint met on the way,the target state is persisted by caller
+                if (_block.get() != latest_blocks.rbegin()->second.get() && is_checkpoint_state(target_account, _block.get())) {
+                    if (write_state_to_db(target_account, *current_state.get(), _block->get_block_hash())) {
+                        XMETRICS_GAUGE(metrics::statestore_unit_checkpoint_write, 1);
+                        xdbg("xvblkstatestore_t::rebuild_bstate,persist checkpoint state.block=%s",_block->dump().c_str());
+                    }
+                }
             }
             return current_state;
         }
@@ -172,6 +180,7 @@ namespace top
             target_block->add_ref();
             cur_block.attach(target_block);
             latest_blocks[cur_block->get_height()] = cur_block;  // push target block to latest blocks
+            // unitstate normally stops at a checkpoint within enum_unit_bstate_checkpoint_interval,but old accounts may have none yet
             uint32_t max_count = target_block->get_block_level() == enum_xvblock_level_table ? 4 : 0xFFFF; // TODO(jimmy) always read latest tablestate but may read old unitstate
             uint32_t count = 0;
             bool res = false;
@@ -272,10 +281,48 @@ namespace top
             return nullptr;
         }
 
+        bool xvblkstatestore_t::is_checkpoint_height(const uint64_t height) {
+            return height != 0 && (height % enum_unit_bstate_checkpoint_interval) == 0;
+        }
+
+        std::vector<uint64_t> xvblkstatestore_t::get_unit_state_clear_heights(const uint64_t executed_height) {
+            std::vector<uint64_t> heights;
+            if (executed_height < enum_max_bstate_newest_count)
+                return heights;
+
+            const uint64_t delete_height = executed_height - enum_max_bstate_newest_count;
+            if (!is_checkpoint_height(delete_height)) {
+                heights.push_back(delete_height);
+            } else if (delete_height > enum_unit_bstate_checkpoint_interval) {
+                // keep this checkpoint and drop the previous one,forked states at that height go as well
+                heights.push_back(delete_height - enum_unit_bstate_checkpoint_interval);
+            }
+            return heights;
+        }
+
+        bool xvblkstatestore_t::is_live_unit_checkpoint(const uint64_t height, const uint64_t committed_height) {
+            return is_checkpoint_height(height) && height <= committed_height && height + enum_unit_bstate_checkpoint_interval > committed_height;
+        }
+
+        bool xvblkstatestore_t::is_checkpoint_state(const xvaccount_t & target_account, const xvblock_t * for_block) const {
+            if (for_block->get_block_level() != enum_xvblock_level_unit || !is_checkpoint_height(for_block->get_height()))
+                return false;
+            if (!for_block->check_block_flag(enum_xvblock_flag_committed))
+                return false;  // forked or not yet committed
+            const uint64_t committed_height = xvchain_t::instance().get_xblockstore()->get_latest_committed_block_height(target_account);
+            return is_live_unit_checkpoint(for_block->get_height(), committed_height);
+        }
+
         // TODO(jimmy) how clear all old state
         void xvblkstatestore_t::clear_persisted_state(const xvaccount_t & target_account, xvblock_t * target_block) {
             // clear old normal state
-            if(target_block->get_height() >= enum_max_bstate_newest_count)
+            if (target_block->get_block_level() == base::enum_xvblock_level_unit)
+            {
+                // unit checkpoint state is kept until next checkpoint is out of newest states
+                for (auto delete_height : get_unit_state_clear_heights(target_block->get_height()))
+                    delete_states_of_db(target_account, delete_height);
+            }
+            else if(target_block->get_height() >= enum_max_bstate_newest_count)
             {
                 uint64_t delete_height = target_block->get_height() - enum_max_bstate_newest_count;
                 bool is_delete_full_table = target_block->get_block_level() == base::enum_xvblock_level_table && target_block->get_last_full_block_height() == delete_height;
@@ -470,6 +517,10 @@ namespace top
                 XMETRICS_GAUGE(metrics::statestore_get_table_state_with_table_count, latest_blocks.size());
             }
 
+            if (target_block->get_block_level() == base::enum_xvblock_level_unit) {
+                XMETRICS_GAUGE(metrics::statestore_unit_replay_depth, latest_blocks.size());
+            }
+
             target_bstate = rebuild_bstate(target_account, base_bstate, latest_blocks);
             if (target_bstate == nullptr) {
                 xwarn("xvblkstatestore_t::execute_target_block fail-rebuild_bstate.block=%s",target_block->dump().c_str());
@@ -36,6 +36,56 @@ namespace top
 
             return xobject_t::query_interface(_enum_xobject_type_);
         }
+    
+        class xvdbvalue_string_t : public xvdbvalue_t
+        {
+        public:
+            explicit xvdbvalue_string_t(const std::string & value) : m_value(value) {}
+            virtual const char*  data() const override {return m_value.data();}
+            virtual size_t       size() const override {return m_value.size();}
+        private:
+            const std::string    m_value;
+        };
+    
+        std::shared_ptr<xvdbvalue_t>  xvdbstore_t::get_value_pinned(const std::string & key) const
+        {
+            const std::string value = get_value(key);
+            if(value.empty())
+                return nullptr;
+            return std::make_shared<xvdbvalue_string_t>(value);
+        }
+    
+        bool  xvdbstore_t::get_values(const std::vector<std::string> & keys,std::vector<std::string> & values,std::vector<bool> & found_flags) const
+        {
+            values.clear();
+            values.resize(keys.size());
+            found_flags.assign(keys.size(),false);
+            for(size_t i = 0; i < keys.size(); ++i)
+            {
+                if(keys[i].empty() == false)
+                {
+                    values[i] = get_value(keys[i]);
+                    found_flags[i] = (values[i].empty() == false); //get_value can not tell empty value from missing one
+                }
+            }
+            return true;
+        }
+
+        bool  xvdbstore_t::set_values_async(const std::map<std::string,std::string> & values,const std::function<void(bool)> & callback)
+        {
+            bool result = true;
+            for(auto & it : values)
+            {
+                if(set_value(it.first,it.second) == false)
+                {
+                    result = false;
+                    break;
+                }
+            }
+            if(callback)
+                callback(result);
+            return result;
+        }
 
         //----------------------------------------xvtxstore_t----------------------------------------//
         xvtxstore_t::xvtxstore_t()
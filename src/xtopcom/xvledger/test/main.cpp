@@ -38,6 +38,7 @@ public:
 
 int test_xstate(bool is_stress_test);
 int test_block_builder(bool is_stress_test);
+int test_table_contention(bool is_stress_test);
 
 using namespace top;
 int main(int argc,char* argv[])
@@ -98,6 +99,9 @@ int main(int argc,char* argv[])
     if(test_block_builder(true) < 0)
         return -2;
     
+    if(test_table_contention(true) < 0)
+        return -3;
+    
     printf("finish all test successful \n");
     //const int total_time_to_wait = 20 * 1000; //20 second
     while(1)
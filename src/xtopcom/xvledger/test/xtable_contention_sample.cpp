@@ -0,0 +1,66 @@
+// Copyright (c) 2017-2018 Telos Foundation & contributors
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <thread>
+#include <chrono>
+#include <vector>
+#include "../xvaccount.h"
+#include "../xvledger.h"
+
+//simulate blockstore access pattern:every thread touch own accounts of the same table,hold account'lock and do a little job
+static int64_t run_table_contention(const std::vector<std::string> & accounts,const int threads_count,const int loop_count,bool use_account_lock)
+{
+    const auto start_time = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for(int t = 0; t < threads_count; ++t)
+    {
+        workers.push_back(std::thread([&accounts,t,threads_count,loop_count,use_account_lock](){
+            const size_t accounts_per_thread = accounts.size() / threads_count;
+            for(int i = 0; i < loop_count; ++i)
+            {
+                const top::base::xvaccount_t account(accounts[t * accounts_per_thread + (i % accounts_per_thread)]);
+                top::base::xvtable_t * target_table = top::base::xvchain_t::instance().get_table(account.get_xvid());
+                std::recursive_mutex & locker = use_account_lock ? target_table->get_lock(account) : target_table->get_lock();
+                std::lock_guard<std::recursive_mutex> guard(locker);
+                top::base::xauto_ptr<top::base::xvaccountobj_t> account_obj(target_table->get_account(account));
+                account_obj->get_block_meta();
+            }
+        }));
+    }
+    for(auto & it : workers)
+        it.join();
+
+    const int64_t duration_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start_time).count();
+    return (duration_ms > 0) ? duration_ms : 1;
+}
+
+int test_table_contention(bool is_stress_test)
+{
+    const int threads_count = 8;
+    const int accounts_count = 512;
+    const int loop_count = is_stress_test ? 200000 : 20000;
+
+    //all accounts belong to book#0/table#0 of consensus zone
+    std::vector<std::string> accounts;
+    for(int i = 0; i < accounts_count; ++i)
+    {
+        const std::string public_key = top::base::xstring_utl::tostring(1000000 + i) + "abcdef";
+        accounts.push_back(top::base::xvaccount_t::make_account_address(top::base::enum_vaccount_addr_type_secp256k1_user_account,top::base::enum_main_chain_id,top::base::enum_chain_zone_consensus_index,0,0,public_key));
+    }
+    xassert(top::base::xvchain_t::instance().get_table(top::base::xvaccount_t(accounts[0]).get_xvid()) == top::base::xvchain_t::instance().get_table(top::base::xvaccount_t(accounts[accounts_count - 1]).get_xvid()));
+
+    run_table_contention(accounts,threads_count,loop_count / 10,true); //warm up to create all account objects
+
+    const int64_t table_lock_ms   = run_table_contention(accounts,threads_count,loop_count,false);
+    const int64_t account_lock_ms = run_table_contention(accounts,threads_count,loop_count,true);
+    const int64_t total_ops = (int64_t)threads_count * loop_count;
+    printf("test_table_contention,threads=%d,ops=%lld,table-lock:%lld ms(%lld ops/s),account-lock:%lld ms(%lld ops/s)\n",
+           threads_count,(long long)total_ops,
+           (long long)table_lock_ms,(long long)(total_ops * 1000 / table_lock_ms),
+           (long long)account_lock_ms,(long long)(total_ops * 1000 / account_lock_ms));
+    return 0;
+}
@@ -0,0 +1,81 @@
+// Copyright (c) 2018-2020 Telos Foundation & contributors
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <unordered_map>
+#include "xvledger/xmerkle.hpp"
+
+namespace top
+{
+    namespace base
+    {
+        //sha2-256 merkle tree with all levels hold in one contiguous array of 32 bytes nodes
+        //root and path are exactly same as xmerkle_t<utl::xsha2_256_t, uint256_t>,include the odd node rule
+        //note: build() is not thread safe;once built,all const methods are read only and may be called at any thread
+        //root-only callers may skip leaf index,then find_leaf scans leafs instead of a lookup
+        class xmerkle_flat_t
+        {
+        public:
+            enum { enum_node_size = 32 };
+        public:
+            xmerkle_flat_t(){};
+            xmerkle_flat_t(const std::vector<std::string> & leafs, bool with_leaf_index = true);
+            ~xmerkle_flat_t(){};
+        private:
+            xmerkle_flat_t(const xmerkle_flat_t &);
+            xmerkle_flat_t & operator = (const xmerkle_flat_t &);
+
+        public:
+            bool                build(const std::vector<std::string> & leafs, bool with_leaf_index = true); //hash each leaf then build all levels
+            const std::string & get_root() const {return m_root;} //empty when no leaf
+            size_t              get_leafs_count() const {return m_leafs_count;}
+            //return index of first leaf with same data,or -1 when not found
+            int64_t             find_leaf(const std::string & leaf) const;
+            //path of leaf at index,root is not included
+            bool                calc_path(const size_t leaf_index, std::vector<xmerkle_path_node_t<uint256_t>> & hash_path) const;
+            bool                calc_path(const std::string & leaf, std::vector<xmerkle_path_node_t<uint256_t>> & hash_path) const;
+
+        private:
+            const uint8_t *     get_node(const size_t level, const size_t index) const {return m_nodes.data() + (m_level_offsets[level] + index) * enum_node_size;}
+
+        private:
+            size_t                      m_leafs_count{0};
+            std::vector<uint8_t>        m_nodes;          //level by level from leafs to root
+            std::vector<size_t>         m_level_offsets;  //first node of each level,level 0 is leafs
+            std::vector<size_t>         m_level_sizes;
+            std::string                 m_root;
+            bool                        m_has_leaf_index{false};
+            std::unordered_map<std::string, size_t> m_leaf_index; //leaf hash -> first index,built by build() if asked
+        };
+
+        //merkle tree of block input with leaf index of each tx,so receipt proof is a direct lookup instead of rebuild tree
+        class xinput_merkle_t
+        {
+        public:
+            //leaf_txhashs[i] is tx hash of leafs[i],empty for action without tx
+            xinput_merkle_t(const std::vector<std::string> & leafs, const std::vector<std::string> & leaf_txhashs);
+            ~xinput_merkle_t(){};
+        private:
+            xinput_merkle_t();
+            xinput_merkle_t(const xinput_merkle_t &);
+            xinput_merkle_t & operator = (const xinput_merkle_t &);
+
+        public:
+            const xmerkle_flat_t &  get_tree() const {return m_tree;}
+            const std::string &     get_root() const {return m_tree.get_root();}
+            //return leaf index of tx,or -1 when not found or tx has more than one leaf
+            int64_t                 find_tx_leaf(const std::string & txhash) const;
+
+        private:
+            xmerkle_flat_t                              m_tree;
+            std::unordered_map<std::string, int64_t>    m_txhash_leafs;
+        };
+        using xinput_merkle_ptr_t = std::shared_ptr<xinput_merkle_t>;
+
+    }//end of namespace of base
+}//end of namespace top
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <memory>
+#include <mutex>
 #include "xbase/xdata.h"
 #include "xbase/xmem.h"
 #include "xbase/xobject_ptr.h"
@@ -17,6 +19,7 @@ namespace top
     {
         class xvbindex_t;
         class xvbstate_t;
+        class xinput_merkle_t;
 
         /*  Very High Level structre/View
 
@@ -506,10 +509,17 @@ namespace top
             size_t                      get_action_count() const;
             virtual std::string         dump() const override;
 
+            //merkle tree and tx leaf index of input,set by xvblockmaker_t when first build it. note:thread-safe
+            std::shared_ptr<xinput_merkle_t>    get_merkle() const;
+            void                                set_merkle(const std::shared_ptr<xinput_merkle_t> & merkle);
+
         protected: //proposal ==> input ==> output
             //just carry by object at memory,not included by serialized
             std::string  m_proposal;    //raw proposal
             std::string  m_root_hash;   //root of merkle tree constructed by input
+        private:
+            mutable std::mutex                  m_merkle_lock;
+            std::shared_ptr<xinput_merkle_t>    m_merkle;   //rebuild from entitys when load from db,so not serialized
         };
 
         //once xvoutput_t constructed,it not allow modify then
@@ -602,6 +612,7 @@ namespace top
 
         public: //create object from serialized data
             static xvblock_t*          create_block_object(const std::string  & vblock_serialized_data);
+            static xvblock_t*          create_block_object(const char* vblock_serialized_data,const size_t data_size);//deserialize directly from raw memory(e.g. pinned by DB)
             static xvheader_t*         create_header_object(const std::string & vheader_serialized_data);
             static xvqcert_t*          create_qcert_object(const std::string  & vqcert_serialized_data);
             static xvinput_t*          create_input_object(const std::string  & vinput_serialized_data);
@@ -58,6 +58,10 @@ namespace top
             virtual enum_vcert_auth_result   verify_sign(const xvip2_t & signer,const xvqcert_t * test_for_cert,const std::string & block_account)  = 0;
             virtual enum_vcert_auth_result   verify_sign(const xvip2_t & signer,const xvblock_t * test_for_block) = 0;
             
+            //verify many single-signatures(e.g. votes of one proposal) at one call,results[i] is for signers[i] & certs[i]
+            //default implementation just call verify_sign one by one,subclass may verify them together at lower cost
+            virtual void                     verify_sign_batch(const std::vector<xvip2_t> & signers,const std::vector<xvqcert_t*> & certs,const std::string & block_account,std::vector<enum_vcert_auth_result> & results);
+            
         public:
             //merge multiple single-signature into threshold signature,and return a merged signature
             virtual const std::string   merge_muti_sign(const std::vector<xvip2_t> & muti_nodes,const std::vector<std::string> & muti_signatures,const xvqcert_t * for_cert) = 0;
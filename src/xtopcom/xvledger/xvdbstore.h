@@ -6,6 +6,9 @@
 
 #include <string>
 #include <vector>
+#include <map>
+#include <memory>
+#include <functional>
 #include "xbase/xdata.h"
 #include "xvblock.h"
 
@@ -13,6 +16,16 @@ namespace top
 {
     namespace base
     {
+        //readonly view of value that pinned by DB,memory is valid until released
+        class xvdbvalue_t
+        {
+        public:
+            virtual ~xvdbvalue_t(){}
+            virtual const char*  data() const = 0;
+            virtual size_t       size() const = 0;
+            bool                 empty() const {return (size() == 0);}
+        };
+    
         class xvdbstore_t : public xobject_t
         {
             friend class xvchain_t;
@@ -35,7 +48,14 @@ namespace top
 
         public://key-value manage
             virtual const std::string get_value(const std::string & key) const = 0;
+            //zero-copy version of get_value,return nullptr if not found;default implementation copy from get_value
+            virtual std::shared_ptr<xvdbvalue_t> get_value_pinned(const std::string & key) const;
+            //batch version of get_value,found_flags[i] is false if keys[i] is empty or not found;default implementation read one by one
+            virtual bool              get_values(const std::vector<std::string> & keys,std::vector<std::string> & values,std::vector<bool> & found_flags) const;
             virtual bool              set_value(const std::string & key, const std::string& value) = 0;
+            //write values by one batch and return without waiting for commit if DB queue writes(values are readable at once)
+            //callback(optional) is called with the result once committed;return false if failed at once.default implementation is sync
+            virtual bool              set_values_async(const std::map<std::string,std::string> & values,const std::function<void(bool)> & callback);
             virtual bool              delete_value(const std::string & key) = 0;
             //batch deleted keys
             virtual bool              delete_values(std::vector<std::string> & to_deleted_keys) = 0;
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <mutex>
+#include <unordered_map>
 #include "xvaccount.h"
 #include "xvactplugin.h"
 #include "xvdbstore.h"
@@ -56,6 +57,8 @@ namespace top
             enum_plugin_idle_timeout_ms     = 60000,  //idle duration for plugin
             
             enum_account_save_meta_interval = 64, //force save meta every 64 modification
+            
+            enum_vtable_account_shards      = 64,  //accounts of one table spread into shards to reduce lock contention,must be 2^N
         };
     
         class xvaccountobj_t : public xiobject_t,public xvaccount_t
@@ -98,7 +101,7 @@ namespace top
             bool                    save_meta(bool carry_process_id = true);
             bool                    update_block_meta(xvactplugin_t * plugin);
         protected:
-            std::recursive_mutex&   get_table_lock();
+            std::recursive_mutex&   get_table_lock(); //lock shared with accounts at same shard of table
             xspinlock_t&            get_spin_lock()  {return m_spin_lock;}
             xvactmeta_t*            get_meta();
             bool                    recover_meta(xvactmeta_t & _meta);//check whether recover the lost as reboot
@@ -162,10 +165,21 @@ namespace top
             inline const uint64_t      get_table_index() const {return m_table_index;}
             inline const uint32_t      get_table_combine_addr() const {return m_table_combine_addr;}
             
-            inline std::recursive_mutex&  get_lock() {return m_lock;}
+            inline std::recursive_mutex&  get_lock() {return m_lock;} //table-wide lock
+            //lock to serialize operations of this account,table account use table-wide lock,unit accounts use lock of its shard
+            //note:caller may acquire lock of unit account while holding table account' lock,but never reverse order
+            std::recursive_mutex&         get_lock(const xvaccount_t & account_obj);
             inline xvbook_t &             get_book() {return m_ref_book;}
             
         private:
+            struct xaccount_shard_t
+            {
+                xspinlock_t                                       m_spin_lock; //protect m_accounts only
+                std::recursive_mutex                              m_mutex;     //serialize operations of accounts at this shard
+                std::unordered_map<std::string,xvaccountobj_t*>   m_accounts;
+            };
+            xaccount_shard_t&          get_shard(const std::string & account_address);
+            
             xvaccountobj_t*            create_account_unsafe(const std::string & account_address);
             xvaccountobj_t*            get_account_unsafe(const std::string & account_address);
             xvaccountobj_t*            find_account_unsafe(const std::string & account_address);
@@ -183,18 +197,14 @@ namespace top
             //param of force_clean indicate whether force to close valid account 
             virtual bool               clean_all(bool force_clean = false);//clean all accounts & but table self still ok to use
             virtual bool               on_process_close();//send process_close event to every objects
-        private:
-            xspinlock_t&               get_spin_lock()  {return m_spin_lock;}
-            
         private:
             std::recursive_mutex   m_lock;
-            xspinlock_t            m_spin_lock;
             xvbook_t&              m_ref_book; //link to book
             uint64_t               m_table_index;         //define uint64_t just for performance
             uint32_t               m_table_combine_addr; //[ledgerid:16bit][book:7bit][table:3bit]
             uint32_t               m_reserved_4byte;
             
-            std::map<std::string,xvaccountobj_t*>   m_accounts;
+            xaccount_shard_t                        m_account_shards[enum_vtable_account_shards];
             std::multimap<uint64_t,xvactplugin_t*>  m_monitor_plugins;//key:expired_time(UTC ms), value: xvactplugin_t*,sort from lower
             std::multimap<uint64_t,xvaccountobj_t*> m_monitor_accounts;//key:expired_time(UTC ms), value: xvaccountobj_t*,sort from lower
         };
@@ -49,7 +49,9 @@ namespace top
             
         protected: //internal help function without any instruction involved
             const xvalue_t&     get_value() const; //readonly access
-            const xvalue_t&     get_writable_value();//writeable access
+            const xvalue_t&     get_writable_value();//writeable access,copy value first if it is shared with other property
+            const xvalue_t&     get_overwritable_value();//writeable access for replacing whole value,never copy the shared one
+            bool                is_shared_value() const; //value object is shared with clone of property(e.g. state of prev block)
             
             //update value,not safe for multiple_thread
             bool                copy_from_value(const xvalue_t & new_val);
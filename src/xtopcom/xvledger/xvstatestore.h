@@ -5,6 +5,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 #include "xvblock.h"
 #include "xvstate.h"
 #include "xvaccount.h"
@@ -17,13 +18,22 @@ namespace top
         //chain managed account'state by individual unit block,return block-state(xvbstate_t)
         class xvblkstatestore_t
         {
+        public:
             enum
             {
                 enum_max_bstate_newest_count            = 5,  //max persisted store bstate count per account
                 enum_max_bstate_fulltable_count         = 3,  //max persisted store bstate for fulltable snapshot sync
                 enum_max_table_bstate_lru_cache_max     = 256, //max table state lru cache count
                 enum_max_unit_bstate_lru_cache_max      = 1024, //max unit state lru cache count
+                enum_unit_bstate_checkpoint_interval    = 128, //unit bstate at every N heights is kept in db,so replay at most N blocks to rebuild
             };
+        public://retention of unit states at db,by height only
+            static bool                  is_checkpoint_height(const uint64_t height);
+            //heights whose unit states are deleted once state at executed_height is persisted:the one out of newest states,
+            //or the checkpoint superseded by it when itself is a checkpoint
+            static std::vector<uint64_t> get_unit_state_clear_heights(const uint64_t executed_height);
+            //only the newest checkpoint not above committed height is written while replay,older ones would never be cleared
+            static bool                  is_live_unit_checkpoint(const uint64_t height, const uint64_t committed_height);
         protected:
             xvblkstatestore_t();
             virtual ~xvblkstatestore_t(){};
@@ -59,6 +69,7 @@ namespace top
             xobject_ptr_t<xvbstate_t> rebuild_bstate(const xvaccount_t & target_account, const xobject_ptr_t<xvbstate_t> & base_state, const std::map<uint64_t, xobject_ptr_t<xvblock_t>> & latest_blocks);
             xobject_ptr_t<xvbstate_t> make_state_from_current_block(const xvaccount_t & target_account, xvblock_t * current_block);
             void                      clear_persisted_state(const xvaccount_t & target_account, xvblock_t * target_block);
+            bool                      is_checkpoint_state(const xvaccount_t & target_account, const xvblock_t * for_block) const;
             xauto_ptr<xvbstate_t>     execute_target_block(const xvaccount_t & target_account, xvblock_t * target_block);
 
             xobject_ptr_t<xvbstate_t> get_lru_cache(base::enum_xvblock_level blocklevel, const std::string & hash);
@@ -42,6 +42,8 @@ namespace top
  
         public://read & load interface
             virtual xauto_ptr<xvtxindex_t>  load_tx_idx(const std::string & raw_tx_hash,enum_transaction_subtype type) = 0;
+            //batch load by one DB round-trip,result is aligned with tx_keys and nullptr for not found
+            virtual std::vector<xvtxindex_ptr> load_tx_idxs(const std::vector<xvtxkey_t> & tx_keys) = 0;
             virtual const std::string       load_tx_bin(const std::string & raw_tx_hash) = 0 ;
             virtual xauto_ptr<xdataunit_t>  load_tx_obj(const std::string & raw_tx_hash) = 0;
 
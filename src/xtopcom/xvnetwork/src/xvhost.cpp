@@ -53,6 +53,14 @@ static common::xip2_t convert_to_p2p_xip2(common::xnode_address_t const & addres
             address.election_round().value()}; // p2p layer use election_round as block height.
 }
 
+// consensus messages are handled by the priority worker of receiver,so they never queue behind bulk traffic like sync
+static uint16_t message_priority(common::xmessage_id_t const message_id) {
+    if (common::get_message_category(message_id) == xmessage_category_consensus) {
+        return enum_xpacket_priority_type_critical;
+    }
+    return enum_xpacket_priority_type_routine;
+}
+
 static void msg_metrics(xvnetwork_message_t const & message, metrics::E_SIMPLE_METRICS_TAG tag_start) {
     auto const message_category = common::get_message_category(message.message_id());
     auto delta = (uint16_t)message_category - (uint16_t)xmessage_category_consensus;
@@ -73,6 +81,16 @@ xtop_vhost::xtop_vhost(observer_ptr<elect::xnetwork_driver_face_t> const & netwo
         // mock the m_filter_manager if you do not use the default para.
         m_filter_manager = std::move(message_filter_manager_ptr);
     }
+
+    auto const lanes_count = std::max<std::size_t>(1, XGET_CONFIG(vhost_dispatch_lanes_count));
+    m_lanes.reserve(lanes_count);
+    for (std::size_t i = 0; i < lanes_count; ++i) {
+        auto lane = top::make_unique<xdispatch_lane_t>();
+        lane->queue_metrics_name = "vhost_lane_" + std::to_string(i) + "_queue";
+        lane->handled_metrics_name = "vhost_lane_" + std::to_string(i) + "_handled";
+        lane->drop_metrics_name = "vhost_lane_" + std::to_string(i) + "_drop";
+        m_lanes.push_back(std::move(lane));
+    }
 }
 
 common::xnode_id_t const & xtop_vhost::host_node_id() const noexcept {
@@ -88,21 +106,21 @@ void xtop_vhost::start() {
     running(true);
     assert(running());
 
-    threading::xbackend_thread::spawn([this, self = shared_from_this()] {
-#if defined DEBUG
-        m_vhost_thread_id = std::this_thread::get_id();
-#endif
-        do_handle_network_data();
-    });
+    for (std::size_t i = 0; i < m_lanes.size(); ++i) {
+        threading::xbackend_thread::spawn([this, self = shared_from_this(), i] { do_handle_network_data(i); });
+    }
 }
 
 void xtop_vhost::stop() {
-    m_message_queue.push(xbyte_buffer_t{});
-
     assert(running());
     running(false);
     assert(!running());
 
+    // wake up all lanes so they see the stopped state
+    for (auto & lane : m_lanes) {
+        lane->message_queue.push(nullptr);
+    }
+
     assert(m_network_driver);
 
     m_network_driver->unregister_message_ready_notify();
@@ -176,9 +194,9 @@ void xtop_vhost::send(xmessage_t const & message,
                 src.cluster_id() == common::xdefault_cluster_id && src.group_id() == common::xdefault_group_id &&
                 (message_type == sync::xmessage_id_sync_frozen_gossip || message_type == sync::xmessage_id_sync_get_blocks || message_type == sync::xmessage_id_sync_blocks ||
                  message_type == sync::xmessage_id_sync_frozen_broadcast_chain_state || message_type == sync::xmessage_id_sync_frozen_response_chain_state)) {
-                m_network_driver->send_to_through_root(convert_to_p2p_xip2(src), dst.node_id(), bytes_message, ec);
+                m_network_driver->send_to_through_root(convert_to_p2p_xip2(src), dst.node_id(), bytes_message, message_priority(message.id()), ec);
             } else {
-                m_network_driver->send_to(convert_to_p2p_xip2(src), convert_to_p2p_xip2(dst), bytes_message,ec);
+                m_network_driver->send_to(convert_to_p2p_xip2(src), convert_to_p2p_xip2(dst), bytes_message, message_priority(message.id()), ec);
             }
             msg_metrics(vnetwork_message, metrics::message_send_category_begin);
 
@@ -453,9 +471,9 @@ void xtop_vhost::send_to(common::xnode_address_t const & src, common::xnode_addr
         src.cluster_id() == common::xdefault_cluster_id && src.group_id() == common::xdefault_group_id &&
         (message_type == sync::xmessage_id_sync_frozen_gossip || message_type == sync::xmessage_id_sync_get_blocks || message_type == sync::xmessage_id_sync_blocks ||
          message_type == sync::xmessage_id_sync_frozen_broadcast_chain_state || message_type == sync::xmessage_id_sync_frozen_response_chain_state)) {
-        m_network_driver->send_to_through_root(convert_to_p2p_xip2(src), dst.node_id(), bytes, ec);
+        m_network_driver->send_to_through_root(convert_to_p2p_xip2(src), dst.node_id(), bytes, message_priority(message.id()), ec);
     } else {
-        m_network_driver->send_to(convert_to_p2p_xip2(src), convert_to_p2p_xip2(dst), bytes, ec);
+        m_network_driver->send_to(convert_to_p2p_xip2(src), convert_to_p2p_xip2(dst), bytes, message_priority(message.id()), ec);
     }
     
     msg_metrics(vmsg, metrics::message_send_category_begin);
@@ -505,10 +523,10 @@ void xtop_vhost::broadcast(common::xnode_address_t const & src, common::xnode_ad
             src.cluster_id() == common::xdefault_cluster_id && src.group_id() == common::xdefault_group_id &&
             (message_type == sync::xmessage_id_sync_frozen_gossip || message_type == sync::xmessage_id_sync_get_blocks || message_type == sync::xmessage_id_sync_blocks ||
                 message_type == sync::xmessage_id_sync_frozen_broadcast_chain_state || message_type == sync::xmessage_id_sync_frozen_response_chain_state)) {
-            m_network_driver->send_to_through_root(convert_to_p2p_xip2(src), dst.node_id(), bytes, ec);
+            m_network_driver->send_to_through_root(convert_to_p2p_xip2(src), dst.node_id(), bytes, message_priority(message.id()), ec);
             msg_metrics(vmsg, metrics::message_send_category_begin);
         } else {
-            m_network_driver->spread_rumor(convert_to_p2p_xip2(src), convert_to_p2p_xip2(dst), bytes, ec);
+            m_network_driver->spread_rumor(convert_to_p2p_xip2(src), convert_to_p2p_xip2(dst), bytes, message_priority(message.id()), ec);
             msg_metrics(vmsg, metrics::message_rumor_category_begin);
         }
         // m_network_driver->spread_rumor(bytes);
@@ -611,7 +629,7 @@ void xtop_vhost::broadcast(common::xnode_address_t const & src, common::xnode_ad
         on_network_data_ready(host_node_id(), bytes_message);
 
         // m_network_driver->spread_rumor(bytes_message);
-        m_network_driver->spread_rumor(convert_to_p2p_xip2(src), convert_to_p2p_xip2(n_dst), bytes_message, ec);
+        m_network_driver->spread_rumor(convert_to_p2p_xip2(src), convert_to_p2p_xip2(n_dst), bytes_message, message_priority(message.id()), ec);
         msg_metrics(vmsg, metrics::message_rumor_category_begin);
     } else {
         ec = xvnetwork_errc2_t::not_supported, xwarn("%s %s", ec.category().name(), ec.message().c_str());
@@ -631,7 +649,21 @@ void xtop_vhost::on_network_data_ready(common::xnode_id_t const &, xbyte_buffer_
 #if VHOST_METRICS
         XMETRICS_COUNTER_INCREMENT("vhost_total_size_of_all_messages", bytes.size());
 #endif
-        m_message_queue.push(bytes);
+        if (bytes.empty()) {
+            xwarn("[vnetwork] message byte empty!");
+            return;
+        }
+
+        // decoded, filtered and matched at caller thread(transport workers run in parallel),lanes only run callbacks
+        // todo check decode return value.
+        auto vnetwork_message = std::make_shared<xvnetwork_message_t>(top::codec::msgpack_decode<xvnetwork_message_t>(bytes));
+        auto callbacks = match_callbacks(*vnetwork_message);
+        if (callbacks.empty()) {
+            return;
+        }
+        dispatch_to_lanes(vnetwork_message, std::move(callbacks));
+    } catch (top::error::xtop_error_t const & eh) {
+        xwarn("[vnetwork] xtop_error_t caught. category %s; error code %d; eh msg: %s", eh.code().category().name(), eh.code().value(), eh.what());
     } catch (std::exception const & eh) {
         xwarn("[vnetwork] std::exception exception caught: %s", eh.what());
     } catch (...) {
@@ -639,56 +671,116 @@ void xtop_vhost::on_network_data_ready(common::xnode_id_t const &, xbyte_buffer_
     }
 }
 
+std::size_t xtop_vhost::select_lane(common::xnode_address_t const & callback_address) const {
+    if (m_lanes.size() == 1) {
+        return 0;
+    }
+
+    // by the registered vnode address,so every message delivered to one vnode,unicast or broadcast,is handled on the same lane in arrival order
+    return static_cast<std::size_t>(callback_address.group_address().hash() % m_lanes.size());
+}
+
+void xtop_vhost::dispatch_to_lanes(std::shared_ptr<xvnetwork_message_t const> const & vnetwork_message,
+                                   std::vector<std::pair<common::xnode_address_t const, xmessage_ready_callback_t>> callbacks) {
+    // a broadcast matching several vnodes here is queued once on each of their lanes
+    std::vector<std::unique_ptr<xlane_message_t>> lane_messages(m_lanes.size());
+    for (auto & callback_info : callbacks) {
+        auto & lane_message = lane_messages[select_lane(top::get<common::xnode_address_t const>(callback_info))];
+        if (lane_message == nullptr) {
+            lane_message = top::make_unique<xlane_message_t>();
+            lane_message->vnetwork_message = vnetwork_message;
+        }
+        lane_message->callbacks.push_back(std::move(callback_info));
+    }
+
+    for (std::size_t i = 0; i < lane_messages.size(); ++i) {
+        if (lane_messages[i] == nullptr) {
+            continue;
+        }
+
+        auto & lane = *m_lanes[i];
+        if (lane.message_queue.unsafe_size() >= max_message_queue_size) {
+            XMETRICS_COUNTER_INCREMENT(lane.drop_metrics_name, 1);
+            xwarn("[vnetwork] vhost lane full, drop message id %" PRIx32, static_cast<std::uint32_t>(vnetwork_message->message_id()));
+            continue;
+        }
+        lane.message_queue.push(std::move(lane_messages[i]));
+    }
+}
+
 /*
  * this is the callback function ,which is called by the lower module,
  * refactor by @Charles.Liu 2020.05.08
  */
-void xtop_vhost::do_handle_network_data() {
-    assert(m_vhost_thread_id == std::this_thread::get_id());
-
+void xtop_vhost::do_handle_network_data(std::size_t const lane_index) {
 #if defined DEBUG
     xscope_executer_t do_handle_network_data_exit_verifier{[this, self = shared_from_this()] { assert(!running()); }};
 #endif
+    auto & lane = *m_lanes[lane_index];
     while (running()) {
         try {
-            auto all_byte_messages = m_message_queue.wait_and_pop_all();
+            auto all_messages = lane.message_queue.wait_and_pop_all();
 
-            XMETRICS_FLOW_COUNT("vhost_handle_data_ready_called", all_byte_messages.size());
+            // lane depth right before this pop
+            XMETRICS_COUNTER_SET(lane.queue_metrics_name, all_messages.size());
+            XMETRICS_FLOW_COUNT("vhost_handle_data_ready_called", all_messages.size());
+            XMETRICS_COUNTER_INCREMENT(lane.handled_metrics_name, all_messages.size());
 
             XMETRICS_TIME_RECORD("vhost_handle_data_ready_called_time");
 
 #if defined(XENABLE_VHOST_BENCHMARK)
             auto xxbegin = std::chrono::high_resolution_clock::now();
 #endif
-            for (auto & bytes : all_byte_messages) {
+            for (auto & lane_message : all_messages) {
                 if (!running()) {
                     xwarn("[vnetwork] vhost is not running!");
                     break;
                 }
 
+                if (lane_message == nullptr) {
+                    // this may be a stop notification message.
+                    // anyway, for an empty message, just ignore it.
+                    xwarn("[vnetwork] message empty!");
+                    continue;
+                }
+
                 try {
-                    if (bytes.empty()) {
-                        // this may be a stop notification message.
-                        // anyway, for an empty message, just ignore it.
-                        xwarn("[vnetwork] message byte empty!");
-                        continue;
-                    }
-
-                    // todo check decode return value.
-                    auto vnetwork_message = top::codec::msgpack_decode<xvnetwork_message_t>(bytes);
-                    XMETRICS_GAUGE(metrics::vhost_recv_msg, 1);
-                    auto const & message = vnetwork_message.message();
-                    auto const & receiver = vnetwork_message.receiver();
-                    auto const & sender = vnetwork_message.sender();
-                    auto const msg_time = vnetwork_message.logic_time();
-
-                    xdbg("[vnetwork] message hash: %" PRIx64 " , before filter:s&r sender is %s , receiver is %s",
-                         vnetwork_message.hash(),
-                         sender.to_string().c_str(),
-                         receiver.to_string().c_str());
-
-                    auto const message_category = common::get_message_category(vnetwork_message.message_id());
-                    switch (message_category) {
+                    handle_lane_message(*lane_message);
+                } catch (top::error::xtop_error_t const & eh) {
+                    xwarn("[vnetwork] catches top error. category %s; error code %d; eh msg: %s; ec msg: %s", eh.code().category().name(), eh.code().value(), eh.what(), eh.code().message().c_str());
+                } catch (std::exception const & eh) {
+                    xwarn("[vnetwork] catches std::exception: %s", eh.what());
+                } catch (...) {
+                    xwarn("[vnetwork] catches an unknown exception");
+                }
+            }
+
+#if defined(XENABLE_VHOST_BENCHMARK)
+            auto xxend = std::chrono::high_resolution_clock::now();
+            auto ms = static_cast<std::size_t>(std::chrono::duration_cast<std::chrono::milliseconds>(xxend - xxbegin).count());
+            xwarn("vhost lane %zu processed in %zu milliseconds against %zu packs => tps = %lf", lane_index, ms, all_messages.size(), static_cast<double>(all_messages.size()) * 1000 / ms);
+#endif
+        } catch (std::exception const & eh) {
+            xwarn("[vnetwork] catches std::exception: %s", eh.what());
+        } catch (...) {
+            xwarn("[vnetwork] catches an unknown exception");
+        }
+    }
+}
+
+std::vector<std::pair<common::xnode_address_t const, xmessage_ready_callback_t>> xtop_vhost::match_callbacks(xvnetwork_message_t & vnetwork_message) {
+    XMETRICS_GAUGE(metrics::vhost_recv_msg, 1);
+    auto const & message = vnetwork_message.message();
+    auto const & receiver = vnetwork_message.receiver();
+    auto const & sender = vnetwork_message.sender();
+
+    xdbg("[vnetwork] message hash: %" PRIx64 " , before filter:s&r sender is %s , receiver is %s",
+         vnetwork_message.hash(),
+         sender.to_string().c_str(),
+         receiver.to_string().c_str());
+
+    auto const message_category = common::get_message_category(vnetwork_message.message_id());
+    switch (message_category) {
 #if defined(__clang__)
 #    pragma clang diagnostic push
 #    pragma clang diagnostic ignored "-Wswitch"
@@ -698,39 +790,39 @@ void xtop_vhost::do_handle_network_data() {
 #elif defined(_MSC_VER)
 #    pragma warning(push, 0)
 #endif
-                    case xmessage_category_consensus:
-                    {
-                        XMETRICS_GAUGE(metrics::message_category_consensus_contains_duplicate, 1);
-                        break;
-                    }
-                    case xmessage_category_timer:
-                    {
-                        XMETRICS_GAUGE(metrics::message_category_timer_contains_duplicate, 1);
-                        break;
-                    }
-                    case xmessage_category_txpool:
-                    {
-                        XMETRICS_GAUGE(metrics::message_category_txpool_contains_duplicate, 1);
-                        break;
-                    }
-
-                    case xmessage_category_rpc:
-                    {
-                        XMETRICS_GAUGE(metrics::message_category_rpc_contains_duplicate, 1);
-                        break;
-                    }
-
-                    case xmessage_category_sync:
-                    {
-                        XMETRICS_GAUGE(metrics::message_category_sync_contains_duplicate, 1);
-                        break;
-                    }
-
-                    case xmessage_block_broadcast:
-                    {
-                        XMETRICS_GAUGE(metrics::message_block_broadcast_contains_duplicate, 1);
-                        break;
-                    }
+    case xmessage_category_consensus:
+    {
+        XMETRICS_GAUGE(metrics::message_category_consensus_contains_duplicate, 1);
+        break;
+    }
+    case xmessage_category_timer:
+    {
+        XMETRICS_GAUGE(metrics::message_category_timer_contains_duplicate, 1);
+        break;
+    }
+    case xmessage_category_txpool:
+    {
+        XMETRICS_GAUGE(metrics::message_category_txpool_contains_duplicate, 1);
+        break;
+    }
+
+    case xmessage_category_rpc:
+    {
+        XMETRICS_GAUGE(metrics::message_category_rpc_contains_duplicate, 1);
+        break;
+    }
+
+    case xmessage_category_sync:
+    {
+        XMETRICS_GAUGE(metrics::message_category_sync_contains_duplicate, 1);
+        break;
+    }
+
+    case xmessage_block_broadcast:
+    {
+        XMETRICS_GAUGE(metrics::message_block_broadcast_contains_duplicate, 1);
+        break;
+    }
 #if defined(__clang__)
 #    pragma clang diagnostic pop
 #elif defined(__GNUC__)
@@ -738,106 +830,92 @@ void xtop_vhost::do_handle_network_data() {
 #elif defined(_MSC_VER)
 #    pragma warning(pop)
 #endif
-                    default:
-                    {
-                        assert(false);
-                        XMETRICS_GAUGE(metrics::message_category_unknown_contains_duplicate, 1);
-                        break;
-                    }
-                    }
-                    #if VHOST_METRICS
-                    XMETRICS_COUNTER_INCREMENT("vhost_" + std::to_string(static_cast<std::uint16_t>(common::get_message_category(vnetwork_message.message().id()))) +
-                                                   "_in_vhost_size" + std::to_string(static_cast<std::uint32_t>(vnetwork_message.message().id())),
-                                               bytes.size());
-                    #endif
-                    std::error_code ec;
-                    m_filter_manager->filter_message(vnetwork_message, ec);
-                    if (ec) {
-                        xinfo("[vnetwork] message filter: message id %" PRIx32 " hash %" PRIx64 " filted out",
-                              static_cast<uint32_t>(message.id()),
-                              static_cast<uint64_t>(message.hash()));
-                        continue;
-                    }
-
-                    xinfo("[vnetwork] message hash: %" PRIx64 " , after  filter:s&r sender is %s , receiver is %s",
-                          vnetwork_message.hash(),
-                          sender.to_string().c_str(),
-                          receiver.to_string().c_str());
-
-                    std::vector<std::pair<common::xnode_address_t const, xmessage_ready_callback_t>> callbacks;
-                    XLOCK_GUARD(m_callbacks_mutex) {
-                        for (auto const & callback_info : m_callbacks) {
-                            auto const & callback_addr = top::get<common::xnode_address_t const>(callback_info);
-                            xdbg("[vnetwork] see callback address: %s", callback_addr.to_string().c_str());
-
-                            auto contains = callback_addr.contains(receiver);
-                            if (!contains) {
-                                contains = receiver.contains(callback_addr);
-                            }
-
-                            if (!contains) {
-                                #if VHOST_METRICS
-                                XMETRICS_COUNTER_INCREMENT("vhost_discard_addr_not_match", 1);
-                                #endif
-                                xdbg("[vnetwork] callback at address %s not matched", callback_addr.to_string().c_str());
-                                continue;
-                            }
-                            callbacks.push_back(callback_info);
-                        }
-                    }
-
-                    if (callbacks.empty()) {
-                        xinfo("[vnetwork] no callback found for message hash: %" PRIx64 " , sender is %s , receiver is %s",
-                              vnetwork_message.hash(),
-                              sender.to_string().c_str(),
-                              receiver.to_string().c_str());
-                        continue;
-                    }
-
-                    for (auto & callback_info : callbacks) {
-                        auto const & callback = top::get<xmessage_ready_callback_t>(callback_info);
-                        if (callback) {
-                            try {
-                                // callback(sender, receiver, message);
-                                xdbg("[vnetwork] send msg %" PRIx32 " (hash %" PRIx64 ") to callback %p at address %s",
-                                     static_cast<std::uint32_t>(message.id()),
-                                     message.hash(),
-                                     &callback,
-                                     top::get<common::xnode_address_t const>(callback_info).to_string().c_str());
-#ifdef ENABLE_METRICS
-                                char msg_info[30] = {0};
-                                snprintf(msg_info, 29, "%x|%" PRIx64, vnetwork_message.message().id(), message.hash());
-                                XMETRICS_TIME_RECORD_KEY_WITH_TIMEOUT("vhost_handle_data_callback", msg_info, uint32_t(100000));
-#endif
-                                XMETRICS_GAUGE(metrics::vhost_recv_callback, 1);
-                                callback(sender, message, msg_time);
-                            } catch (std::exception const & eh) {
-                                xerror("[vnetwork] exception caught from callback: %s", eh.what());
-                            }
-                        } else {
-                            xerror("[vnetwork] callback not registered");
-                        }
-                    }
-                } catch (top::error::xtop_error_t const & eh) {
-                    xwarn("[vnetwork] catches top error. category %s; error code %d; eh msg: %s; ec msg: %s", eh.code().category().name(), eh.code().value(), eh.what(), eh.code().message().c_str());
-                } catch (std::exception const & eh) {
-                    xwarn("[vnetwork] catches std::exception: %s", eh.what());
-                } catch (...) {
-                    xwarn("[vnetwork] catches an unknown exception");
-                }
+    default:
+    {
+        assert(false);
+        XMETRICS_GAUGE(metrics::message_category_unknown_contains_duplicate, 1);
+        break;
+    }
+    }
+    #if VHOST_METRICS
+    XMETRICS_COUNTER_INCREMENT("vhost_" + std::to_string(static_cast<std::uint16_t>(common::get_message_category(vnetwork_message.message().id()))) +
+                                   "_in_vhost_size" + std::to_string(static_cast<std::uint32_t>(vnetwork_message.message().id())),
+                               vnetwork_message.message_payload().size());
+    #endif
+    std::error_code ec;
+    m_filter_manager->filter_message(vnetwork_message, ec);
+    if (ec) {
+        xinfo("[vnetwork] message filter: message id %" PRIx32 " hash %" PRIx64 " filted out",
+              static_cast<uint32_t>(message.id()),
+              static_cast<uint64_t>(message.hash()));
+        return {};
+    }
+
+    xinfo("[vnetwork] message hash: %" PRIx64 " , after  filter:s&r sender is %s , receiver is %s",
+          vnetwork_message.hash(),
+          sender.to_string().c_str(),
+          receiver.to_string().c_str());
+
+    std::vector<std::pair<common::xnode_address_t const, xmessage_ready_callback_t>> callbacks;
+    XLOCK_GUARD(m_callbacks_mutex) {
+        for (auto const & callback_info : m_callbacks) {
+            auto const & callback_addr = top::get<common::xnode_address_t const>(callback_info);
+            xdbg("[vnetwork] see callback address: %s", callback_addr.to_string().c_str());
+
+            auto contains = callback_addr.contains(receiver);
+            if (!contains) {
+                contains = receiver.contains(callback_addr);
             }
 
-#if defined(XENABLE_VHOST_BENCHMARK)
-            auto xxend = std::chrono::high_resolution_clock::now();
-            auto ms = static_cast<std::size_t>(std::chrono::duration_cast<std::chrono::milliseconds>(xxend - xxbegin).count());
-            xwarn("vhost processed in %zu milliseconds against %zu packs => tps = %lf", ms, all_byte_messages.size(), static_cast<double>(all_byte_messages.size()) * 1000 / ms);
-#endif
+            if (!contains) {
+                #if VHOST_METRICS
+                XMETRICS_COUNTER_INCREMENT("vhost_discard_addr_not_match", 1);
+                #endif
+                xdbg("[vnetwork] callback at address %s not matched", callback_addr.to_string().c_str());
+                continue;
+            }
+            callbacks.push_back(callback_info);
+        }
+    }
 
+    if (callbacks.empty()) {
+        xinfo("[vnetwork] no callback found for message hash: %" PRIx64 " , sender is %s , receiver is %s",
+              vnetwork_message.hash(),
+              sender.to_string().c_str(),
+              receiver.to_string().c_str());
+    }
 
-        } catch (std::exception const & eh) {
-            xwarn("[vnetwork] catches std::exception: %s", eh.what());
-        } catch (...) {
-            xwarn("[vnetwork] catches an unknown exception");
+    return callbacks;
+}
+
+void xtop_vhost::handle_lane_message(xlane_message_t const & lane_message) {
+    auto const & vnetwork_message = *lane_message.vnetwork_message;
+    auto const & message = vnetwork_message.message();
+    auto const & sender = vnetwork_message.sender();
+    auto const msg_time = vnetwork_message.logic_time();
+
+    for (auto const & callback_info : lane_message.callbacks) {
+        auto const & callback = top::get<xmessage_ready_callback_t>(callback_info);
+        if (callback) {
+            try {
+                // callback(sender, receiver, message);
+                xdbg("[vnetwork] send msg %" PRIx32 " (hash %" PRIx64 ") to callback %p at address %s",
+                     static_cast<std::uint32_t>(message.id()),
+                     message.hash(),
+                     &callback,
+                     top::get<common::xnode_address_t const>(callback_info).to_string().c_str());
+#ifdef ENABLE_METRICS
+                char msg_info[30] = {0};
+                snprintf(msg_info, 29, "%x|%" PRIx64, vnetwork_message.message().id(), message.hash());
+                XMETRICS_TIME_RECORD_KEY_WITH_TIMEOUT("vhost_handle_data_callback", msg_info, uint32_t(100000));
+#endif
+                XMETRICS_GAUGE(metrics::vhost_recv_callback, 1);
+                callback(sender, message, msg_time);
+            } catch (std::exception const & eh) {
+                xerror("[vnetwork] exception caught from callback: %s", eh.what());
+            }
+        } else {
+            xerror("[vnetwork] callback not registered");
         }
     }
 }
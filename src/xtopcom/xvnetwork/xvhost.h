@@ -16,9 +16,9 @@
 
 #include <memory>
 #include <mutex>
-#if defined DEBUG
-#    include <thread>
-#endif
+#include <string>
+#include <utility>
+#include <vector>
 
 NS_BEG2(top, vnetwork)
 
@@ -29,13 +29,31 @@ private:
     using base_t = xbasic_vhost_t;
 
     constexpr static std::size_t max_message_queue_size{100000};
-    threading::xthreadsafe_queue<xbyte_buffer_t, std::vector<xbyte_buffer_t>> m_message_queue{max_message_queue_size};
-    
+
+    /**
+     * @brief A filtered message with the callbacks it matched on one lane.
+     */
+    struct xtop_lane_message {
+        std::shared_ptr<xvnetwork_message_t const> vnetwork_message;
+        std::vector<std::pair<common::xnode_address_t const, xmessage_ready_callback_t>> callbacks;
+    };
+    using xlane_message_t = xtop_lane_message;
+
+    /**
+     * @brief One dispatch thread with its own queue. A callback is always called on the lane picked by its registered address,
+     *        so each vnode handles its messages, unicast or broadcast, in arrival order while different vnodes hosted here run in parallel.
+     */
+    struct xtop_dispatch_lane {
+        threading::xthreadsafe_queue<std::unique_ptr<xlane_message_t>, std::vector<std::unique_ptr<xlane_message_t>>> message_queue{max_message_queue_size};
+        std::string queue_metrics_name;
+        std::string handled_metrics_name;
+        std::string drop_metrics_name;
+    };
+    using xdispatch_lane_t = xtop_dispatch_lane;
+    std::vector<std::unique_ptr<xdispatch_lane_t>> m_lanes;
+
     std::unique_ptr<xmessage_filter_manager_face_t> m_filter_manager;
 
-#if defined DEBUG
-    std::thread::id m_vhost_thread_id{};
-#endif
     observer_ptr<elect::xnetwork_driver_face_t> m_network_driver;
     // observer_ptr<network::xnetwork_driver_face_t> m_network_driver;
 
@@ -81,7 +99,16 @@ public:
 private:
     void on_network_data_ready(common::xaccount_address_t const & account_address, xbyte_buffer_t const & bytes);
 
-    void do_handle_network_data();
+    void do_handle_network_data(std::size_t const lane_index);
+
+    std::vector<std::pair<common::xnode_address_t const, xmessage_ready_callback_t>> match_callbacks(xvnetwork_message_t & vnetwork_message);
+
+    void dispatch_to_lanes(std::shared_ptr<xvnetwork_message_t const> const & vnetwork_message,
+                           std::vector<std::pair<common::xnode_address_t const, xmessage_ready_callback_t>> callbacks);
+
+    void handle_lane_message(xlane_message_t const & lane_message);
+
+    std::size_t select_lane(common::xnode_address_t const & callback_address) const;
 };
 using xvhost_t = xtop_vhost;
 
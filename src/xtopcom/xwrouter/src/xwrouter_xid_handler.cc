@@ -356,12 +356,12 @@ int32_t WrouterXidHandler::SendData(transport::protobuf::RoutingMessage & messag
         xwarn("wrouter message SerializeToString failed");
         return enum_xerror_code_fail;
     }
-    auto each_call = [this, &data](kadmlia::NodeInfoPtr node_info_ptr) {
+    auto each_call = [this, &data, &message](kadmlia::NodeInfoPtr node_info_ptr) {
         if (!node_info_ptr) {
             xwarn("kadmlia::NodeInfoPtr null");
             return false;
         }
-        if (kadmlia::kKadSuccess != transport_ptr_->SendDataWithProp(data, node_info_ptr->public_ip, node_info_ptr->public_port, node_info_ptr->udp_property)) {
+        if (kadmlia::kKadSuccess != transport_ptr_->SendDataWithProp(data, node_info_ptr->public_ip, node_info_ptr->public_port, node_info_ptr->udp_property, message.priority())) {
             xwarn("SendData to  endpoint(%s:%d) failed", node_info_ptr->public_ip.c_str(), node_info_ptr->public_port);
             return false;
         }
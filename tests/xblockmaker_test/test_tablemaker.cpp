@@ -2,6 +2,7 @@
 
 #include "test_common.hpp"
 #include "xblockmaker/xtable_maker.h"
+#include "xblockmaker/xunit_build_pool.h"
 
 using namespace top;
 using namespace top::base;
@@ -777,3 +778,56 @@ TEST_F(test_tablemaker, receipt_id_check_1) {
     }
 
 }
+
+TEST_F(test_tablemaker, make_light_table_parallel_same_as_sequential) {
+    xblockmaker_resources_ptr_t resources = std::make_shared<test_xblockmaker_resources_t>();
+
+    mock::xdatamock_table mocktable(1, 8);
+    std::string table_addr = mocktable.get_account();
+    std::vector<std::string> unit_addrs = mocktable.get_unit_accounts();
+
+    std::vector<xblock_ptr_t> all_gene_units = mocktable.get_all_genesis_units();
+    for (auto & v : all_gene_units) {
+        resources->get_blockstore()->store_block(base::xvaccount_t(v->get_account()), v.get());
+    }
+
+    // every account sends to next one, so units of all accounts are built by pool at the same time
+    std::vector<xcons_transaction_ptr_t> send_txs;
+    for (size_t i = 0; i < unit_addrs.size(); i++) {
+        std::vector<xcons_transaction_ptr_t> txs = mocktable.create_send_txs(unit_addrs[i], unit_addrs[(i + 1) % unit_addrs.size()], 2);
+        send_txs.insert(send_txs.end(), txs.begin(), txs.end());
+    }
+
+    xblock_ptr_t proposal_blocks[2];
+    for (int i = 0; i < 2; i++) {
+        xunit_build_pool_t::instance().set_enabled(i == 0);
+        xtable_maker_ptr_t tablemaker = make_object_ptr<xtable_maker_t>(table_addr, resources);
+        xtablemaker_para_t table_para(mocktable.get_table_state());
+        table_para.set_origin_txs(send_txs);
+        xblock_consensus_para_t proposal_para = mocktable.init_consensus_para();
+
+        xtablemaker_result_t table_result;
+        proposal_blocks[i] = tablemaker->make_proposal(table_para, proposal_para, table_result);
+        ASSERT_NE(proposal_blocks[i], nullptr);
+        ASSERT_EQ(proposal_blocks[i]->get_height(), 1);
+    }
+    xunit_build_pool_t::instance().set_enabled(true);
+
+    const xblock_ptr_t & parallel_block = proposal_blocks[0];
+    const xblock_ptr_t & sequential_block = proposal_blocks[1];
+    ASSERT_EQ(parallel_block->get_header_hash(), sequential_block->get_header_hash());
+    ASSERT_EQ(parallel_block->get_input_root_hash(), sequential_block->get_input_root_hash());
+    ASSERT_EQ(parallel_block->get_output_root_hash(), sequential_block->get_output_root_hash());
+
+    std::vector<xobject_ptr_t<base::xvblock_t>> parallel_units;
+    std::vector<xobject_ptr_t<base::xvblock_t>> sequential_units;
+    parallel_block->extract_sub_blocks(parallel_units);
+    sequential_block->extract_sub_blocks(sequential_units);
+    ASSERT_EQ(parallel_units.size(), unit_addrs.size());
+    ASSERT_EQ(parallel_units.size(), sequential_units.size());
+    for (size_t i = 0; i < parallel_units.size(); i++) {
+        ASSERT_EQ(parallel_units[i]->get_account(), sequential_units[i]->get_account());
+        ASSERT_EQ(parallel_units[i]->get_header_hash(), sequential_units[i]->get_header_hash());
+        ASSERT_EQ(parallel_units[i]->get_output_root_hash(), sequential_units[i]->get_output_root_hash());
+    }
+}
@@ -0,0 +1,60 @@
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "xblockmaker/xunit_build_pool.h"
+
+using namespace top::blockmaker;
+
+TEST(test_unit_build_pool, parallel_for_all_jobs) {
+    for (size_t count = 0; count < 64; count++) {
+        std::vector<size_t> results(count, 0);
+        xunit_build_pool_t::instance().parallel_for(count, [&](size_t index) {
+            results[index] = index * 3;
+        });
+        for (size_t i = 0; i < count; i++) {
+            ASSERT_EQ(results[i], i * 3);
+        }
+    }
+}
+
+TEST(test_unit_build_pool, parallel_for_from_many_tables) {
+    // each table maker call from its own thread at same time
+    std::atomic<size_t> total{0};
+    std::vector<std::thread> tables;
+    for (int t = 0; t < 8; t++) {
+        tables.emplace_back([&total]() {
+            for (int round = 0; round < 100; round++) {
+                xunit_build_pool_t::instance().parallel_for(32, [&total](size_t) {
+                    total++;
+                });
+            }
+        });
+    }
+    for (auto & t : tables) {
+        t.join();
+    }
+    ASSERT_EQ(total.load(), 8u * 100 * 32);
+}
+
+TEST(test_unit_build_pool, parallel_for_job_throw) {
+    // a throwing job must not hang caller, exception is rethrown after all other jobs finished
+    for (int round = 0; round < 100; round++) {
+        std::atomic<size_t> finished{0};
+        ASSERT_THROW(xunit_build_pool_t::instance().parallel_for(32, [&finished](size_t index) {
+            if (index == 7) {
+                throw std::runtime_error("job fail");
+            }
+            finished++;
+        }), std::runtime_error);
+        ASSERT_EQ(finished.load(), 31u);
+    }
+
+    std::atomic<size_t> total{0};
+    xunit_build_pool_t::instance().parallel_for(32, [&total](size_t) {
+        total++;
+    });
+    ASSERT_EQ(total.load(), 32u);
+}
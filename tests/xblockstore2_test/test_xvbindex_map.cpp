@@ -0,0 +1,124 @@
+#include "gtest/gtest.h"
+
+#include <map>
+#include <chrono>
+#include <vector>
+
+#include "xblockstore/src/xvbindexmap.h"
+
+using namespace top::store;
+
+namespace {
+
+typedef std::map<uint64_t, std::map<uint64_t, uintptr_t>>  std_height_map_t;
+typedef xheightmap_t<xviewmap_t<uintptr_t>>                  flat_height_map_t;
+
+const uint64_t bench_heights = 200000;
+const int      bench_keep_heights = 128;  // same as cache size of table account
+const uint64_t bench_fork_interval = 16;  // one forked view every 16 heights
+
+// simulate block cache of table account: store new height(with fork sometimes), query recent heights, clean lowest heights
+template <typename T>
+uint64_t run_cache_workload(T & cache) {
+    uint64_t checksum = 0;
+    for (uint64_t height = 1; height <= bench_heights; ++height) {
+        cache.emplace(height).first->second.emplace(height * 2, (uintptr_t)height);
+        if ((height % bench_fork_interval) == 0) {
+            cache.find(height)->second.emplace(height * 2 + 1, (uintptr_t)height + 1);
+        }
+
+        for (uint64_t back = 0; back < 3 && back < height; ++back) {  // query prev & prev_prev like connect_index
+            auto it = cache.find(height - back);
+            if (it != cache.end()) {
+                for (auto view_it = it->second.rbegin(); view_it != it->second.rend(); ++view_it)
+                    checksum += view_it->second;
+            }
+        }
+
+        while ((int)cache.size() > bench_keep_heights) {
+            cache.erase(cache.begin());
+        }
+    }
+    return checksum;
+}
+
+// adapter to let std::map share same workload
+class std_cache_t {
+public:
+    std::pair<std_height_map_t::iterator, bool> emplace(uint64_t height) {
+        return m_map.emplace(height, std::map<uint64_t, uintptr_t>());
+    }
+    std_height_map_t::iterator find(uint64_t height) { return m_map.find(height); }
+    std_height_map_t::iterator begin() { return m_map.begin(); }
+    std_height_map_t::iterator end() { return m_map.end(); }
+    std_height_map_t::iterator erase(std_height_map_t::iterator it) { return m_map.erase(it); }
+    size_t size() const { return m_map.size(); }
+
+private:
+    std_height_map_t m_map;
+};
+
+}  // namespace
+
+TEST(test_xvbindex_map, viewmap_inline_and_heap) {
+    xviewmap_t<uintptr_t> views;
+    ASSERT_TRUE(views.empty());
+    ASSERT_TRUE(views.emplace(5, 50).second);
+    ASSERT_TRUE(views.emplace(3, 30).second);
+    ASSERT_FALSE(views.emplace(5, 51).second);  // never overwrite like std::map
+    ASSERT_EQ(views.find(5)->second, 50u);
+    ASSERT_TRUE(views.emplace(4, 40).second);  // move to heap
+    ASSERT_TRUE(views.emplace(9, 90).second);
+    ASSERT_EQ(views.size(), 4u);
+
+    std::vector<uint64_t> order;
+    for (auto it = views.begin(); it != views.end(); ++it)
+        order.push_back(it->first);
+    ASSERT_EQ(order, std::vector<uint64_t>({3, 4, 5, 9}));
+    ASSERT_EQ(views.rbegin()->first, 9u);
+
+    auto next = views.erase(views.find(4));
+    ASSERT_EQ(next->first, 5u);
+    ASSERT_TRUE(views.find(4) == views.end());
+    views.clear();
+    ASSERT_TRUE(views.empty());
+}
+
+TEST(test_xvbindex_map, heightmap_sparse_and_continuous) {
+    flat_height_map_t heights;
+    heights.emplace(0);  // genesis keeps far away from latest heights
+    for (uint64_t h = 1000; h < 1010; ++h)
+        heights.emplace(h).first->second.emplace(1, h);
+    heights.emplace(500);  // insert into gap
+
+    ASSERT_EQ(heights.size(), 12u);
+    ASSERT_TRUE(heights.find(0) != heights.end());
+    ASSERT_TRUE(heights.find(500) != heights.end());
+    ASSERT_TRUE(heights.find(999) == heights.end());
+    ASSERT_EQ(heights.find(1005)->second.find(1)->second, 1005u);
+    ASSERT_FALSE(heights.emplace(1005).second);
+
+    auto it = heights.find(1005);
+    auto prev_it = it;
+    --prev_it;
+    ASSERT_EQ(prev_it->first, 1004u);
+    it = heights.erase(it);
+    ASSERT_EQ(it->first, 1006u);
+    ASSERT_TRUE(heights.find(1005) == heights.end());
+    ASSERT_EQ(heights.rbegin()->first, 1009u);
+}
+
+TEST(test_xvbindex_map, BENCH_store_query_clean) {
+    std_cache_t std_cache;
+    auto start = std::chrono::steady_clock::now();
+    const uint64_t std_checksum = run_cache_workload(std_cache);
+    const auto std_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+    flat_height_map_t flat_cache;
+    start = std::chrono::steady_clock::now();
+    const uint64_t flat_checksum = run_cache_workload(flat_cache);
+    const auto flat_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+    ASSERT_EQ(std_checksum, flat_checksum);
+    std::cout << "heights=" << bench_heights << " std::map=" << std_ms << "ms flat=" << flat_ms << "ms" << std::endl;
+}
@@ -16,6 +16,7 @@
 
 #include <limits.h>
 #include <inttypes.h>
+#include <gtest/gtest.h>
 
 using namespace top;
 using namespace top::test;
@@ -291,5 +292,6 @@ int main(int argc, const char * argv[])
 
     test_ca_api();
 
-    return 0;
+    testing::InitGoogleTest(&argc, (char**)argv);
+    return RUN_ALL_TESTS();
 }
@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+#include "xcertauth/src/xpubkeycache.h"
+#include "xmutisig/xmutisig.h"
+#include "xmutisig/xschnorr/xschnorr.h"
+
+using namespace top;
+using namespace top::auth;
+
+namespace {
+
+const uint32_t group_size = 16;
+
+class test_pubkeycache : public testing::Test {
+protected:
+    void SetUp() override {
+        for (uint32_t i = 0; i <= group_size; ++i) {  // one more key to replace node of a slot
+            m_prikeys.emplace_back(new xmutisig::xprikey());
+            m_pubkeys.emplace_back(new xmutisig::xpubkey(*m_prikeys.back()));
+            m_pubkey_strs.push_back(m_pubkeys.back()->get_serialize_str());
+        }
+    }
+
+    // slot i is signed by key at key_indexes[i]
+    std::shared_ptr<xmutisig::xpubkey> get(xaggpubkey_cache_t & cache, const xvip2_t & group, const std::vector<uint32_t> & slots, const std::vector<uint32_t> & key_indexes) {
+        std::vector<std::string> pubkeys;
+        for (auto index : key_indexes)
+            pubkeys.push_back(m_pubkey_strs[index]);
+        return cache.get_aggregated_pubkey(group, group_size, slots, pubkeys);
+    }
+    std::shared_ptr<xmutisig::xpubkey> get(xaggpubkey_cache_t & cache, const xvip2_t & group, const std::vector<uint32_t> & slots) {
+        return get(cache, group, slots, slots);
+    }
+
+    std::string expect(const std::vector<uint32_t> & key_indexes) {
+        std::vector<xmutisig::xpubkey *> keys;
+        for (auto index : key_indexes)
+            keys.push_back(m_pubkeys[index].get());
+        return xmutisig::xmutisig::aggregate_pubkeys(keys, xmutisig::xschnorr::instance())->get_serialize_str();
+    }
+
+    static std::vector<uint32_t> range(uint32_t begin, uint32_t end) {
+        std::vector<uint32_t> slots;
+        for (uint32_t i = begin; i < end; ++i)
+            slots.push_back(i);
+        return slots;
+    }
+
+    xvip2_t m_group{1, 1};
+    std::vector<std::unique_ptr<xmutisig::xprikey>> m_prikeys;
+    std::vector<std::unique_ptr<xmutisig::xpubkey>> m_pubkeys;
+    std::vector<std::string> m_pubkey_strs;
+};
+
+}  // namespace
+
+TEST_F(test_pubkeycache, hit) {
+    xaggpubkey_cache_t cache;
+    auto slots = range(0, 12);
+    auto first = get(cache, m_group, slots);
+    ASSERT_NE(first, nullptr);
+    ASSERT_EQ(first->get_serialize_str(), expect(slots));
+    ASSERT_EQ(cache.get_miss_count(), 1u);
+
+    auto second = get(cache, m_group, slots);
+    ASSERT_EQ(second, first);
+    ASSERT_EQ(cache.get_hit_count(), 1u);
+    ASSERT_EQ(cache.get_miss_count(), 1u);
+}
+
+TEST_F(test_pubkeycache, incremental) {
+    xaggpubkey_cache_t cache;
+    ASSERT_NE(get(cache, m_group, range(0, 12)), nullptr);
+
+    // slot 0 left and slot 12 joined
+    auto slots = range(1, 13);
+    auto derived = get(cache, m_group, slots);
+    ASSERT_NE(derived, nullptr);
+    ASSERT_EQ(derived->get_serialize_str(), expect(slots));
+    ASSERT_EQ(cache.get_incremental_count(), 1u);
+    ASSERT_EQ(cache.get_miss_count(), 1u);
+
+    // too different,aggregate all
+    slots = range(6, 16);
+    ASSERT_EQ(get(cache, m_group, slots)->get_serialize_str(), expect(slots));
+    ASSERT_EQ(cache.get_incremental_count(), 1u);
+    ASSERT_EQ(cache.get_miss_count(), 2u);
+}
+
+TEST_F(test_pubkeycache, slot_pubkey_changed) {
+    xaggpubkey_cache_t cache;
+    auto slots = range(0, 12);
+    ASSERT_NE(get(cache, m_group, slots), nullptr);
+
+    // node at slot 3 is replaced,cached key must not be used
+    auto key_indexes = slots;
+    key_indexes[3] = group_size;
+    auto changed = get(cache, m_group, slots, key_indexes);
+    ASSERT_NE(changed, nullptr);
+    ASSERT_EQ(changed->get_serialize_str(), expect(key_indexes));
+    ASSERT_EQ(cache.get_hit_count(), 0u);
+    ASSERT_EQ(cache.get_incremental_count(), 0u);
+    ASSERT_EQ(cache.get_miss_count(), 2u);
+
+    ASSERT_EQ(get(cache, m_group, slots, key_indexes), changed);
+    ASSERT_EQ(cache.get_hit_count(), 1u);
+}
+
+TEST_F(test_pubkeycache, evict_signers) {
+    xaggpubkey_cache_t cache;
+    // 9 signer sets,each misses one slot,only last 8 are kept for the group
+    std::vector<std::vector<uint32_t>> signer_sets;
+    for (uint32_t skip = 0; skip < 9; ++skip) {
+        std::vector<uint32_t> slots;
+        for (uint32_t slot = 0; slot < group_size; ++slot) {
+            if (slot != skip)
+                slots.push_back(slot);
+        }
+        signer_sets.push_back(slots);
+        ASSERT_NE(get(cache, m_group, slots), nullptr);
+    }
+    ASSERT_EQ(cache.get_hit_count(), 0u);
+
+    ASSERT_EQ(get(cache, m_group, signer_sets[0])->get_serialize_str(), expect(signer_sets[0]));
+    ASSERT_EQ(cache.get_hit_count(), 0u);
+    ASSERT_NE(get(cache, m_group, signer_sets[8]), nullptr);
+    ASSERT_EQ(cache.get_hit_count(), 1u);
+}
+
+TEST_F(test_pubkeycache, evict_group) {
+    xaggpubkey_cache_t cache;
+    auto slots = range(0, 1);
+    ASSERT_NE(get(cache, m_group, slots), nullptr);
+    ASSERT_NE(get(cache, m_group, slots), nullptr);
+    ASSERT_EQ(cache.get_hit_count(), 1u);
+
+    // 256 groups are kept,the least recent used one goes
+    for (uint64_t i = 0; i < 256; ++i) {
+        xvip2_t group{2, i};
+        ASSERT_NE(get(cache, group, slots), nullptr);
+    }
+    const uint64_t miss_count = cache.get_miss_count();
+    ASSERT_NE(get(cache, m_group, slots), nullptr);
+    ASSERT_EQ(cache.get_hit_count(), 1u);
+    ASSERT_EQ(cache.get_miss_count(), miss_count + 1);
+}
@@ -1,3 +1,5 @@
+#include <atomic>
+#include <chrono>
 #include <vector>
 #include <algorithm>
 #include <stdio.h>
@@ -5,6 +7,7 @@
 #include "gtest/gtest.h"
 #include "xdb/xdb.h"
 #include "xdb/xdb_factory.h"
+#include "xdb/xdb_write_pipeline.h"
 
 using namespace top::db;
 using namespace std;
@@ -291,6 +294,157 @@ TEST_F(test_xdb, db_read_range) {
         ASSERT_NE(iter, values.end());
     }
 }
+
+TEST_F(test_xdb, db_read_pinned) {
+    std::vector<xdb_path_t> db_paths;
+    xdb db1(DB_NAME,db_paths);
+
+    const std::string value(4096, 'p');
+    db1.write("r/123456/pinned_key", value);
+    {
+        auto pinned = db1.read_pinned("r/123456/pinned_key");
+        ASSERT_NE(pinned, nullptr);
+        ASSERT_EQ(std::string(pinned->data(), pinned->size()), value);
+    }
+    ASSERT_EQ(db1.read_pinned("r/123456/non_exist_key"), nullptr);
+
+    std::shared_ptr<xdb_face_t> memdb = xdb_factory_t::create_memdb();
+    memdb->write("mem_key", "mem_value");
+    auto pinned = memdb->read_pinned("mem_key");
+    ASSERT_NE(pinned, nullptr);
+    ASSERT_EQ(std::string(pinned->data(), pinned->size()), "mem_value");
+}
+
+TEST_F(test_xdb, db_multi_read) {
+    std::vector<xdb_path_t> db_paths;
+    xdb db1(DB_NAME,db_paths);
+
+    db1.write("r/123456/multi_obj", "object");
+    db1.write("r/123457/multi_input", "input");
+    db1.write("multi_meta", "meta");
+    db1.write("multi_empty", "");
+
+    std::vector<std::string> keys{"r/123456/multi_obj", "", "r/123457/multi_input", "r/123458/non_exist", "multi_meta", "multi_empty"};
+    std::vector<std::string> values;
+    std::vector<bool> found_flags;
+    ASSERT_TRUE(db1.multi_read(keys, values, found_flags));
+    ASSERT_EQ(values.size(), keys.size());
+    ASSERT_EQ(found_flags.size(), keys.size());
+    ASSERT_EQ(values[0], "object");
+    ASSERT_FALSE(found_flags[1]);
+    ASSERT_EQ(values[2], "input");
+    ASSERT_FALSE(found_flags[3]);
+    ASSERT_TRUE(values[3].empty());
+    ASSERT_EQ(values[4], "meta");
+    ASSERT_TRUE(found_flags[5]);  // empty value is still found
+    ASSERT_TRUE(values[5].empty());
+}
+
+TEST_F(test_xdb, db_write_pipeline) {
+    std::vector<xdb_path_t> db_paths;
+    std::shared_ptr<xdb_face_t> kvdb = std::make_shared<xdb>(DB_NAME, db_paths);
+    xdb_write_pipeline_options_t options;
+    options.enable = true;
+    options.wal_sync = xdb_wal_sync_every_batch;
+    xdb_write_pipeline_t pipeline(kvdb, options);
+
+    std::string value;
+    std::future<bool> pending = pipeline.batch_change_async({{"pipeline_key1", "v1"}}, {}, nullptr);
+    ASSERT_TRUE(pipeline.read("pipeline_key1", value));  // read-your-writes,committed or not
+    ASSERT_EQ(value, "v1");
+    ASSERT_TRUE(pending.get());
+
+    ASSERT_TRUE(pipeline.write("pipeline_key1", "v1_sync"));  // returns after its batch committed
+    ASSERT_TRUE(kvdb->read("pipeline_key1", value));
+    ASSERT_EQ(value, "v1_sync");
+
+    ASSERT_TRUE(pipeline.erase("pipeline_key1"));
+    ASSERT_FALSE(pipeline.read("pipeline_key1", value));
+
+    std::map<std::string, std::string> objs{{"pipeline_key2", "v2"}, {"pipeline_key3", "v3"}};
+    std::atomic<int> callback_count{0};
+    std::future<bool> result = pipeline.batch_change_async(objs, {"pipeline_key1"}, [&callback_count](bool ret) {
+        if (ret)
+            callback_count++;
+    });
+    ASSERT_TRUE(result.get());
+    ASSERT_EQ(callback_count, 1);
+
+    pipeline.flush();
+    ASSERT_EQ(pipeline.get_queue_depth(), 0);
+    ASSERT_TRUE(kvdb->read("pipeline_key2", value));
+    ASSERT_EQ(value, "v2");
+    ASSERT_FALSE(kvdb->read("pipeline_key1", value));
+
+    std::vector<std::string> keys{"pipeline_key2", "pipeline_key3", "pipeline_key1"};
+    std::vector<std::string> values;
+    std::vector<bool> found_flags;
+    ASSERT_TRUE(pipeline.write("pipeline_key3", "v3_new"));
+    ASSERT_TRUE(pipeline.multi_read(keys, values, found_flags));
+    ASSERT_EQ(values[0], "v2");
+    ASSERT_EQ(values[1], "v3_new");
+    ASSERT_FALSE(found_flags[2]);
+}
+
+TEST_F(test_xdb, db_write_pipeline_sync_no_delay) {
+    std::vector<xdb_path_t> db_paths;
+    std::shared_ptr<xdb_face_t> kvdb = std::make_shared<xdb>(DB_NAME, db_paths);
+    xdb_write_pipeline_options_t options;
+    options.enable = true;
+    options.max_delay_ms = 1000;
+    xdb_write_pipeline_t pipeline(kvdb, options);
+
+    // blocked writer is committed at once instead of waiting for the group commit window
+    auto begin = std::chrono::steady_clock::now();
+    for (int i = 0; i < 10; i++) {
+        ASSERT_TRUE(pipeline.write("pipeline_sync_key" + std::to_string(i), "v"));
+    }
+    ASSERT_LT(std::chrono::steady_clock::now() - begin, std::chrono::milliseconds(options.max_delay_ms));
+
+    // async writer waits for the window,a blocked writer arrived meantime ends it
+    std::future<bool> pending = pipeline.batch_change_async({{"pipeline_async_key", "v"}}, {}, nullptr);
+    begin = std::chrono::steady_clock::now();
+    ASSERT_TRUE(pipeline.write("pipeline_sync_key", "v"));
+    ASSERT_TRUE(pending.get());
+    ASSERT_LT(std::chrono::steady_clock::now() - begin, std::chrono::milliseconds(options.max_delay_ms));
+}
+
+TEST_F(test_xdb, db_cf_profile_from_name) {
+    ASSERT_EQ(xdb_cf_profile_t::from_name("default").name, "default");
+    ASSERT_EQ(xdb_cf_profile_t::from_name("hot").name, "hot");
+    ASSERT_EQ(xdb_cf_profile_t::from_name("unknown").name, "default");
+
+    xdb_cf_profile_t archive = xdb_cf_profile_t::from_name("archive");
+    ASSERT_EQ(archive.name, "archive");
+    ASSERT_TRUE(archive.partition_index_filters);
+    ASSERT_EQ(archive.bottommost_compression, xdb_compression_zstd);
+    ASSERT_GT(archive.bottommost_dict_bytes, 0);
+}
+
+TEST_F(test_xdb, db_open_with_archive_profile) {
+    string db_dir = "./test_db_archive/";
+    xdb::destroy(db_dir);
+
+    std::vector<xdb_path_t> db_paths;
+    xdb_options_t db_options;
+    db_options.block_cf_profile = xdb_cf_profile_t::archive_profile();
+    db_options.default_cf_profile = xdb_cf_profile_t::hot_profile();
+    {
+        xdb db1(db_dir, db_paths, db_options);
+        db1.write("r/123456/block_input", std::string(16 * 1024, 'i'));
+        db1.write("meta_key", "meta_value");
+        ASSERT_TRUE(db1.compact_range("", ""));
+    }
+    {
+        xdb db2(db_dir, db_paths, db_options);
+        std::string value;
+        ASSERT_TRUE(db2.read("r/123456/block_input", value));
+        ASSERT_EQ(value, std::string(16 * 1024, 'i'));
+        ASSERT_TRUE(db2.read("meta_key", value));
+        ASSERT_EQ(value, "meta_value");
+    }
+    xdb::destroy(db_dir);
+}
 /*TEST_F(test_xdb, db_backup) {
     string db_dir = DB_NAME;
 
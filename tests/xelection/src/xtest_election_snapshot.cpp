@@ -0,0 +1,177 @@
+// Copyright (c) 2017-2018 Telos Foundation & contributors
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "tests/xelection/xdummy_chain_timer.h"
+#include "xbasic/xutility.h"
+#include "xcommon/xaddress.h"
+#include "xdata/xelection/xelection_result_store.h"
+#include "xelection/xcache/xdata_accessor.h"
+#include "xelection/xcache/xelection_snapshot.h"
+#include "xelection/xcache/xnode_element.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using top::common::xnode_id_t;
+using top::common::xnode_type_t;
+using top::common::xslot_id_t;
+using top::data::election::xelection_info_bundle_t;
+using top::data::election::xelection_info_t;
+using top::data::election::xelection_result_store_t;
+
+namespace {
+
+std::size_t const node_count{ 1023 };
+
+xelection_result_store_t committee_election_result(top::common::xgroup_address_t const & group_address,
+                                                   std::uint64_t const round,
+                                                   top::common::xlogic_time_t const start_time) {
+    xelection_result_store_t election_result_store;
+    auto & group_result = election_result_store.result_of(group_address.network_id())
+                                               .result_of(xnode_type_t::committee)
+                                               .result_of(group_address.cluster_id())
+                                               .result_of(group_address.group_id());
+    group_result.group_version(top::common::xelection_round_t{ round });
+    group_result.election_committee_version(top::common::xelection_round_t{ round });
+    group_result.start_time(start_time);
+
+    for (auto i = 0u; i < node_count; ++i) {
+        xelection_info_t new_election_info{};
+        new_election_info.joined_version = top::common::xelection_round_t{ round };
+
+        xelection_info_bundle_t election_info_bundle;
+        election_info_bundle.node_id(xnode_id_t{ std::to_string(i) });
+        election_info_bundle.election_info(std::move(new_election_info));
+
+        group_result.insert(std::move(election_info_bundle));
+    }
+    return election_result_store;
+}
+
+}  // namespace
+
+TEST(xtest_election_snapshot, publish_on_update) {
+    auto const & group_address = top::common::build_committee_sharding_address(top::common::xtestnet_id);
+    top::election::cache::xdata_accessor_t data_accessor{ group_address.network_id(), top::make_observer(top::tests::election::xdummy_chain_timer) };
+
+    auto const empty_snapshot = data_accessor.snapshot();
+    ASSERT_NE(nullptr, empty_snapshot);
+    ASSERT_EQ(0, empty_snapshot->version());
+    ASSERT_EQ(0, empty_snapshot->group_count());
+
+    std::error_code ec;
+    data_accessor.update_zone(group_address.zone_id(), committee_election_result(group_address, 0, 0), 0, ec);
+    ASSERT_EQ(0, ec.value());
+
+    auto const snapshot1 = data_accessor.snapshot();
+    ASSERT_EQ(1, snapshot1->version());
+    ASSERT_EQ(1, snapshot1->group_count());
+
+    auto const * group_entry = snapshot1->group(group_address, top::common::xelection_round_t{ 0 });
+    ASSERT_NE(nullptr, group_entry);
+    ASSERT_EQ(node_count, group_entry->nodes.size());
+    ASSERT_EQ(group_entry, snapshot1->group(group_address, group_entry->logic_epoch));
+    ASSERT_EQ(group_entry, snapshot1->group_by_height(group_address, 0));
+    ASSERT_EQ(nullptr, snapshot1->group(group_address, top::common::xelection_round_t{ 1 }));
+
+    for (auto i = 0u; i < node_count; ++i) {
+        xslot_id_t slot_id{ static_cast<xslot_id_t::value_type>(i) };
+        auto const & node_element = top::election::cache::xelection_snapshot_t::node_element(*group_entry, slot_id);
+        ASSERT_NE(nullptr, node_element);
+        ASSERT_EQ(slot_id, node_element->slot_id());
+        ASSERT_EQ(node_element, data_accessor.node_element(group_address, group_entry->logic_epoch, slot_id, ec));
+        ASSERT_EQ(0, ec.value());
+    }
+    ASSERT_EQ(nullptr, top::election::cache::xelection_snapshot_t::node_element(*group_entry, xslot_id_t{ static_cast<xslot_id_t::value_type>(node_count) }));
+
+    // same as building it from the element tree
+    auto const & group_nodes = data_accessor.group_nodes(group_address, group_entry->logic_epoch, ec);
+    ASSERT_EQ(0, ec.value());
+    ASSERT_EQ(node_count, group_nodes.size());
+    auto const & group_element = data_accessor.group_element(group_address, group_entry->logic_epoch, ec);
+    ASSERT_EQ(0, ec.value());
+    ASSERT_EQ(node_count, group_element->children(ec).size());
+
+    data_accessor.update_zone(group_address.zone_id(), committee_election_result(group_address, 1, 10), 1, ec);
+    ASSERT_EQ(0, ec.value());
+
+    // readers keep the snapshot they loaded
+    auto const snapshot2 = data_accessor.snapshot();
+    ASSERT_EQ(2, snapshot2->version());
+    ASSERT_NE(nullptr, snapshot2->group(group_address, top::common::xelection_round_t{ 1 }));
+    ASSERT_EQ(1, snapshot1->group_count());
+    ASSERT_EQ(nullptr, snapshot1->group(group_address, top::common::xelection_round_t{ 1 }));
+}
+
+// lookup throughput of node_element / group_nodes while another thread keeps publishing election updates
+TEST(xtest_election_snapshot, BENCH_lookup_under_update) {
+    auto const & group_address = top::common::build_committee_sharding_address(top::common::xtestnet_id);
+    top::election::cache::xdata_accessor_t data_accessor{ group_address.network_id(), top::make_observer(top::tests::election::xdummy_chain_timer) };
+
+    auto const election_result_store = committee_election_result(group_address, 0, 0);
+    std::error_code ec;
+    data_accessor.update_zone(group_address.zone_id(), election_result_store, 0, ec);
+    ASSERT_EQ(0, ec.value());
+    auto const logic_epoch = data_accessor.snapshot()->group(group_address, top::common::xelection_round_t{ 0 })->logic_epoch;
+
+    std::size_t const reader_count{ 8 };
+    std::chrono::milliseconds const duration{ 2000 };
+    std::atomic<bool> stop{ false };
+    std::atomic<std::uint64_t> lookups{ 0 };
+    std::atomic<std::uint64_t> group_lookups{ 0 };
+    std::atomic<std::uint64_t> failures{ 0 };
+    std::uint64_t updates{ 0 };
+
+    std::vector<std::thread> readers;
+    for (auto r = 0u; r < reader_count; ++r) {
+        readers.emplace_back([&, r] {
+            std::uint64_t count{ 0 };
+            std::uint64_t group_count{ 0 };
+            std::uint64_t failure_count{ 0 };
+            for (auto i = r; !stop; ++i) {
+                std::error_code ec1;
+                xslot_id_t slot_id{ static_cast<xslot_id_t::value_type>(i % node_count) };
+                if (data_accessor.node_element(group_address, logic_epoch, slot_id, ec1) == nullptr) {
+                    ++failure_count;
+                }
+                ++count;
+
+                if (i % 64 == 0) {
+                    auto const snapshot = data_accessor.snapshot();
+                    auto const * group_entry = snapshot->group(group_address, logic_epoch);
+                    if (group_entry == nullptr || group_entry->nodes.size() != node_count) {
+                        ++failure_count;
+                    }
+                    ++group_count;
+                }
+            }
+            lookups += count;
+            group_lookups += group_count;
+            failures += failure_count;
+        });
+    }
+
+    auto const begin = std::chrono::steady_clock::now();
+    while (std::chrono::steady_clock::now() - begin < duration) {
+        std::error_code ec1;
+        data_accessor.update_zone(group_address.zone_id(), election_result_store, 0, ec1);
+        ++updates;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    stop = true;
+    for (auto & reader : readers) {
+        reader.join();
+    }
+    auto const ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - begin).count();
+
+    std::cout << "election snapshot: " << reader_count << " readers, " << updates << " updates, " << lookups.load() << " node lookups ("
+              << lookups.load() * 1000 / (ms + 1) << "/s), " << group_lookups.load() << " group lookups, " << failures.load() << " failures, " << ms << "ms"
+              << std::endl;
+    ASSERT_EQ(0, failures.load());
+}
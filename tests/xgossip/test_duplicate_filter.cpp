@@ -0,0 +1,96 @@
+#include "gtest/gtest.h"
+#include "xgossip/include/duplicate_filter.h"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace top;
+using namespace top::gossip;
+
+TEST(test_duplicate_filter, check_and_add) {
+    DuplicateFilter filter{1000};
+    ASSERT_EQ(filter.Capacity(), 1024u);
+    ASSERT_FALSE(filter.CheckAndAdd(0));
+    ASSERT_TRUE(filter.CheckAndAdd(0));
+    ASSERT_FALSE(filter.CheckAndAdd(12345));
+    ASSERT_TRUE(filter.CheckAndAdd(12345));
+    ASSERT_EQ(filter.CountLive(), 2u);
+    ASSERT_EQ(filter.DuplicateCount(), 2u);
+}
+
+TEST(test_duplicate_filter, rotate) {
+    DuplicateFilter filter{1024};
+    ASSERT_FALSE(filter.CheckAndAdd(1));
+    filter.Rotate();
+    // still duplicate in next period
+    ASSERT_TRUE(filter.CheckAndAdd(1));
+    ASSERT_FALSE(filter.CheckAndAdd(2));
+    filter.Rotate();
+    ASSERT_FALSE(filter.CheckAndAdd(1));
+    ASSERT_TRUE(filter.CheckAndAdd(2));
+    ASSERT_EQ(filter.CountLive(), 2u);
+}
+
+TEST(test_duplicate_filter, fixed_memory) {
+    DuplicateFilter filter{1024};
+    for (uint32_t i = 0; i < 10000; ++i) {
+        filter.CheckAndAdd(i * 7919u);
+    }
+    ASSERT_EQ(filter.CountLive(), 1024u);
+    ASSERT_GT(filter.OverflowCount(), 0u);
+
+    // expired slots are reused
+    filter.Rotate();
+    filter.Rotate();
+    ASSERT_EQ(filter.CountLive(), 0u);
+    ASSERT_FALSE(filter.CheckAndAdd(1));
+    ASSERT_TRUE(filter.CheckAndAdd(1));
+}
+
+TEST(test_duplicate_filter, concurrent_same_keys) {
+    DuplicateFilter filter{1 << 16};
+    const uint32_t keys = 10000;
+    const uint32_t threads_count = 8;
+    std::atomic<uint32_t> added{0};
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < threads_count; ++t) {
+        threads.emplace_back([&] {
+            for (uint32_t i = 0; i < keys; ++i) {
+                if (!filter.CheckAndAdd(i)) {
+                    added++;
+                }
+            }
+        });
+    }
+    for (auto & thread : threads) {
+        thread.join();
+    }
+    // each key passes exactly once
+    ASSERT_EQ(added.load(), keys);
+    ASSERT_EQ(filter.CountLive(), keys);
+}
+
+TEST(test_duplicate_filter, BENCH_check_and_add) {
+    DuplicateFilter filter{1 << 21};
+    const uint32_t count = 300000;
+    const uint32_t threads_count = 8;
+    auto begin = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < threads_count; ++t) {
+        threads.emplace_back([&filter, t] {
+            // every message arrives about 3 times from different neighbors
+            for (uint32_t i = 0; i < count; ++i) {
+                filter.CheckAndAdd((i / 3) * threads_count + t);
+            }
+        });
+    }
+    for (auto & thread : threads) {
+        thread.join();
+    }
+    auto us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin).count();
+    std::cout << "CheckAndAdd: " << threads_count << " threads " << count * threads_count << " messages " << us << "us, qps="
+              << (uint64_t)count * threads_count * 1000000 / (us + 1) << std::endl;
+}
@@ -0,0 +1,70 @@
+#include "gtest/gtest.h"
+#include "xrpc/xgetblock/xblock_json_cache.h"
+
+using namespace top;
+using chain_info::xblock_json_cache_t;
+
+namespace {
+xJson::Value make_block_json(uint64_t height, std::size_t body_size) {
+    xJson::Value root;
+    root["header"]["height"] = static_cast<xJson::UInt64>(height);
+    root["body"]["data"] = std::string(body_size, 'a');
+    return root;
+}
+}  // namespace
+
+TEST(test_block_json_cache, get_put) {
+    xblock_json_cache_t cache{1024 * 1024};
+    const std::string account{"Ta0000@0"};
+    xJson::Value value;
+    ASSERT_FALSE(cache.get(account, 1, "2.0", "hash1", value));
+
+    cache.put(account, 1, "2.0", "hash1", make_block_json(1, 100));
+    ASSERT_TRUE(cache.get(account, 1, "2.0", "hash1", value));
+    ASSERT_EQ(value["header"]["height"].asUInt64(), 1u);
+    ASSERT_EQ(value["body"]["data"].asString().size(), 100u);
+
+    // rpc version is part of key
+    ASSERT_FALSE(cache.get(account, 1, "1.0", "hash1", value));
+    ASSERT_FALSE(cache.get(account, 2, "2.0", "hash1", value));
+
+    // modify the returned json should not touch the cached one
+    value["property_info"] = "x";
+    xJson::Value value2;
+    ASSERT_TRUE(cache.get(account, 1, "2.0", "hash1", value2));
+    ASSERT_FALSE(value2.isMember("property_info"));
+}
+
+TEST(test_block_json_cache, block_changed) {
+    xblock_json_cache_t cache{1024 * 1024};
+    const std::string account{"Ta0000@0"};
+    cache.put(account, 1, "2.0", "hash1", make_block_json(1, 100));
+    cache.put(account, 1, "1.0", "hash1", make_block_json(1, 100));
+    ASSERT_EQ(cache.size(), 2u);
+
+    // block at same height is replaced by fork,cached json is dropped
+    xJson::Value value;
+    ASSERT_FALSE(cache.get(account, 1, "2.0", "hash2", value));
+    ASSERT_EQ(cache.size(), 1u);
+    ASSERT_TRUE(cache.get(account, 1, "1.0", "hash1", value));
+}
+
+TEST(test_block_json_cache, bounded_by_bytes) {
+    const std::size_t max_bytes = 64 * 1024;
+    xblock_json_cache_t cache{max_bytes};
+    const std::string account{"Ta0000@0"};
+    for (uint64_t height = 0; height < 100; height++) {
+        cache.put(account, height, "2.0", "hash", make_block_json(height, 1000));
+        ASSERT_LE(cache.bytes(), max_bytes);
+    }
+    ASSERT_LT(cache.size(), 100u);
+
+    // least recently used is evicted first
+    xJson::Value value;
+    ASSERT_TRUE(cache.get(account, 99, "2.0", "hash", value));
+    ASSERT_FALSE(cache.get(account, 0, "2.0", "hash", value));
+
+    // too big json is not cached
+    cache.put(account, 1000, "2.0", "hash", make_block_json(1000, max_bytes));
+    ASSERT_FALSE(cache.get(account, 1000, "2.0", "hash", value));
+}
@@ -0,0 +1,146 @@
+#include "gtest/gtest.h"
+#include "xrpc/xhttp/xhttp_worker_pool.h"
+#include "xrpc/xhttp/xhttp_server.h"
+#include "tests/xvnetwork/xdummy_vnetwork_driver.h"
+#include "simplewebserver/client_http.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+using namespace top;
+using namespace top::xrpc;
+
+using HttpClient = SimpleWeb::Client<SimpleWeb::HTTP>;
+
+namespace {
+template <typename F>
+bool wait_until(F f) {
+    for (int i = 0; i < 1000; i++) {
+        if (f()) {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    return f();
+}
+}  // namespace
+
+TEST(test_http_worker_pool, method_concurrency_limit) {
+    xhttp_worker_pool pool{4, 1000, 1};
+    pool.set_method_limit("getAccount", 2);
+    pool.start();
+
+    std::atomic<bool> release{false};
+    std::atomic<uint32_t> block_running{0};
+    std::atomic<uint32_t> block_max{0};
+    std::atomic<uint32_t> done{0};
+    auto slow_task = [&](std::atomic<uint32_t> & running, std::atomic<uint32_t> & max_running) {
+        auto now = ++running;
+        uint32_t old = max_running.load();
+        while (now > old && !max_running.compare_exchange_weak(old, now)) {
+        }
+        while (!release) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        running--;
+        done++;
+    };
+    std::atomic<uint32_t> account_running{0};
+    std::atomic<uint32_t> account_max{0};
+    for (int i = 0; i < 10; i++) {
+        ASSERT_TRUE(pool.submit("getBlock", [&] { slow_task(block_running, block_max); }));
+        ASSERT_TRUE(pool.submit("getAccount", [&] { slow_task(account_running, account_max); }));
+    }
+    ASSERT_TRUE(wait_until([&] { return block_running == 1 && account_running == 2; }));
+
+    // slow methods keep only their limit of workers busy, others still get served
+    std::atomic<bool> fast_done{false};
+    ASSERT_TRUE(pool.submit("requestToken", [&] { fast_done = true; }));
+    ASSERT_TRUE(wait_until([&] { return fast_done.load(); }));
+    ASSERT_EQ(pool.running("getBlock"), 1u);
+    ASSERT_EQ(pool.running("getAccount"), 2u);
+
+    release = true;
+    ASSERT_TRUE(wait_until([&] { return done == 20; }));
+    ASSERT_EQ(block_max.load(), 1u);
+    ASSERT_EQ(account_max.load(), 2u);
+    ASSERT_EQ(pool.queue_size(), 0u);
+    pool.stop();
+}
+
+TEST(test_http_worker_pool, reject_when_queue_full) {
+    xhttp_worker_pool pool{1, 5, 1};
+    pool.start();
+
+    std::atomic<bool> release{false};
+    std::atomic<bool> started{false};
+    std::atomic<uint32_t> done{0};
+    ASSERT_TRUE(pool.submit("getBlock", [&] {
+        started = true;
+        while (!release) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        done++;
+    }));
+    ASSERT_TRUE(wait_until([&] { return started.load(); }));
+
+    for (int i = 0; i < 5; i++) {
+        ASSERT_TRUE(pool.submit("getBlock", [&] { done++; }));
+    }
+    ASSERT_EQ(pool.queue_size(), 5u);
+    ASSERT_FALSE(pool.submit("getBlock", [&] { done++; }));
+    ASSERT_FALSE(pool.submit("getAccount", [&] { done++; }));
+
+    release = true;
+    ASSERT_TRUE(wait_until([&] { return done == 6; }));
+    pool.stop();
+    ASSERT_FALSE(pool.submit("getBlock", [&] { done++; }));
+}
+
+// load test: drives xedge_http_method through local http server with keep-alive clients.
+// requestToken is answered by edge locally, so it measures the server side only.
+TEST(test_http_worker_pool, BENCH_http_server) {
+    const uint16_t port = 19981;
+    const uint32_t clients = 16;
+    const uint32_t requests_per_client = 2000;
+
+    auto vhost = std::make_shared<tests::vnetwork::xdummy_vnetwork_driver_t>();
+    auto router_ptr = top::make_observer<router::xrouter_t>(new router::xrouter_t);
+    auto thread = top::make_observer(base::xiothread_t::create_thread(base::xcontext_t::instance(), 0, -1));
+    auto edge_handler = std::make_shared<xrpc_edge_vhost>(vhost, router_ptr, thread);
+    auto http_server = std::make_shared<xhttp_server>(edge_handler, vhost->address().xip2());
+    http_server->start(port, std::thread::hardware_concurrency());
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+    std::atomic<uint32_t> ok_count{0};
+    std::atomic<uint32_t> fail_count{0};
+    auto begin = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (uint32_t c = 0; c < clients; c++) {
+        threads.emplace_back([&, c] {
+            HttpClient client("127.0.0.1:" + std::to_string(port));
+            for (uint32_t i = 0; i < requests_per_client; i++) {
+                std::string content = "version=1.0&target_account_addr=T-" + std::to_string(c) + "&method=requestToken&sequence_id=" + std::to_string(i);
+                try {
+                    auto response = client.request("POST", "/", content);
+                    if (response->content.string().find("\"data\"") != std::string::npos) {
+                        ok_count++;
+                    } else {
+                        fail_count++;
+                    }
+                } catch (std::exception const &) {
+                    fail_count++;
+                }
+            }
+        });
+    }
+    for (auto & t : threads) {
+        t.join();
+    }
+    auto end = std::chrono::steady_clock::now();
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count();
+    std::cout << "http server: " << clients << " keep-alive clients, " << ok_count.load() << " ok, " << fail_count.load() << " failed, " << ms
+              << "ms, qps=" << (uint64_t)(ok_count.load() + fail_count.load()) * 1000 / (ms + 1) << std::endl;
+}
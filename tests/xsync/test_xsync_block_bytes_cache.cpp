@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include "xsync/xsync_block_bytes_cache.h"
+
+using namespace top;
+using namespace top::sync;
+
+static xsync_block_bytes_ptr_t make_bytes(size_t size, char c) {
+    return std::make_shared<const std::string>(size, c);
+}
+
+TEST(xsync_block_bytes_cache, get_put) {
+    xsync_block_bytes_cache_t cache(16 * 1024);
+
+    ASSERT_EQ(cache.get("T-a", 1), nullptr);
+    cache.put("T-a", 1, make_bytes(100, 'a'));
+    cache.put("T-b", 1, make_bytes(200, 'b'));
+    ASSERT_EQ(cache.size(), 2);
+    ASSERT_EQ(cache.bytes(), 300);
+
+    auto bytes = cache.get("T-a", 1);
+    ASSERT_NE(bytes, nullptr);
+    ASSERT_EQ(*bytes, std::string(100, 'a'));
+    ASSERT_EQ(cache.get("T-a", 2), nullptr);
+
+    // same key replaces old bytes
+    cache.put("T-a", 1, make_bytes(50, 'c'));
+    ASSERT_EQ(cache.size(), 2);
+    ASSERT_EQ(cache.bytes(), 250);
+    ASSERT_EQ(*cache.get("T-a", 1), std::string(50, 'c'));
+}
+
+TEST(xsync_block_bytes_cache, evict_least_recently_used) {
+    xsync_block_bytes_cache_t cache(16 * 1000);
+
+    for (uint64_t height = 1; height <= 16; height++) {
+        cache.put("T-a", height, make_bytes(1000, 'a'));
+    }
+    ASSERT_EQ(cache.size(), 16);
+
+    // touch height 1, height 2 becomes the oldest
+    ASSERT_NE(cache.get("T-a", 1), nullptr);
+    cache.put("T-a", 17, make_bytes(1000, 'a'));
+    ASSERT_EQ(cache.size(), 16);
+    ASSERT_LE(cache.bytes(), 16 * 1000);
+    ASSERT_NE(cache.get("T-a", 1), nullptr);
+    ASSERT_EQ(cache.get("T-a", 2), nullptr);
+    ASSERT_NE(cache.get("T-a", 17), nullptr);
+
+    // too large for the cache, not kept
+    cache.put("T-a", 18, make_bytes(1001, 'a'));
+    ASSERT_EQ(cache.get("T-a", 18), nullptr);
+    ASSERT_EQ(cache.size(), 16);
+}
@@ -0,0 +1,100 @@
+#include <atomic>
+#include <gtest/gtest.h>
+#include "xsync/xsync_block_verifier.h"
+#include "xsync/xsync_util.h"
+#include "xdata/tests/test_blockutl.hpp"
+#include "xdata/xnative_contract_address.h"
+#include "../mock/xmock_auth.hpp"
+
+using namespace top;
+using namespace top::sync;
+using namespace top::data;
+
+class xcounting_auth_t : public top::mock::xmock_auth_t {
+public:
+    xcounting_auth_t(uint64_t fail_height = 0) : xmock_auth_t(1), m_fail_height(fail_height) {
+    }
+
+    base::enum_vcert_auth_result verify_muti_sign(const base::xvblock_t * test_for_block) override {
+        m_verify_count++;
+        if (test_for_block->get_height() == m_fail_height)
+            return base::enum_vcert_auth_result::enum_verify_fail;
+        return base::enum_vcert_auth_result::enum_successful;
+    }
+
+    std::atomic<uint32_t> m_verify_count{0};
+    uint64_t m_fail_height;
+};
+
+static std::vector<xblock_ptr_t> create_blocks(const std::string &address, uint32_t count) {
+    std::vector<xblock_ptr_t> blocks;
+    base::xvblock_t* prev_block = test_blocktuil::create_genesis_empty_table(address);
+    for (uint32_t i = 1; i <= count; i++) {
+        prev_block = test_blocktuil::create_next_emptyblock(prev_block);
+        prev_block->add_ref();
+        base::xauto_ptr<base::xvblock_t> autoptr = prev_block;
+        blocks.push_back(autoptr_to_blockptr(autoptr));
+    }
+    return blocks;
+}
+
+TEST(xsync_block_verifier, check_blocks_linked) {
+    std::string address = xdatautil::serialize_owner_str(sys_contract_sharding_table_block_addr, 0);
+    std::vector<xblock_ptr_t> blocks = create_blocks(address, 5);
+    ASSERT_TRUE(check_blocks_linked(blocks));
+    ASSERT_TRUE(blocks_off_tail_chain(blocks).empty());
+
+    // hole in heights
+    std::vector<xblock_ptr_t> hole_blocks = {blocks[0], blocks[1], blocks[3]};
+    ASSERT_FALSE(check_blocks_linked(hole_blocks));
+
+    // block of another chain at the same height
+    std::string other_address = xdatautil::serialize_owner_str(sys_contract_sharding_table_block_addr, 1);
+    std::vector<xblock_ptr_t> other_blocks = create_blocks(other_address, 5);
+    std::vector<xblock_ptr_t> mixed_blocks = {blocks[0], blocks[1], other_blocks[2], blocks[3]};
+    ASSERT_FALSE(check_blocks_linked(mixed_blocks));
+
+    // only blocks linked back from the tail are covered by its multi-sign
+    std::vector<xblock_ptr_t> tail_blocks = {blocks[0], other_blocks[1], blocks[1], blocks[2]};
+    auto off_blocks = blocks_off_tail_chain(tail_blocks);
+    ASSERT_EQ(off_blocks.size(), 1);
+    ASSERT_EQ(off_blocks[0]->get_block_hash(), other_blocks[1]->get_block_hash());
+}
+
+TEST(xsync_block_verifier, verify) {
+    std::string address = xdatautil::serialize_owner_str(sys_contract_beacon_table_block_addr, 0);
+    std::vector<xblock_ptr_t> blocks = create_blocks(address, 50);
+    ASSERT_EQ(blocks_before_elect_boundary(blocks), 50);
+    ASSERT_EQ(blocks_before_elect_boundary({}), 0);
+
+    for (uint32_t thread_count : {0, 4}) {
+        // thread_count 0 means no pool, caller thread only
+        xcounting_auth_t auth;
+        xsync_block_verifier_t verifier(thread_count);
+        std::vector<uint8_t> passed;
+        ASSERT_TRUE(verifier.verify(make_observer(&auth), blocks, passed));
+        ASSERT_EQ(auth.m_verify_count, 50);
+        for (uint32_t i = 0; i < blocks.size(); i++) {
+            ASSERT_TRUE(passed[i] != 0);
+            ASSERT_TRUE(blocks[i]->check_block_flag(base::enum_xvblock_flag_authenticated));
+        }
+    }
+}
+
+TEST(xsync_block_verifier, verify_each) {
+    std::string address = xdatautil::serialize_owner_str(sys_contract_sharding_table_block_addr, 0);
+    std::vector<xblock_ptr_t> blocks = create_blocks(address, 50);
+
+    for (uint32_t thread_count : {0, 4}) {
+        // a failed block does not stop the others
+        xcounting_auth_t auth(20);
+        xsync_block_verifier_t verifier(thread_count);
+        std::vector<uint8_t> passed;
+        ASSERT_FALSE(verifier.verify(make_observer(&auth), blocks, passed));
+        ASSERT_EQ(auth.m_verify_count, 50);
+        ASSERT_EQ(passed.size(), 50);
+        for (uint32_t i = 0; i < blocks.size(); i++) {
+            ASSERT_EQ(passed[i] != 0, blocks[i]->get_height() != 20);
+        }
+    }
+}
@@ -7,6 +7,7 @@
 #include "xmbus/xevent.h"
 #include "xsync/xsync_message.h"
 #include "xsync/xgossip_message.h"
+#include "xsync/xsync_block_bytes_cache.h"
 // #include "xblockstore/test/xblockstore_face_mock.h"
 // #include "xblockstore/test/test_blockstore_datamock.hpp"
 #include "xdata/xblocktool.h"
@@ -97,6 +98,40 @@ TEST(xsync_message, blocks) {
     }
 }
 
+TEST(xsync_message, blocks_bytes) {
+    std::string address = xdatautil::serialize_owner_str(sys_contract_sharding_table_block_addr, 0);
+    std::vector<xblock_ptr_t> vector_blocks;
+    std::vector<xsync_block_bytes_ptr_t> vector_blocks_bytes;
+
+    base::xvblock_t* prev_block = test_blocktuil::create_genesis_empty_table(address);
+    for (uint64_t i=1; i<=2; i++) {
+        prev_block = test_blocktuil::create_next_emptyblock(prev_block);
+        prev_block->add_ref();
+
+        base::xauto_ptr<base::xvblock_t> autoptr = prev_block;
+
+        xblock_ptr_t block_ptr = autoptr_to_blockptr(autoptr);
+        vector_blocks.push_back(block_ptr);
+        vector_blocks_bytes.push_back(xsync_block_bytes_cache_t::serialize_block(block_ptr));
+    }
+
+    base::xstream_t stream1(base::xcontext_t::instance());
+    base::xstream_t stream2(base::xcontext_t::instance());
+    make_object_ptr<xsync_message_blocks_t>(address, vector_blocks)->serialize_to(stream1);
+    make_object_ptr<xsync_message_blocks_t>(address, vector_blocks_bytes)->serialize_to(stream2);
+
+    // pre-serialized blocks are the same on wire
+    ASSERT_EQ(stream1.size(), stream2.size());
+    ASSERT_EQ(memcmp(stream1.data(), stream2.data(), stream1.size()), 0);
+
+    auto ptr = make_object_ptr<xsync_message_blocks_t>();
+    ptr->serialize_from(stream2);
+    ASSERT_EQ(ptr->owner, address);
+    ASSERT_EQ(ptr->blocks.size(), 2);
+    ASSERT_EQ(ptr->blocks[0]->get_height(), 1);
+    ASSERT_EQ(ptr->blocks[1]->get_height(), 2);
+}
+
 static xcons_transaction_ptr_t create_cons_transfer_tx(const std::string & from, const std::string & to, uint64_t amount = 100) {
     xtransaction_ptr_t tx = make_object_ptr<xtransaction_t>();
     data::xproperty_asset asset(amount);
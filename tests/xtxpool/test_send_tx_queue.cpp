@@ -1,4 +1,6 @@
 #include "gtest/gtest.h"
+
+#include <chrono>
 #include "test_xtxpool_util.h"
 #include "tests/mock/xvchain_creator.hpp"
 #include "xblockstore/xblockstore_face.h"
@@ -593,3 +595,97 @@ TEST_F(test_send_tx_queue, reached_upper_limit_basic) {
     ret = send_tx_queue.push_tx(tx_ent3, 0);
     ASSERT_EQ(xtxpool_error_queue_reached_upper_limit, ret);
 }
+
+TEST_F(test_send_tx_queue, ready_queue_order) {
+    std::vector<std::shared_ptr<xtx_entry>> tx_ents;
+    for (uint32_t i = 0; i < 200; i++) {
+        xcons_transaction_ptr_t tx = test_xtxpool_util_t::create_cons_transfer_tx(i % 3, (i + 1) % 3, i / 3, 1000 + i, {}, 100, 100, false);
+        xtx_para_t para;
+        para.set_charge_score(i % 7);
+        para.set_tx_type_score(i % 2);
+        para.set_timestamp(i % 11);
+        tx_ents.push_back(xtx_entry::create(tx, para));
+    }
+
+    xready_send_tx_queue_t heap;
+    for (auto & tx_ent : tx_ents) {
+        heap.push(tx_ent.get());
+    }
+    for (uint32_t i = 0; i < tx_ents.size(); i += 5) {
+        heap.erase(tx_ents[i].get());
+        ASSERT_EQ(tx_ents[i]->get_queue_pos(), xtx_entry_invalid_queue_pos);
+    }
+
+    std::multiset<std::shared_ptr<xtx_entry>, xready_send_tx_queue_comp> expect_queue;
+    for (uint32_t i = 0; i < tx_ents.size(); i++) {
+        if (i % 5 != 0) {
+            expect_queue.insert(tx_ents[i]);
+        }
+    }
+    ASSERT_EQ(heap.size(), expect_queue.size());
+
+    // heap keep no insertion order for equivalent entries, so compare by comparator
+    xready_send_tx_queue_comp comp;
+    auto it_expect = expect_queue.begin();
+    heap.visit_in_order([&](xtx_entry * tx_ent) {
+        EXPECT_FALSE(comp(tx_ent, it_expect->get()));
+        EXPECT_FALSE(comp(it_expect->get(), tx_ent));
+        it_expect++;
+        return true;
+    });
+    ASSERT_EQ(it_expect, expect_queue.end());
+}
+
+TEST_F(test_send_tx_queue, BENCH_send_tx_queue_internal_100k) {
+    std::string table_addr = "table_test";
+    xtxpool_shard_info_t shard(0, 0, 0, common::xnode_type_t::auditor);
+    xtxpool_statistic_t statistic;
+    xtable_state_cache_t table_state_cache(nullptr, table_addr);
+    xtxpool_table_info_t table_para(table_addr, &shard, &statistic, &table_state_cache);
+
+    // table queue limit is far below 100k, so bench the engine(hash index + ready heap) directly
+    const uint32_t pending_num = 100000;
+    const uint32_t get_txs_rounds = 1000;
+    const uint32_t get_txs_num = 64;
+    std::vector<xcons_transaction_ptr_t> txs;
+    for (uint32_t i = 0; i < pending_num; i++) {
+        txs.push_back(test_xtxpool_util_t::create_cons_transfer_tx(i % 3, (i + 1) % 3, i / 3, 1000 + i, {}, 100, 100, false));
+    }
+    std::vector<uint256_t> hashes;
+    for (auto & tx : txs) {
+        hashes.push_back(tx->get_tx_hash_256());
+    }
+
+    xsend_tx_queue_internal_t send_tx_queue_internal(&table_para);
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < pending_num; i++) {
+        xtx_para_t para;
+        para.set_charge_score(i % 100);
+        para.set_timestamp(i);
+        send_tx_queue_internal.insert_ready_tx(xtx_entry::create(txs[i], para));
+    }
+    auto push_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+    ASSERT_EQ(send_tx_queue_internal.size(), pending_num);
+
+    start = std::chrono::steady_clock::now();
+    uint32_t visited = 0;
+    for (uint32_t i = 0; i < get_txs_rounds; i++) {
+        uint32_t count = 0;
+        send_tx_queue_internal.visit_ready_txs([&](xtx_entry * tx_ent) {
+            visited += (send_tx_queue_internal.find(tx_ent->get_tx()->get_tx_hash_256()) != nullptr);
+            return ++count < get_txs_num;
+        });
+    }
+    auto get_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+    ASSERT_EQ(visited, get_txs_rounds * get_txs_num);
+
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < pending_num; i++) {
+        send_tx_queue_internal.erase_ready_tx(hashes[(i * 7919) % pending_num]);  // pop in random-like order
+    }
+    auto pop_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+    ASSERT_EQ(send_tx_queue_internal.size(), 0);
+
+    std::cout << "pending=" << pending_num << " push=" << push_ms << "ms get_txs(" << get_txs_rounds << "x" << get_txs_num << ")=" << get_ms << "ms pop=" << pop_ms << "ms"
+              << std::endl;
+}
@@ -1,4 +1,9 @@
 #include "gtest/gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
 #include "test_xtxpool_util.h"
 #include "tests/mock/xdatamock_table.hpp"
 #include "tests/mock/xvchain_creator.hpp"
@@ -54,3 +59,90 @@ TEST_F(test_xtxpool, sub_unsub) {
 
     pthread_join(tid, NULL);
 }
+
+// every worker drives one table of a shared xtxpool_t(push_send_tx,get_ready_txs,pop_tx),tables never share a lock,
+// so throughput should grow near linearly with worker number.txs are made before timing and workers start together.
+static uint64_t run_tables_parallel(uint32_t table_num, uint32_t loop_count) {
+    mock::xvchain_creator creator;
+    creator.create_blockstore_with_xstore();
+    base::xvblockstore_t * blockstore = creator.get_blockstore();
+    store::xstore_face_t * xstore = creator.get_xstore();
+    auto para = std::make_shared<xtxpool_resources>(make_observer(xstore), make_observer(blockstore), nullptr, nullptr);
+    xtxpool_t xtxpool(para);
+    xtxpool.subscribe_tables(0, 0, table_num - 1, common::xnode_type_t::auditor);
+
+    std::vector<std::string> table_addrs;
+    std::vector<std::vector<xcons_transaction_ptr_t>> table_txs;
+    for (uint32_t t = 0; t < table_num; t++) {
+        mock::xdatamock_table mocktable(t, 2);
+        for (auto & unit : mocktable.get_all_genesis_units()) {
+            blockstore->store_block(base::xvaccount_t(unit->get_account()), unit.get());
+        }
+        std::vector<std::string> accounts = mocktable.get_unit_accounts();
+        table_addrs.push_back(mocktable.get_account());
+        table_txs.push_back(mocktable.create_send_txs(accounts[0], accounts[1], 10));
+        // the table must really accept txs,otherwise the benchmark only measures rejections
+        xtx_para_t tx_para;
+        EXPECT_EQ(xtxpool.push_send_tx(std::make_shared<xtx_entry>(table_txs[t][0], tx_para)), 0);
+        xtxpool.pop_tx(tx_info_t(table_txs[t][0]));
+    }
+
+    std::atomic<uint32_t> ready_workers{0};
+    std::atomic<bool> started{false};
+    std::atomic<uint64_t> total_ops{0};
+    std::vector<std::thread> workers;
+    for (uint32_t t = 0; t < table_num; t++) {
+        workers.push_back(std::thread([&, t]() {
+            const std::vector<xcons_transaction_ptr_t> & txs = table_txs[t];
+            base::xreceiptid_state_ptr_t receiptid_state_highqc = std::make_shared<base::xreceiptid_state_t>();
+            xtxs_pack_para_t pack_para(table_addrs[t], receiptid_state_highqc, {}, 40, 35, 30);
+            ready_workers++;
+            while (!started) {
+                std::this_thread::yield();
+            }
+            uint64_t ops = 0;
+            for (uint32_t i = 0; i < loop_count; i++) {
+                for (auto & tx : txs) {
+                    xtx_para_t tx_para;
+                    xtxpool.push_send_tx(std::make_shared<xtx_entry>(tx, tx_para));
+                    ops++;
+                }
+                auto ready_txs = xtxpool.get_ready_txs(pack_para);
+                ops++;
+                for (auto & tx : ready_txs) {
+                    xtxpool.pop_tx(tx_info_t(tx));
+                    ops++;
+                }
+            }
+            total_ops += ops;
+        }));
+    }
+    while (ready_workers < table_num) {
+        std::this_thread::yield();
+    }
+    auto start = std::chrono::steady_clock::now();
+    started = true;
+    for (auto & worker : workers) {
+        worker.join();
+    }
+    auto duration_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+    if (duration_ms == 0) {
+        duration_ms = 1;
+    }
+    for (uint32_t t = 0; t < table_num; t++) {
+        EXPECT_EQ(xtxpool.query_tx(table_txs[t][0]->get_source_addr(), table_txs[t][0]->get_tx_hash_256()), nullptr);
+    }
+    uint64_t ops_per_second = total_ops * 1000 / duration_ms;
+    std::cout << "tables=" << table_num << " ops=" << total_ops << " time=" << duration_ms << "ms ops/s=" << ops_per_second << std::endl;
+    return ops_per_second;
+}
+
+TEST_F(test_xtxpool, BENCH_tables_parallel_scaling) {
+    const uint32_t loop_count = 2000;
+    uint64_t single_table_ops = run_tables_parallel(1, loop_count);
+    uint32_t cores = std::thread::hardware_concurrency();
+    for (uint32_t table_num = 2; table_num <= 16 && table_num <= cores; table_num *= 2) {
+        uint64_t ops = run_tables_parallel(table_num, loop_count);
+        std::cout << "tables=" << table_num << " speedup=" << (double)ops / single_table_ops << std::endl;
+    }
+}
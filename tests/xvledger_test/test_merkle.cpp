@@ -1,6 +1,9 @@
 #include "gtest/gtest.h"
+#include <chrono>
 #include "xvledger/xvaccount.h"
 #include "xvledger/xmerkle.hpp"
+#include "xvledger/xmerkle_flat.h"
+#include "xutility/xsha256_batch.h"
 #include "xutility/xhash.h"
 #include "xmetrics/xmetrics.h"
 // #include "tests/mock/xvchain_creator.hpp"
@@ -438,3 +441,137 @@ TEST_F(test_merkle, merkle_hash_count_compare) {
     }
 #endif
 }
+
+TEST_F(test_merkle, merkle_flat_same_as_merkle) {
+    using impl_t = utl::xsha256_batch_t::xsha256_impl_t;
+    const impl_t default_impl = utl::xsha256_batch_t::get_impl();
+    for (auto impl : {impl_t::scalar, impl_t::avx2, impl_t::shani}) {
+        if (!utl::xsha256_batch_t::set_impl(impl)) {
+            continue;
+        }
+        for (size_t count = 1; count <= 130; count++) {
+            std::vector<std::string> leafs;
+            for (size_t i = 0; i < count; i++) {
+                leafs.push_back("leaf" + std::to_string(i));
+            }
+            xmerkle_t<utl::xsha2_256_t, uint256_t> merkle(leafs);
+            xmerkle_flat_t merkle_flat(leafs);
+            const std::string root = merkle.calc_root_hash(leafs);
+            ASSERT_EQ(root, merkle_flat.get_root());
+            ASSERT_EQ(root, xmerkle_t<utl::xsha2_256_t, uint256_t>::calc_root(leafs));
+
+            for (size_t i = 0; i < count; i++) {
+                xmerkle_path_256_t path;
+                ASSERT_TRUE(merkle.calc_path_hash(leafs[i], path.get_levels_for_write()));
+                xmerkle_path_256_t path_flat;
+                ASSERT_TRUE(merkle_flat.calc_path(i, path_flat.get_levels_for_write()));
+                ASSERT_TRUE(path.get_levels() == path_flat.get_levels());
+                ASSERT_TRUE(merkle.validate_path(leafs[i], root, path_flat.get_levels()));
+                ASSERT_EQ(merkle_flat.find_leaf(leafs[i]), (int64_t)i);
+            }
+        }
+    }
+    utl::xsha256_batch_t::set_impl(default_impl);
+}
+
+TEST_F(test_merkle, merkle_flat_same_leafs) {
+    std::vector<std::string> leafs = {"a", "b", "a", "c", "b"};
+    xmerkle_t<utl::xsha2_256_t, uint256_t> merkle(leafs);
+    xmerkle_flat_t merkle_flat(leafs);
+    ASSERT_EQ(merkle.calc_root_hash(leafs), merkle_flat.get_root());
+    ASSERT_EQ(merkle_flat.find_leaf("a"), 0);
+    ASSERT_EQ(merkle_flat.find_leaf("b"), 1);
+    ASSERT_EQ(merkle_flat.find_leaf("d"), -1);
+    for (auto & leaf : leafs) {
+        xmerkle_path_256_t path;
+        ASSERT_TRUE(merkle.calc_path_hash(leaf, path.get_levels_for_write()));
+        xmerkle_path_256_t path_flat;
+        ASSERT_TRUE(merkle_flat.calc_path(leaf, path_flat.get_levels_for_write()));
+        ASSERT_TRUE(path.get_levels() == path_flat.get_levels());
+    }
+
+    xmerkle_flat_t empty_merkle;
+    ASSERT_FALSE(empty_merkle.build({}));
+    ASSERT_TRUE(empty_merkle.get_root().empty());
+    xmerkle_path_256_t path;
+    ASSERT_FALSE(empty_merkle.calc_path(0, path.get_levels_for_write()));
+}
+
+TEST_F(test_merkle, merkle_flat_root_only) {
+    std::vector<std::string> leafs = {"a", "b", "a", "c", "b"};
+    xmerkle_flat_t merkle_flat(leafs);
+    xmerkle_flat_t root_only(leafs, false);
+    ASSERT_EQ(merkle_flat.get_root(), root_only.get_root());
+    ASSERT_EQ(root_only.find_leaf("a"), 0);
+    ASSERT_EQ(root_only.find_leaf("b"), 1);
+    ASSERT_EQ(root_only.find_leaf("c"), 3);
+    ASSERT_EQ(root_only.find_leaf("d"), -1);
+    for (size_t i = 0; i < leafs.size(); i++) {
+        xmerkle_path_256_t path;
+        ASSERT_TRUE(merkle_flat.calc_path(i, path.get_levels_for_write()));
+        xmerkle_path_256_t path_root_only;
+        ASSERT_TRUE(root_only.calc_path(i, path_root_only.get_levels_for_write()));
+        ASSERT_TRUE(path.get_levels() == path_root_only.get_levels());
+    }
+
+    // rebuild with index after a root-only build
+    ASSERT_TRUE(root_only.build(leafs));
+    ASSERT_EQ(root_only.find_leaf("c"), 3);
+}
+
+TEST_F(test_merkle, BENCH_merkle_flat) {
+    using impl_t = utl::xsha256_batch_t::xsha256_impl_t;
+    const impl_t default_impl = utl::xsha256_batch_t::get_impl();
+    for (size_t count : {1000, 10000, 100000}) {
+        std::vector<std::string> leafs;
+        for (size_t i = 0; i < count; i++) {
+            leafs.push_back(std::string(100, 'a') + std::to_string(i));  // about size of one action
+        }
+
+        auto begin = std::chrono::steady_clock::now();
+        xmerkle_t<utl::xsha2_256_t, uint256_t> merkle(leafs);
+        std::string root = merkle.calc_root_hash(leafs);
+        auto end = std::chrono::steady_clock::now();
+        std::cout << "leafs=" << count << " xmerkle_t build "
+                  << std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count() << "us" << std::endl;
+
+        for (auto impl : {impl_t::scalar, impl_t::avx2, impl_t::shani}) {
+            if (!utl::xsha256_batch_t::set_impl(impl)) {
+                continue;
+            }
+            begin = std::chrono::steady_clock::now();
+            xmerkle_flat_t merkle_flat(leafs);
+            end = std::chrono::steady_clock::now();
+            ASSERT_EQ(root, merkle_flat.get_root());
+            std::cout << "leafs=" << count << " xmerkle_flat_t(" << utl::xsha256_batch_t::get_impl_name() << ") build "
+                      << std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count() << "us";
+
+            begin = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < count; i++) {
+                xmerkle_path_256_t path;
+                merkle_flat.calc_path(leafs[i], path.get_levels_for_write());
+            }
+            end = std::chrono::steady_clock::now();
+            std::cout << ", all paths " << std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count() << "us" << std::endl;
+        }
+    }
+    utl::xsha256_batch_t::set_impl(default_impl);
+}
+
+TEST_F(test_merkle, input_merkle_tx_leaf_index) {
+    std::vector<std::string> leafs = {"action0", "action1", "action2", "action3", "action4"};
+    std::vector<std::string> txhashs = {"tx0", "", "tx2", "tx3", "tx2"};
+    xinput_merkle_t input_merkle(leafs, txhashs);
+    ASSERT_EQ(input_merkle.get_root(), xmerkle_t<utl::xsha2_256_t, uint256_t>::calc_root(leafs));
+    ASSERT_EQ(input_merkle.find_tx_leaf("tx0"), 0);
+    ASSERT_EQ(input_merkle.find_tx_leaf("tx3"), 3);
+    ASSERT_EQ(input_merkle.find_tx_leaf(""), -1);
+    ASSERT_EQ(input_merkle.find_tx_leaf("tx2"), -1);  // more than one leaf
+    ASSERT_EQ(input_merkle.find_tx_leaf("tx5"), -1);
+
+    xmerkle_path_256_t path_by_tx;
+    ASSERT_TRUE(input_merkle.get_tree().calc_path((size_t)input_merkle.find_tx_leaf("tx3"), path_by_tx.get_levels_for_write()));
+    xmerkle_path_256_t path_by_leaf;
+    ASSERT_TRUE(input_merkle.get_tree().calc_path(leafs[3], path_by_leaf.get_levels_for_write()));
+    ASSERT_TRUE(path_by_tx.get_levels() == path_by_leaf.get_levels());
+}
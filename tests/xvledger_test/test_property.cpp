@@ -134,3 +134,47 @@ TEST_F(test_property, serialize_compare_2)
         xassert(value2 == value);
     }
 }
+
+TEST_F(test_property, clone_state_share_map_1)
+{
+    xauto_ptr<xvcanvas_t> canvas = new xvcanvas_t();
+    xobject_ptr_t<base::xvbstate_t> prev_state = make_object_ptr<base::xvbstate_t>("T80000733b43e6a2542709dc918ef2209ae0fc6503c2f2", (uint64_t)0, (uint64_t)0, std::string(), std::string(), (uint64_t)0, (uint32_t)0, (uint16_t)0);
+    {
+        xauto_ptr<xmapvar_t<std::string>> prev_map = prev_state->new_string_map_var("@1", canvas.get());
+        for (uint32_t i = 0; i < 1000; i++) {
+            ASSERT_TRUE(prev_map->insert(std::to_string(i), std::to_string(i), canvas.get()));
+        }
+    }
+
+    xobject_ptr_t<base::xvbstate_t> new_state;
+    new_state.attach((base::xvbstate_t*)prev_state->clone());
+    {
+        // modify new state should not change prev state
+        xauto_ptr<xmapvar_t<std::string>> new_map = new_state->load_string_map_var("@1");
+        ASSERT_TRUE(new_map->insert("0", "new", canvas.get()));
+        ASSERT_TRUE(new_map->erase("1", canvas.get()));
+        xauto_ptr<xmapvar_t<std::string>> prev_map = prev_state->load_string_map_var("@1");
+        ASSERT_EQ(prev_map->query("0"), "0");
+        ASSERT_TRUE(prev_map->find("1"));
+        ASSERT_EQ(new_map->query("0"), "new");
+        ASSERT_FALSE(new_map->find("1"));
+    }
+    {
+        // reset shared map of new state
+        xobject_ptr_t<base::xvbstate_t> next_state;
+        next_state.attach((base::xvbstate_t*)new_state->clone());
+        xauto_ptr<xmapvar_t<std::string>> next_map = next_state->load_string_map_var("@1");
+        ASSERT_TRUE(next_map->reset(std::map<std::string, std::string>{{"a", "b"}}, canvas.get()));
+        ASSERT_EQ(next_map->query().size(), 1u);
+        xauto_ptr<xmapvar_t<std::string>> new_map = new_state->load_string_map_var("@1");
+        ASSERT_EQ(new_map->query().size(), 999u);
+    }
+    {
+        // modify after prev state released, no one shares the value anymore
+        prev_state = nullptr;
+        xauto_ptr<xmapvar_t<std::string>> new_map = new_state->load_string_map_var("@1");
+        ASSERT_TRUE(new_map->insert("2", "new", canvas.get()));
+        ASSERT_EQ(new_map->query("2"), "new");
+        ASSERT_EQ(new_map->query().size(), 999u);
+    }
+}
@@ -0,0 +1,57 @@
+#include "gtest/gtest.h"
+#include <set>
+#include "xvledger/xvstatestore.h"
+
+using namespace top;
+using namespace top::base;
+
+namespace {
+const uint64_t checkpoint_interval = xvblkstatestore_t::enum_unit_bstate_checkpoint_interval;
+const uint64_t newest_count = xvblkstatestore_t::enum_max_bstate_newest_count;
+}
+
+TEST(test_statestore, checkpoint_height) {
+    ASSERT_FALSE(xvblkstatestore_t::is_checkpoint_height(0));
+    ASSERT_FALSE(xvblkstatestore_t::is_checkpoint_height(checkpoint_interval - 1));
+    ASSERT_TRUE(xvblkstatestore_t::is_checkpoint_height(checkpoint_interval));
+    ASSERT_TRUE(xvblkstatestore_t::is_checkpoint_height(checkpoint_interval * 3));
+
+    // only the newest checkpoint not above committed height
+    ASSERT_TRUE(xvblkstatestore_t::is_live_unit_checkpoint(checkpoint_interval, checkpoint_interval));
+    ASSERT_TRUE(xvblkstatestore_t::is_live_unit_checkpoint(checkpoint_interval, checkpoint_interval * 2 - 1));
+    ASSERT_FALSE(xvblkstatestore_t::is_live_unit_checkpoint(checkpoint_interval, checkpoint_interval * 2));
+    ASSERT_FALSE(xvblkstatestore_t::is_live_unit_checkpoint(checkpoint_interval * 2, checkpoint_interval * 2 - 1));
+    ASSERT_FALSE(xvblkstatestore_t::is_live_unit_checkpoint(checkpoint_interval + 1, checkpoint_interval + 1));
+}
+
+// execute unit heights one by one and apply the same clear rule as xvblkstatestore_t::clear_persisted_state
+TEST(test_statestore, unit_state_retention) {
+    std::set<uint64_t> persisted;
+    const uint64_t max_height = checkpoint_interval * 10 + 7;
+    for (uint64_t height = 0; height <= max_height; height++) {
+        persisted.insert(height);
+        for (auto delete_height : xvblkstatestore_t::get_unit_state_clear_heights(height)) {
+            persisted.erase(delete_height);
+
+            // a checkpoint written while replay is never one that is already cleared,committed height is at most 2 behind
+            for (uint64_t committed_height = height >= 2 ? height - 2 : 0; committed_height <= height; committed_height++) {
+                ASSERT_FALSE(xvblkstatestore_t::is_live_unit_checkpoint(delete_height, committed_height));
+            }
+        }
+
+        // newest states plus at most one old checkpoint
+        ASSERT_LE(persisted.size(), newest_count + 1) << "height=" << height;
+        for (uint64_t i = 0; i < newest_count && i <= height; i++) {
+            ASSERT_EQ(persisted.count(height - i), 1) << "height=" << height;
+        }
+
+        // rebuild of any newest height without newest states finds a state within one interval
+        if (height >= checkpoint_interval + newest_count) {
+            auto iter = persisted.lower_bound(height - newest_count + 1);
+            ASSERT_TRUE(iter != persisted.begin()) << "height=" << height;
+            --iter;
+            ASSERT_TRUE(xvblkstatestore_t::is_checkpoint_height(*iter));
+            ASSERT_LE(height - *iter, checkpoint_interval + newest_count) << "height=" << height;
+        }
+    }
+}